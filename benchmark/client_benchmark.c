@@ -0,0 +1,1297 @@
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "time.h"
+#include "errno.h"
+#include "unistd.h"
+#include "pthread.h"
+
+#include "netdb.h"
+#include "netinet/in.h"
+
+#include "sys/types.h"
+#include "sys/epoll.h"
+#include "sys/timerfd.h"
+
+#ifndef __DATA_BUFFER
+	#define __DATA_BUFFER 4096
+#else
+	#error __DATA_BUFFER already defined
+#endif
+
+#ifndef __SERVER_PORT
+	#define __SERVER_PORT 1122
+#else
+	#error __SERVER_PORT already defined
+#endif
+
+#ifndef __ROOT_ID
+	#define __ROOT_ID 0
+#else
+	#error __ROOT_ID already defined
+#endif
+
+#ifndef __BENCHMARK_MAX_CONNECTIONS
+	#define __BENCHMARK_MAX_CONNECTIONS 1000
+#else
+	#error __BENCHMARK_MAX_CONNECTIONS already defined
+#endif
+
+#ifndef __BENCHMARK_MAX_THREADS
+	#define __BENCHMARK_MAX_THREADS 64
+#else
+	#error __BENCHMARK_MAX_THREADS already defined
+#endif
+
+#ifndef __BENCHMARK_MAX_TABLES
+	#define __BENCHMARK_MAX_TABLES 64
+#else
+	#error __BENCHMARK_MAX_TABLES already defined
+#endif
+
+#ifndef __BENCHMARK_MAX_COLUMNS
+	#define __BENCHMARK_MAX_COLUMNS 32
+#else
+	#error __BENCHMARK_MAX_COLUMNS already defined
+#endif
+
+#ifndef __BENCHMARK_DRAIN_MSEC
+	#define __BENCHMARK_DRAIN_MSEC 5000
+#else
+	#error __BENCHMARK_DRAIN_MSEC already defined
+#endif
+
+#ifndef __MAX_REPORTED_FAILURES
+	#define __MAX_REPORTED_FAILURES 20
+#else
+	#error __MAX_REPORTED_FAILURES already defined
+#endif
+
+#ifndef __LATENCY_SUB_BUCKET_BITS
+	#define __LATENCY_SUB_BUCKET_BITS 4
+#else
+	#error __LATENCY_SUB_BUCKET_BITS already defined
+#endif
+
+#ifndef __LATENCY_HISTOGRAM_BUCKETS
+	#define __LATENCY_HISTOGRAM_BUCKETS 640
+#else
+	#error __LATENCY_HISTOGRAM_BUCKETS already defined
+#endif
+
+typedef enum {
+	OPERATION_INSERT,
+	OPERATION_SELECT,
+	OPERATION_UPDATE,
+	OPERATION_DELETE,
+	OPERATION_AMOUNT
+} OperationType;
+
+const char *operationName[OPERATION_AMOUNT] = {"insert", "select", "update", "delete"};
+
+typedef enum {
+	RESPONSE_HEAD,
+	RESPONSE_ATTRIBUTE_COUNT,
+	RESPONSE_ATTRIBUTE_NAME,
+	RESPONSE_RECORD_COUNT,
+	RESPONSE_BODY
+} ResponseState;
+
+typedef enum {
+	RESPONSE_PENDING,
+	RESPONSE_SUCCEEDED,
+	RESPONSE_FAILED
+} ResponseResult;
+
+typedef struct {
+	unsigned long long int completed;
+	unsigned long long int failed;
+	unsigned long long int rowsReturned;
+	unsigned long long int latencySum;
+	unsigned long long int latencyMax;
+	unsigned long long int latency[__LATENCY_HISTOGRAM_BUCKETS];
+} OperationStats;
+
+typedef struct {
+	char *username;
+	char *password;
+	char *database;
+	char *outputPath;
+	int connections;
+	int threads;
+	double rate;
+	int duration;
+	int warmup;
+	int tables;
+	int columns;
+	int stringSize;
+	long long int rows;
+	int index;
+	int setup;
+	int weight[OPERATION_AMOUNT];
+	int weightTotal;
+	unsigned long long int seed;
+} BenchmarkConfig;
+
+typedef struct {
+	int fileDescriptor;
+	int index;
+	unsigned long long int random;
+	
+	char sendFrame[__DATA_BUFFER];
+	size_t sendOffset;
+	int sending;
+	int waiting;
+	
+	char receiveFrame[__DATA_BUFFER];
+	size_t receiveOffset;
+	ResponseState state;
+	int remainingAttribute;
+	unsigned long long int rowsReturned;
+	
+	OperationType operation;
+	long long int scheduled;
+	long long int issued;
+} BenchmarkConnection;
+
+typedef struct {
+	pthread_t thread;
+	BenchmarkConnection *connection;
+	int connectionAmount;
+	
+	OperationStats operation[OPERATION_AMOUNT];
+	unsigned long long int *timeline;
+	unsigned long long int warmupCompleted;
+	unsigned long long int unfinished;
+	int disconnected;
+	long long int lastCompletion;
+} BenchmarkWorker;
+
+BenchmarkConfig config;
+struct timespec benchmarkStart;
+long long int nextRowId[__BENCHMARK_MAX_TABLES];
+int reportedFailures = 0;
+
+int establishedConnection()
+{
+	struct sockaddr_in socketAddress;
+	int socketFileDescriptor;
+	struct hostent *localHost;
+	
+	socketFileDescriptor = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (socketFileDescriptor == -1) {
+		fprintf(stderr, "Error: [%s]\n", strerror(errno));
+		return -1;
+	}
+	
+	socketAddress.sin_family = AF_INET;
+	socketAddress.sin_port = htons(__SERVER_PORT);
+	localHost = gethostbyname("localhost");
+	socketAddress.sin_addr = *((struct in_addr *)localHost->h_addr);
+	
+	if (connect(socketFileDescriptor, (struct sockaddr *)&socketAddress, sizeof(socketAddress)) == -1)
+	{
+		fprintf(stderr, "Error: [%s]\n", strerror(errno));
+		close(socketFileDescriptor);
+		return -1;
+	}
+	
+	return socketFileDescriptor;
+}
+
+void constructLoginMessage(char message[], char username[], char password[])
+{
+	message[0] = 'L';
+	int usernameLength = strlen(username);
+	int passwordLength = strlen(password);
+	size_t integerSize = sizeof(usernameLength);
+	memcpy(&message[1], &usernameLength, sizeof(usernameLength));
+	memcpy(&message[1 + integerSize], &passwordLength, sizeof(passwordLength));
+	sprintf(&message[1 + 2 * integerSize], "%s%s", username, password);
+}
+
+int receiveAll(int socketFileDescriptor, char buffer[], size_t size)
+{
+	while (size > 0)
+	{
+		ssize_t received = recv(socketFileDescriptor, buffer, size, 0);
+		if (received <= 0)
+		{
+			return 0;
+		}
+		buffer += received;
+		size -= received;
+	}
+	return 1;
+}
+
+long long int benchmarkClock()
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (now.tv_sec - benchmarkStart.tv_sec) * 1000000LL + (now.tv_nsec - benchmarkStart.tv_nsec) / 1000;
+}
+
+unsigned long long int nextRandom(unsigned long long int *state)
+{
+	unsigned long long int value = *state;
+	value ^= value >> 12;
+	value ^= value << 25;
+	value ^= value >> 27;
+	*state = value;
+	return value * 2685821657736338717ULL;
+}
+
+int latencyBucket(unsigned long long int value)
+{
+	if (value < (1ULL << __LATENCY_SUB_BUCKET_BITS))
+	{
+		return value;
+	}
+	
+	int exponent = 63 - __builtin_clzll(value);
+	int bucket = (exponent - __LATENCY_SUB_BUCKET_BITS + 1) * (1 << __LATENCY_SUB_BUCKET_BITS) +
+		((value >> (exponent - __LATENCY_SUB_BUCKET_BITS)) & ((1ULL << __LATENCY_SUB_BUCKET_BITS) - 1));
+	return bucket < __LATENCY_HISTOGRAM_BUCKETS ? bucket : __LATENCY_HISTOGRAM_BUCKETS - 1;
+}
+
+unsigned long long int latencyBucketUpperBound(int bucket)
+{
+	int subBuckets = 1 << __LATENCY_SUB_BUCKET_BITS;
+	if (bucket < subBuckets)
+	{
+		return bucket;
+	}
+	
+	int shift = bucket / subBuckets - 1;
+	unsigned long long int lowerBound = (unsigned long long int)(subBuckets + bucket % subBuckets) << shift;
+	return lowerBound + (1ULL << shift) - 1;
+}
+
+unsigned long long int latencyPercentile(OperationStats *stats, double quantile)
+{
+	if (stats->completed == 0)
+	{
+		return 0;
+	}
+	
+	unsigned long long int rank = (unsigned long long int)(quantile * stats->completed + 0.999999);
+	if (rank < 1)
+	{
+		rank = 1;
+	}
+	
+	unsigned long long int seen = 0;
+	for (int bucket = 0; bucket < __LATENCY_HISTOGRAM_BUCKETS; bucket++)
+	{
+		seen += stats->latency[bucket];
+		if (seen >= rank)
+		{
+			unsigned long long int upperBound = latencyBucketUpperBound(bucket);
+			return upperBound < stats->latencyMax ? upperBound : stats->latencyMax;
+		}
+	}
+	return stats->latencyMax;
+}
+
+void mergeOperationStats(OperationStats *total, OperationStats *stats)
+{
+	total->completed += stats->completed;
+	total->failed += stats->failed;
+	total->rowsReturned += stats->rowsReturned;
+	total->latencySum += stats->latencySum;
+	if (stats->latencyMax > total->latencyMax)
+	{
+		total->latencyMax = stats->latencyMax;
+	}
+	for (int bucket = 0; bucket < __LATENCY_HISTOGRAM_BUCKETS; bucket++)
+	{
+		total->latency[bucket] += stats->latency[bucket];
+	}
+}
+
+int isStringColumn(int column)
+{
+	return column % 2 == 1;
+}
+
+int appendRandomValue(char statement[], int length, int column, unsigned long long int *random)
+{
+	if (isStringColumn(column) == 0)
+	{
+		return length + sprintf(statement + length, "%lld", (long long int)(nextRandom(random) % 1000000000ULL));
+	}
+	
+	statement[length++] = '\'';
+	for (int i = 0; i < config.stringSize; i++)
+	{
+		statement[length++] = 'a' + nextRandom(random) % 26;
+	}
+	statement[length++] = '\'';
+	statement[length] = '\0';
+	return length;
+}
+
+int appendRowValues(char statement[], int length, long long int id, unsigned long long int *random)
+{
+	length += sprintf(statement + length, "(%lld", id);
+	for (int column = 1; column <= config.columns; column++)
+	{
+		length += sprintf(statement + length, ", ");
+		length = appendRandomValue(statement, length, column, random);
+	}
+	length += sprintf(statement + length, ")");
+	return length;
+}
+
+int rowStatementLength()
+{
+	return 64 + config.columns * (config.stringSize > 20 ? config.stringSize + 4 : 24);
+}
+
+ResponseResult readResponse(int socketFileDescriptor, char message[])
+{
+	char frame[__DATA_BUFFER];
+	if (receiveAll(socketFileDescriptor, frame, sizeof(frame)) == 0)
+	{
+		strcpy(message, "connection closed");
+		return RESPONSE_FAILED;
+	}
+	
+	if (frame[0] == 'M')
+	{
+		snprintf(message, __DATA_BUFFER, "%s", frame + 1);
+		return frame[1] == 'B' ? RESPONSE_SUCCEEDED : RESPONSE_FAILED;
+	}
+	if (frame[0] != 'Q')
+	{
+		snprintf(message, __DATA_BUFFER, "unexpected frame '%c'", frame[0]);
+		return RESPONSE_FAILED;
+	}
+	
+	int attributeAmount = 0;
+	receiveAll(socketFileDescriptor, frame, sizeof(frame));
+	memcpy(&attributeAmount, frame, sizeof(attributeAmount));
+	for (int i = 0; i <= attributeAmount; i++)
+	{
+		receiveAll(socketFileDescriptor, frame, sizeof(frame));
+	}
+	while (receiveAll(socketFileDescriptor, frame, sizeof(frame)) == 1)
+	{
+		if (frame[0] == 'F')
+		{
+			message[0] = '\0';
+			return RESPONSE_SUCCEEDED;
+		}
+	}
+	strcpy(message, "connection closed");
+	return RESPONSE_FAILED;
+}
+
+ResponseResult executeStatement(int socketFileDescriptor, char statement[], char message[])
+{
+	char frame[__DATA_BUFFER];
+	memset(frame, 0, sizeof(frame));
+	snprintf(frame, sizeof(frame), "%s;", statement);
+	if (send(socketFileDescriptor, frame, sizeof(frame), MSG_NOSIGNAL) != sizeof(frame))
+	{
+		strcpy(message, "connection closed");
+		return RESPONSE_FAILED;
+	}
+	return readResponse(socketFileDescriptor, message);
+}
+
+int openBenchmarkConnection()
+{
+	int socketFileDescriptor = establishedConnection();
+	if (socketFileDescriptor == -1)
+	{
+		return -1;
+	}
+	
+	char message[__DATA_BUFFER];
+	memset(message, 0, sizeof(message));
+	if (config.username == NULL)
+	{
+		strcpy(message, "root");
+		send(socketFileDescriptor, message, sizeof(message), MSG_NOSIGNAL);
+	}
+	else
+	{
+		constructLoginMessage(message, config.username, config.password);
+		send(socketFileDescriptor, message, sizeof(message), MSG_NOSIGNAL);
+		if (receiveAll(socketFileDescriptor, message, sizeof(message)) == 0 || strcmp(message, "success") != 0)
+		{
+			fprintf(stderr, "Login failed\n");
+			close(socketFileDescriptor);
+			return -1;
+		}
+	}
+	
+	char statement[__DATA_BUFFER];
+	snprintf(statement, sizeof(statement), "USE %s", config.database);
+	if (executeStatement(socketFileDescriptor, statement, message) != RESPONSE_SUCCEEDED)
+	{
+		fprintf(stderr, "%s: %s\n", statement, message);
+		close(socketFileDescriptor);
+		return -1;
+	}
+	return socketFileDescriptor;
+}
+
+int setupBenchmarkSchema(double *loadSeconds)
+{
+	int socketFileDescriptor = establishedConnection();
+	if (socketFileDescriptor == -1)
+	{
+		return 0;
+	}
+	
+	char message[__DATA_BUFFER];
+	char statement[__DATA_BUFFER];
+	memset(message, 0, sizeof(message));
+	if (config.username == NULL)
+	{
+		strcpy(message, "root");
+		send(socketFileDescriptor, message, sizeof(message), MSG_NOSIGNAL);
+	}
+	else
+	{
+		constructLoginMessage(message, config.username, config.password);
+		send(socketFileDescriptor, message, sizeof(message), MSG_NOSIGNAL);
+		if (receiveAll(socketFileDescriptor, message, sizeof(message)) == 0 || strcmp(message, "success") != 0)
+		{
+			fprintf(stderr, "Login failed\n");
+			close(socketFileDescriptor);
+			return 0;
+		}
+	}
+	
+	snprintf(statement, sizeof(statement), "CREATE DATABASE %s", config.database);
+	executeStatement(socketFileDescriptor, statement, message);
+	
+	snprintf(statement, sizeof(statement), "USE %s", config.database);
+	if (executeStatement(socketFileDescriptor, statement, message) != RESPONSE_SUCCEEDED)
+	{
+		fprintf(stderr, "%s: %s\n", statement, message);
+		close(socketFileDescriptor);
+		return 0;
+	}
+	
+	struct timespec loadStart;
+	struct timespec loadEnd;
+	clock_gettime(CLOCK_MONOTONIC, &loadStart);
+	
+	unsigned long long int random = config.seed;
+	int rowLength = rowStatementLength();
+	for (int table = 0; table < config.tables; table++)
+	{
+		snprintf(statement, sizeof(statement), "DROP TABLE bench%d", table);
+		executeStatement(socketFileDescriptor, statement, message);
+		
+		int length = sprintf(statement, "CREATE TABLE bench%d (id LONG", table);
+		for (int column = 1; column <= config.columns; column++)
+		{
+			if (isStringColumn(column) == 1)
+			{
+				length += sprintf(statement + length, ", c%d STRING(%d)", column, config.stringSize);
+			}
+			else
+			{
+				length += sprintf(statement + length, ", c%d LONG", column);
+			}
+		}
+		sprintf(statement + length, ")");
+		if (executeStatement(socketFileDescriptor, statement, message) != RESPONSE_SUCCEEDED)
+		{
+			fprintf(stderr, "CREATE TABLE bench%d: %s\n", table, message);
+			close(socketFileDescriptor);
+			return 0;
+		}
+		
+		long long int id = 0;
+		while (id < config.rows)
+		{
+			length = sprintf(statement, "INSERT INTO bench%d ", table);
+			int first = 1;
+			while (id < config.rows && length + rowLength < __DATA_BUFFER - 2)
+			{
+				if (first == 0)
+				{
+					length += sprintf(statement + length, ", ");
+				}
+				length = appendRowValues(statement, length, id++, &random);
+				first = 0;
+			}
+			if (executeStatement(socketFileDescriptor, statement, message) != RESPONSE_SUCCEEDED)
+			{
+				fprintf(stderr, "Loading bench%d failed at row %lld: %s\n", table, id, message);
+				close(socketFileDescriptor);
+				return 0;
+			}
+		}
+		nextRowId[table] = config.rows;
+		
+		if (config.index == 1)
+		{
+			snprintf(statement, sizeof(statement), "CREATE INDEX ON bench%d (id)", table);
+			if (executeStatement(socketFileDescriptor, statement, message) != RESPONSE_SUCCEEDED)
+			{
+				fprintf(stderr, "%s: %s\n", statement, message);
+				close(socketFileDescriptor);
+				return 0;
+			}
+		}
+	}
+	
+	clock_gettime(CLOCK_MONOTONIC, &loadEnd);
+	*loadSeconds = (loadEnd.tv_sec - loadStart.tv_sec) + (loadEnd.tv_nsec - loadStart.tv_nsec) / 1000000000.0;
+	close(socketFileDescriptor);
+	return 1;
+}
+
+OperationType pickOperation(unsigned long long int *random)
+{
+	int pick = nextRandom(random) % config.weightTotal;
+	for (int operation = 0; operation < OPERATION_AMOUNT; operation++)
+	{
+		if (pick < config.weight[operation])
+		{
+			return operation;
+		}
+		pick -= config.weight[operation];
+	}
+	return OPERATION_SELECT;
+}
+
+void buildStatement(BenchmarkConnection *connection)
+{
+	char *statement = connection->sendFrame;
+	int table = nextRandom(&connection->random) % config.tables;
+	long long int rowAmount = __atomic_load_n(&nextRowId[table], __ATOMIC_RELAXED);
+	long long int id = rowAmount > 0 ? (long long int)(nextRandom(&connection->random) % rowAmount) : 0;
+	int length = 0;
+	
+	memset(statement, 0, __DATA_BUFFER);
+	connection->operation = pickOperation(&connection->random);
+	if (connection->operation == OPERATION_INSERT)
+	{
+		id = __atomic_fetch_add(&nextRowId[table], 1, __ATOMIC_RELAXED);
+		length = sprintf(statement, "INSERT INTO bench%d ", table);
+		length = appendRowValues(statement, length, id, &connection->random);
+	}
+	else if (connection->operation == OPERATION_SELECT)
+	{
+		length = sprintf(statement, "SELECT * FROM bench%d WHERE id = %lld", table, id);
+	}
+	else if (connection->operation == OPERATION_UPDATE)
+	{
+		length = sprintf(statement, "UPDATE bench%d SET c1=", table);
+		length = appendRandomValue(statement, length, 1, &connection->random);
+		length += sprintf(statement + length, " WHERE id = %lld", id);
+	}
+	else
+	{
+		length = sprintf(statement, "DELETE FROM bench%d WHERE id = %lld", table, id);
+	}
+	statement[length] = ';';
+}
+
+ResponseResult handleResponseFrame(BenchmarkConnection *connection, char frame[])
+{
+	int value = 0;
+	if (connection->state == RESPONSE_HEAD)
+	{
+		if (frame[0] == 'M')
+		{
+			return frame[1] == 'B' ? RESPONSE_SUCCEEDED : RESPONSE_FAILED;
+		}
+		if (frame[0] == 'Q')
+		{
+			connection->state = RESPONSE_ATTRIBUTE_COUNT;
+		}
+		else if (frame[0] == 'F')
+		{
+			return RESPONSE_SUCCEEDED;
+		}
+	}
+	else if (connection->state == RESPONSE_ATTRIBUTE_COUNT)
+	{
+		memcpy(&value, frame, sizeof(value));
+		connection->remainingAttribute = value;
+		connection->state = value > 0 ? RESPONSE_ATTRIBUTE_NAME : RESPONSE_RECORD_COUNT;
+	}
+	else if (connection->state == RESPONSE_ATTRIBUTE_NAME)
+	{
+		connection->remainingAttribute--;
+		if (connection->remainingAttribute == 0)
+		{
+			connection->state = RESPONSE_RECORD_COUNT;
+		}
+	}
+	else if (connection->state == RESPONSE_RECORD_COUNT)
+	{
+		connection->state = RESPONSE_BODY;
+	}
+	else if (frame[0] == 'R')
+	{
+		connection->rowsReturned++;
+	}
+	else if (frame[0] == 'F')
+	{
+		return RESPONSE_SUCCEEDED;
+	}
+	return RESPONSE_PENDING;
+}
+
+void completeOperation(BenchmarkWorker *worker, BenchmarkConnection *connection, int succeeded, char message[])
+{
+	long long int now = benchmarkClock();
+	long long int warmupEnd = config.warmup * 1000000LL;
+	connection->waiting = 0;
+	connection->state = RESPONSE_HEAD;
+	
+	if (succeeded == 0 && __atomic_fetch_add(&reportedFailures, 1, __ATOMIC_RELAXED) < __MAX_REPORTED_FAILURES)
+	{
+		fprintf(stderr, "%s failed: %s\n", operationName[connection->operation], message);
+	}
+	
+	if (connection->scheduled < warmupEnd)
+	{
+		worker->warmupCompleted++;
+		connection->rowsReturned = 0;
+		return;
+	}
+	
+	OperationStats *stats = &worker->operation[connection->operation];
+	unsigned long long int latency = now > connection->scheduled ? now - connection->scheduled : 0;
+	stats->completed++;
+	stats->failed += succeeded == 1 ? 0 : 1;
+	stats->rowsReturned += connection->rowsReturned;
+	stats->latencySum += latency;
+	stats->latency[latencyBucket(latency)]++;
+	if (latency > stats->latencyMax)
+	{
+		stats->latencyMax = latency;
+	}
+	connection->rowsReturned = 0;
+	
+	long long int second = (now - warmupEnd) / 1000000LL;
+	if (second < config.duration)
+	{
+		worker->timeline[second]++;
+	}
+	worker->lastCompletion = now;
+}
+
+void updateConnectionEvents(int epollFileDescriptor, BenchmarkConnection *connection)
+{
+	struct epoll_event event;
+	event.events = EPOLLIN | (connection->sending == 1 ? EPOLLOUT : 0);
+	event.data.ptr = connection;
+	epoll_ctl(epollFileDescriptor, EPOLL_CTL_MOD, connection->fileDescriptor, &event);
+}
+
+int sendPendingFrame(int epollFileDescriptor, BenchmarkConnection *connection)
+{
+	int wasSending = connection->sending;
+	while (connection->sendOffset < __DATA_BUFFER)
+	{
+		ssize_t sent = send(
+			connection->fileDescriptor, connection->sendFrame + connection->sendOffset,
+			__DATA_BUFFER - connection->sendOffset, MSG_DONTWAIT | MSG_NOSIGNAL
+		);
+		if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+		{
+			break;
+		}
+		if (sent <= 0)
+		{
+			return 0;
+		}
+		connection->sendOffset += sent;
+	}
+	
+	connection->sending = connection->sendOffset < __DATA_BUFFER;
+	if (connection->sending != wasSending)
+	{
+		updateConnectionEvents(epollFileDescriptor, connection);
+	}
+	return 1;
+}
+
+int receivePendingFrames(BenchmarkWorker *worker, BenchmarkConnection *connection)
+{
+	while (1)
+	{
+		ssize_t received = recv(
+			connection->fileDescriptor, connection->receiveFrame + connection->receiveOffset,
+			__DATA_BUFFER - connection->receiveOffset, MSG_DONTWAIT
+		);
+		if (received == 0)
+		{
+			return 0;
+		}
+		if (received < 0)
+		{
+			return errno == EAGAIN || errno == EWOULDBLOCK;
+		}
+		
+		connection->receiveOffset += received;
+		if (connection->receiveOffset == __DATA_BUFFER)
+		{
+			connection->receiveOffset = 0;
+			ResponseResult result = handleResponseFrame(connection, connection->receiveFrame);
+			if (result != RESPONSE_PENDING && connection->waiting == 1)
+			{
+				completeOperation(worker, connection, result == RESPONSE_SUCCEEDED, connection->receiveFrame + 1);
+			}
+		}
+	}
+}
+
+void closeBenchmarkConnection(BenchmarkWorker *worker, int epollFileDescriptor, BenchmarkConnection *connection)
+{
+	epoll_ctl(epollFileDescriptor, EPOLL_CTL_DEL, connection->fileDescriptor, NULL);
+	close(connection->fileDescriptor);
+	connection->fileDescriptor = -1;
+	if (connection->waiting == 1)
+	{
+		worker->unfinished++;
+		connection->waiting = 0;
+	}
+	worker->disconnected++;
+}
+
+void armBenchmarkTimer(int timerFileDescriptor, long long int at)
+{
+	struct itimerspec timer;
+	memset(&timer, 0, sizeof(timer));
+	long long int nanoseconds = benchmarkStart.tv_nsec + (at % 1000000LL) * 1000LL;
+	timer.it_value.tv_sec = benchmarkStart.tv_sec + at / 1000000LL + nanoseconds / 1000000000LL;
+	timer.it_value.tv_nsec = nanoseconds % 1000000000LL;
+	timerfd_settime(timerFileDescriptor, TFD_TIMER_ABSTIME, &timer, NULL);
+}
+
+void *runBenchmarkWorker(void *argument)
+{
+	BenchmarkWorker *worker = argument;
+	int epollFileDescriptor = epoll_create1(0);
+	int timerFileDescriptor = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK);
+	struct epoll_event event;
+	struct epoll_event events[64];
+	
+	event.events = EPOLLIN;
+	event.data.ptr = NULL;
+	epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, timerFileDescriptor, &event);
+	for (int i = 0; i < worker->connectionAmount; i++)
+	{
+		event.events = EPOLLIN;
+		event.data.ptr = &worker->connection[i];
+		epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, worker->connection[i].fileDescriptor, &event);
+	}
+	
+	long long int endTime = (config.warmup + config.duration) * 1000000LL;
+	long long int drainTime = endTime + __BENCHMARK_DRAIN_MSEC * 1000LL;
+	
+	while (1)
+	{
+		long long int now = benchmarkClock();
+		long long int nextWake = -1;
+		int active = 0;
+		
+		for (int i = 0; i < worker->connectionAmount; i++)
+		{
+			BenchmarkConnection *connection = &worker->connection[i];
+			if (connection->fileDescriptor == -1)
+			{
+				continue;
+			}
+			
+			if (connection->waiting == 0 && now < endTime)
+			{
+				long long int scheduled = 0;
+				if (config.rate > 0)
+				{
+					scheduled = (long long int)((connection->index + connection->issued * (double)config.connections) * 1000000.0 / config.rate);
+				}
+				if (scheduled > now)
+				{
+					nextWake = nextWake == -1 || scheduled < nextWake ? scheduled : nextWake;
+					continue;
+				}
+				
+				if (scheduled >= endTime)
+				{
+					continue;
+				}
+				
+				buildStatement(connection);
+				connection->scheduled = config.rate > 0 ? scheduled : now;
+				connection->issued++;
+				connection->sendOffset = 0;
+				connection->waiting = 1;
+				if (sendPendingFrame(epollFileDescriptor, connection) == 0)
+				{
+					closeBenchmarkConnection(worker, epollFileDescriptor, connection);
+					continue;
+				}
+			}
+			active += connection->waiting;
+		}
+		
+		if ((now >= endTime && active == 0) || now >= drainTime || worker->disconnected == worker->connectionAmount)
+		{
+			break;
+		}
+		
+		if (nextWake != -1)
+		{
+			armBenchmarkTimer(timerFileDescriptor, nextWake);
+		}
+		int timeout = now < endTime ? (endTime - now) / 1000 + 1 : (drainTime - now) / 1000 + 1;
+		int eventAmount = epoll_wait(epollFileDescriptor, events, 64, timeout);
+		for (int i = 0; i < eventAmount; i++)
+		{
+			BenchmarkConnection *connection = events[i].data.ptr;
+			if (connection == NULL)
+			{
+				unsigned long long int expirations;
+				ssize_t readSize = read(timerFileDescriptor, &expirations, sizeof(expirations));
+				(void)readSize;
+				continue;
+			}
+			if (connection->fileDescriptor == -1)
+			{
+				continue;
+			}
+			
+			if ((events[i].events & EPOLLOUT) && sendPendingFrame(epollFileDescriptor, connection) == 0)
+			{
+				closeBenchmarkConnection(worker, epollFileDescriptor, connection);
+				continue;
+			}
+			if ((events[i].events & (EPOLLIN | EPOLLHUP | EPOLLERR)) && receivePendingFrames(worker, connection) == 0)
+			{
+				closeBenchmarkConnection(worker, epollFileDescriptor, connection);
+			}
+		}
+	}
+	
+	for (int i = 0; i < worker->connectionAmount; i++)
+	{
+		if (worker->connection[i].fileDescriptor != -1)
+		{
+			worker->unfinished += worker->connection[i].waiting;
+			close(worker->connection[i].fileDescriptor);
+		}
+	}
+	close(timerFileDescriptor);
+	close(epollFileDescriptor);
+	return NULL;
+}
+
+void writeOperationJson(FILE *output, const char *name, OperationStats *stats, double elapsed, int last)
+{
+	fprintf(
+		output,
+		"    \"%s\": {\"completed\": %llu, \"failed\": %llu, \"rowsReturned\": %llu, \"throughput\": %.1f, "
+		"\"latencyMicroseconds\": {\"mean\": %.1f, \"p50\": %llu, \"p90\": %llu, \"p95\": %llu, "
+		"\"p99\": %llu, \"p999\": %llu, \"max\": %llu}}%s\n",
+		name, stats->completed, stats->failed, stats->rowsReturned, elapsed > 0 ? stats->completed / elapsed : 0.0,
+		stats->completed > 0 ? (double)stats->latencySum / stats->completed : 0.0,
+		latencyPercentile(stats, 0.5), latencyPercentile(stats, 0.9), latencyPercentile(stats, 0.95),
+		latencyPercentile(stats, 0.99), latencyPercentile(stats, 0.999), stats->latencyMax, last == 1 ? "" : ","
+	);
+}
+
+void writeJsonString(FILE *output, const char *value)
+{
+	fputc('"', output);
+	for (; *value != '\0'; value++)
+	{
+		if (*value == '"' || *value == '\\')
+		{
+			fputc('\\', output);
+		}
+		fputc(*value, output);
+	}
+	fputc('"', output);
+}
+
+void writeBenchmarkReport(
+	FILE *output, BenchmarkWorker worker[], time_t startedAt, double loadSeconds, double elapsed
+)
+{
+	OperationStats operation[OPERATION_AMOUNT];
+	OperationStats total;
+	unsigned long long int warmupCompleted = 0;
+	unsigned long long int unfinished = 0;
+	int disconnected = 0;
+	
+	memset(operation, 0, sizeof(operation));
+	memset(&total, 0, sizeof(total));
+	for (int i = 0; i < config.threads; i++)
+	{
+		for (int type = 0; type < OPERATION_AMOUNT; type++)
+		{
+			mergeOperationStats(&operation[type], &worker[i].operation[type]);
+			mergeOperationStats(&total, &worker[i].operation[type]);
+		}
+		warmupCompleted += worker[i].warmupCompleted;
+		unfinished += worker[i].unfinished;
+		disconnected += worker[i].disconnected;
+	}
+	
+	char started[32];
+	struct tm startedTime;
+	gmtime_r(&startedAt, &startedTime);
+	strftime(started, sizeof(started), "%Y-%m-%dT%H:%M:%SZ", &startedTime);
+	
+	fprintf(output, "{\n  \"started\": \"%s\",\n  \"config\": {\n    \"database\": ", started);
+	writeJsonString(output, config.database);
+	fprintf(
+		output,
+		",\n    \"connections\": %d,\n    \"threads\": %d,\n    \"targetRate\": %.1f,\n    \"duration\": %d,\n"
+		"    \"warmup\": %d,\n    \"tables\": %d,\n    \"columns\": %d,\n    \"stringSize\": %d,\n"
+		"    \"rows\": %lld,\n    \"index\": %s,\n    \"setup\": %s,\n    \"seed\": %llu,\n    \"mix\": {",
+		config.connections, config.threads, config.rate, config.duration, config.warmup, config.tables,
+		config.columns, config.stringSize, config.rows, config.index == 1 ? "true" : "false",
+		config.setup == 1 ? "true" : "false", config.seed
+	);
+	for (int type = 0; type < OPERATION_AMOUNT; type++)
+	{
+		fprintf(output, "%s\"%s\": %d", type > 0 ? ", " : "", operationName[type], config.weight[type]);
+	}
+	fprintf(output, "}\n  },\n");
+	
+	if (config.setup == 1)
+	{
+		long long int loadedRows = config.rows * config.tables;
+		fprintf(
+			output, "  \"load\": {\"rows\": %lld, \"seconds\": %.3f, \"rowsPerSecond\": %.1f},\n",
+			loadedRows, loadSeconds, loadSeconds > 0 ? loadedRows / loadSeconds : 0.0
+		);
+	}
+	
+	fprintf(
+		output, "  \"elapsed\": %.3f,\n  \"warmupCompleted\": %llu,\n  \"unfinished\": %llu,\n  \"disconnected\": %d,\n",
+		elapsed, warmupCompleted, unfinished, disconnected
+	);
+	fprintf(output, "  \"total\": {\n");
+	writeOperationJson(output, "all", &total, elapsed, 1);
+	fprintf(output, "  },\n  \"operations\": {\n");
+	int lastType = -1;
+	for (int type = 0; type < OPERATION_AMOUNT; type++)
+	{
+		lastType = config.weight[type] > 0 ? type : lastType;
+	}
+	for (int type = 0; type < OPERATION_AMOUNT; type++)
+	{
+		if (config.weight[type] > 0)
+		{
+			writeOperationJson(output, operationName[type], &operation[type], elapsed, type == lastType);
+		}
+	}
+	fprintf(output, "  },\n  \"timeline\": [");
+	for (int second = 0; second < config.duration; second++)
+	{
+		unsigned long long int completed = 0;
+		for (int i = 0; i < config.threads; i++)
+		{
+			completed += worker[i].timeline[second];
+		}
+		fprintf(output, "%s%llu", second > 0 ? ", " : "", completed);
+	}
+	fprintf(output, "]\n}\n");
+	
+	fprintf(
+		stderr, "%llu statement(s) in %.3f s (%.0f statement/s), %llu failed, p50 %llu us, p99 %llu us, max %llu us\n",
+		total.completed, elapsed, elapsed > 0 ? total.completed / elapsed : 0.0, total.failed,
+		latencyPercentile(&total, 0.5), latencyPercentile(&total, 0.99), total.latencyMax
+	);
+}
+
+int parseOperationMix(char mix[])
+{
+	char *savePointer = NULL;
+	memset(config.weight, 0, sizeof(config.weight));
+	config.weightTotal = 0;
+	
+	for (char *token = strtok_r(mix, ",", &savePointer); token != NULL; token = strtok_r(NULL, ",", &savePointer))
+	{
+		char *separator = strchr(token, ':');
+		if (separator == NULL)
+		{
+			fprintf(stderr, "Error, mix entry '%s' must be 'operation:weight'\n", token);
+			return 0;
+		}
+		*separator = '\0';
+		
+		int type = 0;
+		while (type < OPERATION_AMOUNT && strcmp(token, operationName[type]) != 0)
+		{
+			type++;
+		}
+		if (type == OPERATION_AMOUNT || atoi(separator + 1) < 0)
+		{
+			fprintf(stderr, "Error, unknown mix entry '%s'\n", token);
+			return 0;
+		}
+		config.weight[type] = atoi(separator + 1);
+	}
+	
+	for (int type = 0; type < OPERATION_AMOUNT; type++)
+	{
+		config.weightTotal += config.weight[type];
+	}
+	if (config.weightTotal == 0)
+	{
+		fprintf(stderr, "Error, operation mix has no weight\n");
+		return 0;
+	}
+	return 1;
+}
+
+int parseBenchmarkOptions(int argc, char **argv)
+{
+	char defaultMix[] = "insert:20,select:60,update:15,delete:5";
+	char *mix = defaultMix;
+	
+	config.database = "benchmark";
+	config.connections = 16;
+	config.threads = 4;
+	config.rate = 0;
+	config.duration = 10;
+	config.warmup = 2;
+	config.tables = 1;
+	config.columns = 4;
+	config.stringSize = 16;
+	config.rows = 10000;
+	config.index = 1;
+	config.setup = 1;
+	config.seed = 1;
+	
+	int i = 1;
+	if (getuid() != __ROOT_ID)
+	{
+		config.username = argv[2];
+		config.password = argv[4];
+		i = 5;
+	}
+	for (; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-c") == 0 && i + 1 < argc)
+		{
+			config.connections = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+		{
+			config.threads = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-r") == 0 && i + 1 < argc)
+		{
+			config.rate = atof(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+		{
+			config.duration = atoi(argv[++i]);
+		}
+		else if (strcmp(argv[i], "-w") == 0 && i + 1 < argc)
+		{
+			config.warmup = atoi(argv[++i]);
+		}
+		else if (strncmp(argv[i], "--database=", 11) == 0)
+		{
+			config.database = argv[i] + 11;
+		}
+		else if (strncmp(argv[i], "--mix=", 6) == 0)
+		{
+			mix = argv[i] + 6;
+		}
+		else if (strncmp(argv[i], "--tables=", 9) == 0)
+		{
+			config.tables = atoi(argv[i] + 9);
+		}
+		else if (strncmp(argv[i], "--columns=", 10) == 0)
+		{
+			config.columns = atoi(argv[i] + 10);
+		}
+		else if (strncmp(argv[i], "--string-size=", 14) == 0)
+		{
+			config.stringSize = atoi(argv[i] + 14);
+		}
+		else if (strncmp(argv[i], "--rows=", 7) == 0)
+		{
+			config.rows = atoll(argv[i] + 7);
+		}
+		else if (strncmp(argv[i], "--seed=", 7) == 0)
+		{
+			config.seed = strtoull(argv[i] + 7, NULL, 10);
+		}
+		else if (strncmp(argv[i], "--output=", 9) == 0)
+		{
+			config.outputPath = argv[i] + 9;
+		}
+		else if (strcmp(argv[i], "--no-index") == 0)
+		{
+			config.index = 0;
+		}
+		else if (strcmp(argv[i], "--no-setup") == 0)
+		{
+			config.setup = 0;
+		}
+		else
+		{
+			fprintf(stderr, "Error, unknown option '%s'\n", argv[i]);
+			return 0;
+		}
+	}
+	
+	if (parseOperationMix(mix) == 0)
+	{
+		return 0;
+	}
+	if (config.connections < 1 || config.connections > __BENCHMARK_MAX_CONNECTIONS)
+	{
+		fprintf(stderr, "Error, connections must be between 1 and %d\n", __BENCHMARK_MAX_CONNECTIONS);
+		return 0;
+	}
+	if (config.threads < 1 || config.threads > __BENCHMARK_MAX_THREADS)
+	{
+		fprintf(stderr, "Error, threads must be between 1 and %d\n", __BENCHMARK_MAX_THREADS);
+		return 0;
+	}
+	if (config.threads > config.connections)
+	{
+		config.threads = config.connections;
+	}
+	if (config.tables < 1 || config.tables > __BENCHMARK_MAX_TABLES)
+	{
+		fprintf(stderr, "Error, tables must be between 1 and %d\n", __BENCHMARK_MAX_TABLES);
+		return 0;
+	}
+	if (config.columns < 1 || config.columns > __BENCHMARK_MAX_COLUMNS)
+	{
+		fprintf(stderr, "Error, columns must be between 1 and %d\n", __BENCHMARK_MAX_COLUMNS);
+		return 0;
+	}
+	if (config.stringSize < 1 || rowStatementLength() * 2 > __DATA_BUFFER)
+	{
+		fprintf(stderr, "Error, a generated row must fit in half of a %d byte statement\n", __DATA_BUFFER);
+		return 0;
+	}
+	if (config.duration < 1 || config.warmup < 0 || config.rate < 0 || config.rows < 0)
+	{
+		fprintf(stderr, "Error, duration must be positive and warmup, rate and rows must not be negative\n");
+		return 0;
+	}
+	return 1;
+}
+
+int main(int argc, char **argv)
+{
+	if (getuid() != __ROOT_ID && (argc < 5 || strcmp(argv[1], "-u") != 0 || strcmp(argv[3], "-p") != 0))
+	{
+		fprintf(
+			stderr,
+			"Error, login command '-u [username] -p [password] [-c connections] [-j threads] [-r rate] [-t seconds] "
+			"[-w warmup seconds] [--database=name] [--mix=insert:20,select:60,update:15,delete:5] [--tables=n] "
+			"[--columns=n] [--string-size=n] [--rows=n] [--seed=n] [--no-index] [--no-setup] [--output=file]'\n"
+		);
+		exit(EXIT_FAILURE);
+	}
+	if (parseBenchmarkOptions(argc, argv) == 0)
+	{
+		exit(EXIT_FAILURE);
+	}
+	config.seed = config.seed != 0 ? config.seed : 1;
+	
+	double loadSeconds = 0;
+	if (config.setup == 1)
+	{
+		fprintf(stderr, "Loading %lld row(s) into %d table(s) of %s\n", config.rows, config.tables, config.database);
+		if (setupBenchmarkSchema(&loadSeconds) == 0)
+		{
+			exit(EXIT_FAILURE);
+		}
+	}
+	else
+	{
+		for (int table = 0; table < config.tables; table++)
+		{
+			nextRowId[table] = config.rows;
+		}
+	}
+	
+	BenchmarkWorker *worker = calloc(config.threads, sizeof(BenchmarkWorker));
+	BenchmarkConnection *connection = calloc(config.connections, sizeof(BenchmarkConnection));
+	for (int i = 0; i < config.connections; i++)
+	{
+		connection[i].fileDescriptor = openBenchmarkConnection();
+		if (connection[i].fileDescriptor == -1)
+		{
+			fprintf(stderr, "Opening connection %d failed\n", i + 1);
+			exit(EXIT_FAILURE);
+		}
+		connection[i].index = i;
+		connection[i].random = config.seed ^ ((i + 1) * 0x9E3779B97F4A7C15ULL);
+		connection[i].state = RESPONSE_HEAD;
+	}
+	
+	int offset = 0;
+	for (int i = 0; i < config.threads; i++)
+	{
+		worker[i].connection = connection + offset;
+		worker[i].connectionAmount = config.connections / config.threads + (i < config.connections % config.threads);
+		worker[i].timeline = calloc(config.duration, sizeof(unsigned long long int));
+		offset += worker[i].connectionAmount;
+	}
+	
+	fprintf(
+		stderr, "Running %d connection(s) on %d thread(s) for %d s after %d s warmup\n",
+		config.connections, config.threads, config.duration, config.warmup
+	);
+	time_t startedAt = time(NULL);
+	clock_gettime(CLOCK_MONOTONIC, &benchmarkStart);
+	for (int i = 0; i < config.threads; i++)
+	{
+		pthread_create(&worker[i].thread, NULL, runBenchmarkWorker, &worker[i]);
+	}
+	
+	long long int lastCompletion = 0;
+	int disconnected = 0;
+	for (int i = 0; i < config.threads; i++)
+	{
+		pthread_join(worker[i].thread, NULL);
+		lastCompletion = worker[i].lastCompletion > lastCompletion ? worker[i].lastCompletion : lastCompletion;
+		disconnected += worker[i].disconnected;
+	}
+	
+	long long int endTime = (config.warmup + config.duration) * 1000000LL;
+	double elapsed = ((lastCompletion > endTime ? lastCompletion : endTime) - config.warmup * 1000000LL) / 1000000.0;
+	
+	FILE *output = stdout;
+	if (config.outputPath != NULL)
+	{
+		output = fopen(config.outputPath, "w");
+		if (output == NULL)
+		{
+			fprintf(stderr, "Error: [%s]\n", strerror(errno));
+			exit(EXIT_FAILURE);
+		}
+	}
+	writeBenchmarkReport(output, worker, startedAt, loadSeconds, elapsed);
+	if (output != stdout)
+	{
+		fclose(output);
+	}
+	
+	for (int i = 0; i < config.threads; i++)
+	{
+		free(worker[i].timeline);
+	}
+	free(connection);
+	free(worker);
+	return disconnected == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -6,6 +6,7 @@
 #include "unistd.h"
 #include "netdb.h"
 #include "netinet/in.h"
+#include "poll.h"
 #include "sys/time.h"
 
 #ifndef __DATA_BUFFER
@@ -26,6 +27,98 @@
 	#error __ROOT_ID already defined
 #endif
 
+#ifndef __PIPELINE_DEPTH
+	#define __PIPELINE_DEPTH 64
+#else
+	#error __PIPELINE_DEPTH already defined
+#endif
+
+#ifndef __MAX_REPORTED_FAILURES
+	#define __MAX_REPORTED_FAILURES 20
+#else
+	#error __MAX_REPORTED_FAILURES already defined
+#endif
+
+#ifndef __OUTPUT_BUFFER
+	#define __OUTPUT_BUFFER 1048576
+#else
+	#error __OUTPUT_BUFFER already defined
+#endif
+
+#ifndef __RECEIVE_FRAMES
+	#define __RECEIVE_FRAMES 64
+#else
+	#error __RECEIVE_FRAMES already defined
+#endif
+
+typedef enum {
+	FORMAT_TABLE,
+	FORMAT_CSV,
+	FORMAT_TSV,
+	FORMAT_RAW
+} OutputFormat;
+
+typedef struct {
+	OutputFormat format;
+	char *buffer;
+	size_t size;
+	char *value;
+	size_t valueSize;
+	size_t valueCapacity;
+	int column;
+	int columnTotal;
+} OutputWriter;
+
+typedef struct {
+	char buffer[__DATA_BUFFER * __RECEIVE_FRAMES];
+	size_t size;
+	size_t offset;
+} FrameReader;
+
+typedef enum {
+	RESPONSE_HEAD,
+	RESPONSE_ATTRIBUTE_COUNT,
+	RESPONSE_ATTRIBUTE_NAME,
+	RESPONSE_RECORD_COUNT,
+	RESPONSE_BODY,
+	RESPONSE_DUMP
+} ResponseState;
+
+typedef struct PendingStatement {
+	char *statement;
+	int line;
+	struct PendingStatement *next;
+} PendingStatement;
+
+typedef struct {
+	FILE *script;
+	FILE *log;
+	char *username;
+	int line;
+	int finished;
+	
+	PendingStatement *head;
+	PendingStatement *tail;
+	int inFlight;
+	int depth;
+	
+	char sendFrame[__DATA_BUFFER];
+	size_t sendOffset;
+	int sending;
+	
+	char receiveFrame[__DATA_BUFFER];
+	size_t receiveOffset;
+	long long int skipBytes;
+	ResponseState state;
+	int remainingAttribute;
+	
+	OutputWriter *output;
+	
+	long long int executed;
+	long long int failed;
+	long long int rejected;
+} ScriptRunner;
+
 int establishedConnection() 
 {
 	struct sockaddr_in socketAddress;
@@ -64,9 +157,242 @@ void constructLoginMessage(char message[], char username[], char password[])
 	sprintf(&message[1 + 2 * integerSize], "%s%s", username, password);
 }
 
-void writeLog(char username[], char message[])
+void initOutputWriter(OutputWriter *writer, OutputFormat format)
+{
+	memset(writer, 0, sizeof(OutputWriter));
+	writer->format = format;
+	writer->buffer = malloc(__OUTPUT_BUFFER);
+	writer->valueCapacity = __DATA_BUFFER;
+	writer->value = malloc(writer->valueCapacity);
+}
+
+void flushOutputWriter(OutputWriter *writer)
+{
+	if (writer->size > 0)
+	{
+		fwrite(writer->buffer, 1, writer->size, stdout);
+		writer->size = 0;
+	}
+	fflush(stdout);
+}
+
+void delOutputWriter(OutputWriter *writer)
+{
+	flushOutputWriter(writer);
+	free(writer->buffer);
+	free(writer->value);
+}
+
+void writeOutputBytes(OutputWriter *writer, const char *data, size_t size)
+{
+	if (writer->size + size > __OUTPUT_BUFFER)
+	{
+		fwrite(writer->buffer, 1, writer->size, stdout);
+		writer->size = 0;
+	}
+	if (size > __OUTPUT_BUFFER)
+	{
+		fwrite(data, 1, size, stdout);
+		return;
+	}
+	memcpy(writer->buffer + writer->size, data, size);
+	writer->size += size;
+}
+
+void appendOutputValue(OutputWriter *writer, const char *data, size_t size)
+{
+	if (writer->valueSize + size > writer->valueCapacity)
+	{
+		while (writer->valueSize + size > writer->valueCapacity)
+		{
+			writer->valueCapacity *= 2;
+		}
+		writer->value = realloc(writer->value, writer->valueCapacity);
+	}
+	memcpy(writer->value + writer->valueSize, data, size);
+	writer->valueSize += size;
+}
+
+void writeEscapedValue(OutputWriter *writer, const char *value, size_t size)
+{
+	if (writer->format == FORMAT_CSV)
+	{
+		int quoted = 0;
+		for (size_t i = 0; i < size && quoted == 0; i++)
+		{
+			quoted = value[i] == ',' || value[i] == '"' || value[i] == '\n' || value[i] == '\r';
+		}
+		if (quoted == 0)
+		{
+			writeOutputBytes(writer, value, size);
+			return;
+		}
+		
+		writeOutputBytes(writer, "\"", 1);
+		size_t start = 0;
+		for (size_t i = 0; i < size; i++)
+		{
+			if (value[i] == '"')
+			{
+				writeOutputBytes(writer, value + start, i - start + 1);
+				writeOutputBytes(writer, "\"", 1);
+				start = i + 1;
+			}
+		}
+		writeOutputBytes(writer, value + start, size - start);
+		writeOutputBytes(writer, "\"", 1);
+	}
+	else if (writer->format == FORMAT_TSV)
+	{
+		size_t start = 0;
+		for (size_t i = 0; i < size; i++)
+		{
+			const char *escape = NULL;
+			if (value[i] == '\t')
+			{
+				escape = "\\t";
+			}
+			else if (value[i] == '\n')
+			{
+				escape = "\\n";
+			}
+			else if (value[i] == '\r')
+			{
+				escape = "\\r";
+			}
+			else if (value[i] == '\\')
+			{
+				escape = "\\\\";
+			}
+			
+			if (escape != NULL)
+			{
+				writeOutputBytes(writer, value + start, i - start);
+				writeOutputBytes(writer, escape, 2);
+				start = i + 1;
+			}
+		}
+		writeOutputBytes(writer, value + start, size - start);
+	}
+	else
+	{
+		writeOutputBytes(writer, value, size);
+	}
+}
+
+void writeTableSeparator(OutputWriter *writer)
+{
+	writeOutputBytes(writer, "|", 1);
+	for (int i = 0; i < writer->columnTotal; i++)
+	{
+		writeOutputBytes(writer, "----------|", 11);
+	}
+	writeOutputBytes(writer, "\n", 1);
+}
+
+void endOutputField(OutputWriter *writer)
+{
+	if (writer->format == FORMAT_TABLE)
+	{
+		char cell[16];
+		int length = snprintf(
+			cell, sizeof(cell), "%s%10.*s|", writer->column == 0 ? "|" : "", 
+			(int)(writer->valueSize < 10 ? writer->valueSize : 10), writer->value
+		);
+		writeOutputBytes(writer, cell, length);
+	}
+	else
+	{
+		if (writer->column > 0)
+		{
+			writeOutputBytes(writer, writer->format == FORMAT_CSV ? "," : "\t", 1);
+		}
+		writeEscapedValue(writer, writer->value, writer->valueSize);
+	}
+	writer->valueSize = 0;
+	writer->column++;
+}
+
+void endOutputRecord(OutputWriter *writer)
+{
+	writeOutputBytes(writer, "\n", 1);
+	writer->column = 0;
+}
+
+void writeOutputFrame(OutputWriter *writer, char frame[])
+{
+	if (frame[0] == 'V')
+	{
+		appendOutputValue(writer, frame + 1, strnlen(frame + 1, __DATA_BUFFER - 1));
+	}
+	else if (frame[0] == 'C')
+	{
+		endOutputField(writer);
+	}
+	else if (frame[0] == 'R')
+	{
+		endOutputRecord(writer);
+	}
+}
+
+void writeOutputHeaderName(OutputWriter *writer, char frame[])
+{
+	if (writer->format != FORMAT_RAW)
+	{
+		appendOutputValue(writer, frame, strnlen(frame, __DATA_BUFFER));
+		endOutputField(writer);
+	}
+}
+
+void endOutputHeader(OutputWriter *writer)
+{
+	writer->columnTotal = writer->column;
+	if (writer->format != FORMAT_RAW)
+	{
+		endOutputRecord(writer);
+	}
+	if (writer->format == FORMAT_TABLE)
+	{
+		writeTableSeparator(writer);
+	}
+}
+
+void endOutputResult(OutputWriter *writer)
+{
+	if (writer->format == FORMAT_TABLE)
+	{
+		writeTableSeparator(writer);
+	}
+}
+
+int receiveFrame(FrameReader *reader, int socketFileDescriptor, char frame[])
+{
+	if (reader->size - reader->offset < __DATA_BUFFER)
+	{
+		memmove(reader->buffer, reader->buffer + reader->offset, reader->size - reader->offset);
+		reader->size -= reader->offset;
+		reader->offset = 0;
+		
+		while (reader->size < __DATA_BUFFER)
+		{
+			ssize_t received = recv(
+				socketFileDescriptor, reader->buffer + reader->size, sizeof(reader->buffer) - reader->size, 0
+			);
+			if (received <= 0)
+			{
+				return 0;
+			}
+			reader->size += received;
+		}
+	}
+	
+	memcpy(frame, reader->buffer + reader->offset, __DATA_BUFFER);
+	reader->offset += __DATA_BUFFER;
+	return 1;
+}
+
+void writeLogLine(FILE *fileWriterLog, char username[], char message[])
 {
-	FILE *fileWriterLog = fopen("./client.log", "a+");
 	time_t currentTime = time(NULL);
 	struct tm currentLocalTime = *localtime(&currentTime);
 	char logText[4096];
@@ -83,17 +409,416 @@ void writeLog(char username[], char message[])
 	);
 
 	fprintf(fileWriterLog, "%s\n", logText);
+}
+
+int endScriptStatement(ScriptRunner *runner, char statement[], int length, int *statementLine)
+{
+	while (length > 0 && length < __DATA_BUFFER && (statement[length - 1] == ' ' || statement[length - 1] == '\t'))
+	{
+		length--;
+	}
+	if (length == 0)
+	{
+		return 0;
+	}
+	if (length >= __DATA_BUFFER - 1)
+	{
+		*statementLine = runner->line;
+		return -1;
+	}
+	statement[length] = '\0';
+	return 1;
+}
+
+int readScriptStatement(ScriptRunner *runner, char statement[], int *statementLine)
+{
+	int length = 0;
+	int quotation = 0;
+	int comment = 0;
+	int character;
+	*statementLine = 0;
 	
-	fclose(fileWriterLog);
+	while ((character = fgetc(runner->script)) != EOF)
+	{
+		if (character == '\n')
+		{
+			runner->line++;
+			comment = 0;
+		}
+		if (comment == 1)
+		{
+			continue;
+		}
+		if (quotation == 0 && character == '-' && length > 0 && statement[length - 1] == '-')
+		{
+			length--;
+			comment = 1;
+			continue;
+		}
+		if (character == '\'')
+		{
+			quotation = quotation == 1 ? 0 : 1;
+		}
+		if (character == ';' && quotation == 0)
+		{
+			int result = endScriptStatement(runner, statement, length, statementLine);
+			if (result != 0)
+			{
+				return result;
+			}
+			length = 0;
+			continue;
+		}
+		
+		if (character == '\n' || character == '\r' || character == '\t')
+		{
+			character = ' ';
+		}
+		if (length == 0 && character == ' ')
+		{
+			continue;
+		}
+		if (length == 0)
+		{
+			*statementLine = runner->line;
+		}
+		if (length < __DATA_BUFFER - 1)
+		{
+			statement[length] = character;
+		}
+		length++;
+	}
+	return endScriptStatement(runner, statement, length, statementLine);
+}
+
+void prepareNextStatement(ScriptRunner *runner)
+{
+	char statement[__DATA_BUFFER];
+	int statementLine = 0;
+	int result;
+	
+	while ((result = readScriptStatement(runner, statement, &statementLine)) == -1)
+	{
+		runner->rejected++;
+		fprintf(stderr, "line %d: statement longer than %d bytes, skipped\n", statementLine, __DATA_BUFFER - 2);
+	}
+	
+	if (result == 0)
+	{
+		runner->finished = 1;
+		return;
+	}
+	
+	size_t length = strlen(statement);
+	memset(runner->sendFrame, 0, sizeof(runner->sendFrame));
+	memcpy(runner->sendFrame, statement, length);
+	runner->sendFrame[length] = ';';
+	runner->sendOffset = 0;
+	runner->sending = 1;
+	
+	PendingStatement *pending = malloc(sizeof(PendingStatement));
+	pending->statement = strdup(statement);
+	pending->line = statementLine;
+	pending->next = NULL;
+	if (runner->tail != NULL)
+	{
+		runner->tail->next = pending;
+	}
+	else
+	{
+		runner->head = pending;
+	}
+	runner->tail = pending;
+	runner->inFlight++;
+}
+
+void completeStatement(ScriptRunner *runner, int success, char message[])
+{
+	PendingStatement *pending = runner->head;
+	if (pending == NULL)
+	{
+		return;
+	}
+	runner->head = pending->next;
+	if (runner->head == NULL)
+	{
+		runner->tail = NULL;
+	}
+	runner->inFlight--;
+	runner->executed++;
+	
+	if (success == 1)
+	{
+		writeLogLine(runner->log, runner->username, pending->statement);
+	}
+	else
+	{
+		runner->failed++;
+		if (runner->failed <= __MAX_REPORTED_FAILURES)
+		{
+			fprintf(stderr, "line %d: %s -> %s\n", pending->line, pending->statement, message);
+		}
+	}
+	
+	free(pending->statement);
+	free(pending);
+	runner->state = RESPONSE_HEAD;
+}
+
+void handleResponseFrame(ScriptRunner *runner, char frame[])
+{
+	int value = 0;
+	if (runner->state == RESPONSE_HEAD)
+	{
+		if (frame[0] == 'M')
+		{
+			completeStatement(runner, frame[1] == 'B', frame + 1);
+		}
+		else if (frame[0] == 'Q')
+		{
+			runner->state = RESPONSE_ATTRIBUTE_COUNT;
+		}
+		else if (frame[0] == 'K')
+		{
+			memcpy(&runner->skipBytes, frame + 1, sizeof(runner->skipBytes));
+			runner->state = RESPONSE_DUMP;
+		}
+		else if (frame[0] == 'F')
+		{
+			completeStatement(runner, 1, frame);
+		}
+	}
+	else if (runner->state == RESPONSE_ATTRIBUTE_COUNT)
+	{
+		memcpy(&value, frame, sizeof(value));
+		runner->remainingAttribute = value;
+		runner->state = value > 0 ? RESPONSE_ATTRIBUTE_NAME : RESPONSE_RECORD_COUNT;
+	}
+	else if (runner->state == RESPONSE_ATTRIBUTE_NAME)
+	{
+		if (runner->output != NULL)
+		{
+			writeOutputHeaderName(runner->output, frame);
+		}
+		runner->remainingAttribute--;
+		if (runner->remainingAttribute == 0)
+		{
+			runner->state = RESPONSE_RECORD_COUNT;
+		}
+	}
+	else if (runner->state == RESPONSE_RECORD_COUNT)
+	{
+		if (runner->output != NULL)
+		{
+			endOutputHeader(runner->output);
+		}
+		runner->state = RESPONSE_BODY;
+	}
+	else if (frame[0] == 'F')
+	{
+		if (runner->state == RESPONSE_BODY && runner->output != NULL)
+		{
+			endOutputResult(runner->output);
+		}
+		completeStatement(runner, 1, frame);
+	}
+	else if (runner->state == RESPONSE_BODY && runner->output != NULL)
+	{
+		writeOutputFrame(runner->output, frame);
+	}
+	else if (runner->state == RESPONSE_DUMP && frame[0] == 'K')
+	{
+		memcpy(&runner->skipBytes, frame + 1, sizeof(runner->skipBytes));
+	}
+	else if (runner->state == RESPONSE_DUMP && frame[0] == 'M')
+	{
+		completeStatement(runner, 0, frame + 1);
+	}
+}
+
+int receiveScriptResponses(ScriptRunner *runner, int socketFileDescriptor)
+{
+	char discard[65536];
+	while (1)
+	{
+		ssize_t received;
+		if (runner->skipBytes > 0)
+		{
+			size_t size = runner->skipBytes < (long long int)sizeof(discard) ? (size_t)runner->skipBytes : sizeof(discard);
+			received = recv(socketFileDescriptor, discard, size, MSG_DONTWAIT);
+			if (received > 0)
+			{
+				runner->skipBytes -= received;
+			}
+		}
+		else
+		{
+			received = recv(
+				socketFileDescriptor, runner->receiveFrame + runner->receiveOffset, 
+				__DATA_BUFFER - runner->receiveOffset, MSG_DONTWAIT
+			);
+			if (received > 0)
+			{
+				runner->receiveOffset += received;
+				if (runner->receiveOffset == __DATA_BUFFER)
+				{
+					runner->receiveOffset = 0;
+					handleResponseFrame(runner, runner->receiveFrame);
+				}
+			}
+		}
+		
+		if (received == 0)
+		{
+			return 0;
+		}
+		if (received < 0)
+		{
+			return errno == EAGAIN || errno == EWOULDBLOCK;
+		}
+	}
+}
+
+int runScript(int socketFileDescriptor, char scriptPath[], int depth, char username[], OutputWriter *output)
+{
+	ScriptRunner runner;
+	memset(&runner, 0, sizeof(runner));
+	runner.script = fopen(scriptPath, "r");
+	if (runner.script == NULL)
+	{
+		fprintf(stderr, "Error: [%s]\n", strerror(errno));
+		return 0;
+	}
+	runner.log = fopen("./client.log", "a+");
+	runner.username = username;
+	runner.line = 1;
+	runner.depth = depth > 0 ? depth : 1;
+	runner.state = RESPONSE_HEAD;
+	runner.output = output;
+	
+	struct timeval startTime;
+	struct timeval endTime;
+	gettimeofday(&startTime, NULL);
+	
+	int connected = 1;
+	while (connected == 1 && (runner.finished == 0 || runner.inFlight > 0))
+	{
+		if (runner.sending == 0 && runner.finished == 0 && runner.inFlight < runner.depth)
+		{
+			prepareNextStatement(&runner);
+		}
+		
+		struct pollfd pollDescriptor;
+		pollDescriptor.fd = socketFileDescriptor;
+		pollDescriptor.events = POLLIN | (runner.sending == 1 ? POLLOUT : 0);
+		pollDescriptor.revents = 0;
+		if (runner.inFlight == 0 && runner.sending == 0)
+		{
+			continue;
+		}
+		if (poll(&pollDescriptor, 1, -1) < 0)
+		{
+			break;
+		}
+		
+		if (pollDescriptor.revents & POLLOUT)
+		{
+			ssize_t sent = send(
+				socketFileDescriptor, runner.sendFrame + runner.sendOffset, 
+				__DATA_BUFFER - runner.sendOffset, MSG_DONTWAIT | MSG_NOSIGNAL
+			);
+			if (sent > 0)
+			{
+				runner.sendOffset += sent;
+				runner.sending = runner.sendOffset < __DATA_BUFFER;
+			}
+			else if (sent < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
+			{
+				connected = 0;
+			}
+		}
+		if (pollDescriptor.revents & (POLLIN | POLLHUP | POLLERR))
+		{
+			connected = receiveScriptResponses(&runner, socketFileDescriptor);
+		}
+	}
+	
+	gettimeofday(&endTime, NULL);
+	double elapsed = (endTime.tv_sec - startTime.tv_sec) + (endTime.tv_usec - startTime.tv_usec) / 1000000.0;
+	
+	if (connected == 0)
+	{
+		fprintf(stderr, "Connection closed with %d statement(s) in flight\n", runner.inFlight);
+	}
+	if (output != NULL)
+	{
+		flushOutputWriter(output);
+	}
+	fprintf(
+		output != NULL && output->format != FORMAT_TABLE ? stderr : stdout, 
+		"Executed %lld statement(s) in %.3f s (%.0f statement/s), %lld failed, %lld skipped\n", 
+		runner.executed, elapsed, elapsed > 0 ? runner.executed / elapsed : 0.0, runner.failed, runner.rejected
+	);
+	
+	while (runner.head != NULL)
+	{
+		PendingStatement *next = runner.head->next;
+		free(runner.head->statement);
+		free(runner.head);
+		runner.head = next;
+	}
+	fclose(runner.log);
+	fclose(runner.script);
+	return connected == 1 && runner.failed == 0 && runner.rejected == 0;
 }
 
 int main(int argc, char** argv) 
 {
 	if (getuid() != __ROOT_ID && (argc < 5 || strcmp(argv[1], "-u") != 0 || strcmp(argv[3], "-p") != 0)) 
 	{
-		fprintf(stderr, "Error, login command '-u [username] -p [password]'\n");
+		fprintf(
+			stderr, 
+			"Error, login command '-u [username] -p [password] [-f script.sql] [-d pipeline depth] [--format=table|csv|tsv|raw]'\n"
+		);
 		exit(EXIT_FAILURE);
 	}
+	
+	char *scriptPath = NULL;
+	int pipelineDepth = __PIPELINE_DEPTH;
+	OutputFormat format = FORMAT_TABLE;
+	for (int i = 1; i < argc; i++)
+	{
+		if (strcmp(argv[i], "-f") == 0 && i + 1 < argc)
+		{
+			scriptPath = argv[++i];
+		}
+		else if (strcmp(argv[i], "-d") == 0 && i + 1 < argc)
+		{
+			pipelineDepth = atoi(argv[++i]);
+		}
+		else if (strncmp(argv[i], "--format=", 9) == 0)
+		{
+			if (strcmp(argv[i] + 9, "csv") == 0)
+			{
+				format = FORMAT_CSV;
+			}
+			else if (strcmp(argv[i] + 9, "tsv") == 0)
+			{
+				format = FORMAT_TSV;
+			}
+			else if (strcmp(argv[i] + 9, "raw") == 0)
+			{
+				format = FORMAT_RAW;
+			}
+			else if (strcmp(argv[i] + 9, "table") != 0)
+			{
+				fprintf(stderr, "Error, unknown output format '%s'\n", argv[i] + 9);
+				exit(EXIT_FAILURE);
+			}
+		}
+	}
+	FILE *statusOutput = format == FORMAT_TABLE ? stdout : stderr;
+	
 	int socketConnectionFileDescriptor = establishedConnection();
 	if (socketConnectionFileDescriptor == -1)
 	{
@@ -124,31 +849,66 @@ int main(int argc, char** argv)
 		}
 		else
 		{
-			printf("Login success as %s\n", username);
+			fprintf(statusOutput, "Login success as %s\n", username);
 		}
 	}
 	
-	while(1)
+	OutputWriter output;
+	initOutputWriter(&output, format);
+	
+	if (scriptPath != NULL)
+	{
+		int result = runScript(
+			socketConnectionFileDescriptor, scriptPath, pipelineDepth, username, &output
+		);
+		delOutputWriter(&output);
+		close(socketConnectionFileDescriptor);
+		return result == 1 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	
+	FrameReader *reader = calloc(1, sizeof(FrameReader));
+	FILE *log = fopen("./client.log", "a+");
+	
+	while(scanf(" %[^\n]", message) == 1)
 	{
-		scanf(" %[^\n]", message);
-		if (message != NULL)
+		strcpy(command, message);
+		send(socketConnectionFileDescriptor, message, sizeof(message), 0);
+		if (receiveFrame(reader, socketConnectionFileDescriptor, message) == 0)
 		{
-			strcpy(command, message);
+			break;
 		}
-		send(socketConnectionFileDescriptor, message, sizeof(message), 0);
-		recv(socketConnectionFileDescriptor, message, sizeof(message), 0);
 		
 		if (message[0] == 'M')
 		{
-			printf("%s\n", message + 1);
+			fprintf(statusOutput, "%s\n", message + 1);
 			if (message[1] == 'B')
 			{
-				writeLog(username, command);
+				writeLogLine(log, username, command);
+			}
+		}
+		else if (message[0] == 'Q' && format != FORMAT_TABLE)
+		{
+			receiveFrame(reader, socketConnectionFileDescriptor, message);
+			int totalAttribute = 0;
+			memcpy(&totalAttribute, message, sizeof(totalAttribute));
+			
+			for (int i = 0; i < totalAttribute; i++)
+			{
+				receiveFrame(reader, socketConnectionFileDescriptor, message);
+				writeOutputHeaderName(&output, message);
 			}
+			endOutputHeader(&output);
+			
+			receiveFrame(reader, socketConnectionFileDescriptor, message);
+			while (receiveFrame(reader, socketConnectionFileDescriptor, message) == 1 && message[0] != 'F')
+			{
+				writeOutputFrame(&output, message);
+			}
+			flushOutputWriter(&output);
 		}
 		else if (message[0] == 'Q')
 		{
-			recv(socketConnectionFileDescriptor, message, sizeof(message), 0);
+			receiveFrame(reader, socketConnectionFileDescriptor, message);
 			
 			int totalAttribute = 0;
 			memcpy(&totalAttribute, message, sizeof(totalAttribute));
@@ -156,7 +916,7 @@ int main(int argc, char** argv)
 			printf("|");
 			for (int i = 0; i < totalAttribute; i++)
 			{
-				recv(socketConnectionFileDescriptor, message, sizeof(message), 0);
+				receiveFrame(reader, socketConnectionFileDescriptor, message);
 				printf("%10.10s|", message);
 			}
 			printf("\n|");
@@ -165,7 +925,7 @@ int main(int argc, char** argv)
 				printf("----------|");
 			}
 			
-			recv(socketConnectionFileDescriptor, message, sizeof(message), 0);
+			receiveFrame(reader, socketConnectionFileDescriptor, message);
 			int totalRecord = 0;
 			memcpy(&totalRecord, message, sizeof(totalRecord));
 			
@@ -173,9 +933,8 @@ int main(int argc, char** argv)
 			int printOut = 0;
 			
 			printf("\n|");
-			while(finished == 0)
+			while(finished == 0 && receiveFrame(reader, socketConnectionFileDescriptor, message) == 1)
 			{
-				recv(socketConnectionFileDescriptor, message, sizeof(message), 0);
 				if (message[0] == 'C')
 				{
 					printOut = 0;
@@ -202,5 +961,10 @@ int main(int argc, char** argv)
 			printf("\n");
 		}
 	}
+	
+	fclose(log);
+	free(reader);
+	delOutputWriter(&output);
+	close(socketConnectionFileDescriptor);
 	return 0;
 }
@@ -1,3 +1,5 @@
+#define _GNU_SOURCE
+
 #include "stdio.h"
 #include "stdlib.h"
 #include "string.h"
@@ -6,13 +8,24 @@
 #include "unistd.h"
 #include "dirent.h"
 #include "errno.h"
+#include "limits.h"
+#include "pthread.h"
 #include "pwd.h"
+#include "time.h"
 
 #include "netinet/in.h" 
 
 #include "sys/stat.h"
 #include "sys/types.h"
 #include "sys/epoll.h"
+#include "sys/mman.h"
+#include "sys/syscall.h"
+
+#include "linux/io_uring.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include "immintrin.h"
+#endif
 
 #ifndef __DATA_BUFFER
 	#define __DATA_BUFFER 4096
@@ -26,6 +39,12 @@
 	#error __MAX_CONNECTIONS already defined
 #endif
 
+#ifndef __MAX_SESSIONS
+	#define __MAX_SESSIONS 1024
+#else
+	#error __MAX_SESSIONS already defined
+#endif
+
 #ifndef __SERVER_PORT
 	#define __SERVER_PORT 1122 
 #else
@@ -44,6 +63,18 @@
 	#error __DATABASE_ROOT already defined
 #endif
 
+#ifndef __TABLE_FILE_MAGIC
+	#define __TABLE_FILE_MAGIC 0x4C425453
+#else
+	#error __TABLE_FILE_MAGIC already defined
+#endif
+
+#ifndef __TABLE_FILE_VERSION
+	#define __TABLE_FILE_VERSION 2
+#else
+	#error __TABLE_FILE_VERSION already defined
+#endif
+
 #ifndef __MAX_ATTRIBUTE_NAME_LENGTH
 	#define __MAX_ATTRIBUTE_NAME_LENGTH 64
 #else
@@ -62,6 +93,294 @@
 	#error __STRING_MAX_LENGTH already defined
 #endif
 
+#ifndef __SORT_MEMORY_BUDGET
+	#define __SORT_MEMORY_BUDGET 67108864
+#else
+	#error __SORT_MEMORY_BUDGET already defined
+#endif
+
+#ifndef __SORT_MERGE_FAN_IN
+	#define __SORT_MERGE_FAN_IN 64
+#else
+	#error __SORT_MERGE_FAN_IN already defined
+#endif
+
+#ifndef __JOIN_MEMORY_BUDGET
+	#define __JOIN_MEMORY_BUDGET 67108864
+#else
+	#error __JOIN_MEMORY_BUDGET already defined
+#endif
+
+#ifndef __JOIN_PARTITIONS
+	#define __JOIN_PARTITIONS 32
+#else
+	#error __JOIN_PARTITIONS already defined
+#endif
+
+#ifndef __SCAN_BATCH_RECORDS
+	#define __SCAN_BATCH_RECORDS 1024
+#else
+	#error __SCAN_BATCH_RECORDS already defined
+#endif
+
+#ifndef __IN_LIST_LINEAR_MAX
+	#define __IN_LIST_LINEAR_MAX 8
+#else
+	#error __IN_LIST_LINEAR_MAX already defined
+#endif
+
+#ifndef __INDEX_MIN_BUCKETS
+	#define __INDEX_MIN_BUCKETS 1024
+#else
+	#error __INDEX_MIN_BUCKETS already defined
+#endif
+
+#ifndef __SCAN_MAX_THREADS
+	#define __SCAN_MAX_THREADS 16
+#else
+	#error __SCAN_MAX_THREADS already defined
+#endif
+
+#ifndef __TRANSACTION_ID_RESERVE
+	#define __TRANSACTION_ID_RESERVE 4096
+#else
+	#error __TRANSACTION_ID_RESERVE already defined
+#endif
+
+#ifndef __ACTIVE_SNAPSHOT_CAPACITY
+	#define __ACTIVE_SNAPSHOT_CAPACITY 64
+#else
+	#error __ACTIVE_SNAPSHOT_CAPACITY already defined
+#endif
+
+#ifndef __ASYNC_IO_QUEUE_DEPTH
+	#define __ASYNC_IO_QUEUE_DEPTH 64
+#else
+	#error __ASYNC_IO_QUEUE_DEPTH already defined
+#endif
+
+#ifndef __ASYNC_IO_THREADS
+	#define __ASYNC_IO_THREADS 4
+#else
+	#error __ASYNC_IO_THREADS already defined
+#endif
+
+#ifndef __ASYNC_IO_MAX_PENDING_WRITES
+	#define __ASYNC_IO_MAX_PENDING_WRITES 256
+#else
+	#error __ASYNC_IO_MAX_PENDING_WRITES already defined
+#endif
+
+#ifndef __ASYNC_IO_MAX_PENDING_BYTES
+	#define __ASYNC_IO_MAX_PENDING_BYTES 16777216
+#else
+	#error __ASYNC_IO_MAX_PENDING_BYTES already defined
+#endif
+
+#ifndef __SCAN_READ_AHEAD_DEPTH
+	#define __SCAN_READ_AHEAD_DEPTH 8
+#else
+	#error __SCAN_READ_AHEAD_DEPTH already defined
+#endif
+
+#ifndef __PARALLEL_SCAN_MIN_BYTES
+	#define __PARALLEL_SCAN_MIN_BYTES 16777216
+#else
+	#error __PARALLEL_SCAN_MIN_BYTES already defined
+#endif
+
+#ifndef __COLUMNAR_SEGMENT_ROWS
+	#define __COLUMNAR_SEGMENT_ROWS 4096
+#else
+	#error __COLUMNAR_SEGMENT_ROWS already defined
+#endif
+
+#ifndef __SCAN_BATCH_BYTES
+	#define __SCAN_BATCH_BYTES 4194304
+#else
+	#error __SCAN_BATCH_BYTES already defined
+#endif
+
+#ifndef __STATS_HISTOGRAM_BUCKETS
+	#define __STATS_HISTOGRAM_BUCKETS 32
+#else
+	#error __STATS_HISTOGRAM_BUCKETS already defined
+#endif
+
+#ifndef __STATS_SKETCH_VALUES
+	#define __STATS_SKETCH_VALUES 128
+#else
+	#error __STATS_SKETCH_VALUES already defined
+#endif
+
+#ifndef __STATS_SAMPLE_ROWS
+	#define __STATS_SAMPLE_ROWS 65536
+#else
+	#error __STATS_SAMPLE_ROWS already defined
+#endif
+
+#ifndef __STATS_VALUE_SIZE
+	#define __STATS_VALUE_SIZE 64
+#else
+	#error __STATS_VALUE_SIZE already defined
+#endif
+
+#ifndef __INDEX_RANDOM_READ_COST
+	#define __INDEX_RANDOM_READ_COST 4
+#else
+	#error __INDEX_RANDOM_READ_COST already defined
+#endif
+
+#ifndef __ZONE_MAP_BLOCK_RECORDS
+	#define __ZONE_MAP_BLOCK_RECORDS 1024
+#else
+	#error __ZONE_MAP_BLOCK_RECORDS already defined
+#endif
+
+#ifndef __ZONE_MAP_VALUE_SIZE
+	#define __ZONE_MAP_VALUE_SIZE 16
+#else
+	#error __ZONE_MAP_VALUE_SIZE already defined
+#endif
+
+#ifndef __BLOOM_FALSE_POSITIVE_RATE
+	#define __BLOOM_FALSE_POSITIVE_RATE 0.01
+#else
+	#error __BLOOM_FALSE_POSITIVE_RATE already defined
+#endif
+
+#ifndef __BLOOM_MIN_CAPACITY
+	#define __BLOOM_MIN_CAPACITY 1024
+#else
+	#error __BLOOM_MIN_CAPACITY already defined
+#endif
+
+#ifndef __COMPRESSION_MIN_RUN
+	#define __COMPRESSION_MIN_RUN 4
+#else
+	#error __COMPRESSION_MIN_RUN already defined
+#endif
+
+#ifndef __RESULT_CACHE_MEMORY
+	#define __RESULT_CACHE_MEMORY 67108864
+#else
+	#error __RESULT_CACHE_MEMORY already defined
+#endif
+
+#ifndef __RESULT_CACHE_ENTRY_MAX
+	#define __RESULT_CACHE_ENTRY_MAX 8388608
+#else
+	#error __RESULT_CACHE_ENTRY_MAX already defined
+#endif
+
+#ifndef __RESULT_CACHE_BUCKETS
+	#define __RESULT_CACHE_BUCKETS 4096
+#else
+	#error __RESULT_CACHE_BUCKETS already defined
+#endif
+
+#ifndef __TABLE_VERSION_BUCKETS
+	#define __TABLE_VERSION_BUCKETS 1024
+#else
+	#error __TABLE_VERSION_BUCKETS already defined
+#endif
+
+#ifndef __DUMP_CHUNK_SIZE
+	#define __DUMP_CHUNK_SIZE 1048576
+#else
+	#error __DUMP_CHUNK_SIZE already defined
+#endif
+
+#ifndef __DUMP_THREADS
+	#define __DUMP_THREADS 4
+#else
+	#error __DUMP_THREADS already defined
+#endif
+
+#ifndef __DUMP_QUEUE_CHUNKS
+	#define __DUMP_QUEUE_CHUNKS 4
+#else
+	#error __DUMP_QUEUE_CHUNKS already defined
+#endif
+
+#ifndef __AUDIT_LOG_PATH
+	#define __AUDIT_LOG_PATH "audit.log"
+#else
+	#error __AUDIT_LOG_PATH already defined
+#endif
+
+#ifndef __AUDIT_LOG_BUFFER
+	#define __AUDIT_LOG_BUFFER 4194304
+#else
+	#error __AUDIT_LOG_BUFFER already defined
+#endif
+
+#ifndef __AUDIT_LOG_WRITE_BUFFER
+	#define __AUDIT_LOG_WRITE_BUFFER 1048576
+#else
+	#error __AUDIT_LOG_WRITE_BUFFER already defined
+#endif
+
+#ifndef __AUDIT_LOG_FLUSH_MSEC
+	#define __AUDIT_LOG_FLUSH_MSEC 200
+#else
+	#error __AUDIT_LOG_FLUSH_MSEC already defined
+#endif
+
+#ifndef __AUDIT_LOG_MAX_BYTES
+	#define __AUDIT_LOG_MAX_BYTES 67108864
+#else
+	#error __AUDIT_LOG_MAX_BYTES already defined
+#endif
+
+#ifndef __AUDIT_LOG_FILES
+	#define __AUDIT_LOG_FILES 4
+#else
+	#error __AUDIT_LOG_FILES already defined
+#endif
+
+#ifndef __SLOW_QUERY_LOG_PATH
+	#define __SLOW_QUERY_LOG_PATH "slow.log"
+#else
+	#error __SLOW_QUERY_LOG_PATH already defined
+#endif
+
+#ifndef __STATS_MAX_THREADS
+	#define __STATS_MAX_THREADS 64
+#else
+	#error __STATS_MAX_THREADS already defined
+#endif
+
+#ifndef __LATENCY_SUB_BUCKET_BITS
+	#define __LATENCY_SUB_BUCKET_BITS 4
+#else
+	#error __LATENCY_SUB_BUCKET_BITS already defined
+#endif
+
+#ifndef __LATENCY_HISTOGRAM_BUCKETS
+	#define __LATENCY_HISTOGRAM_BUCKETS 640
+#else
+	#error __LATENCY_HISTOGRAM_BUCKETS already defined
+#endif
+
+#ifndef __STATS_DUMP_PATH
+	#define __STATS_DUMP_PATH "stats.prom"
+#else
+	#error __STATS_DUMP_PATH already defined
+#endif
+
+#ifndef __STATS_METRIC_PREFIX
+	#define __STATS_METRIC_PREFIX "sisopdb_"
+#else
+	#error __STATS_METRIC_PREFIX already defined
+#endif
+
+#ifndef __EXPLAIN_MAX_OPERATORS
+	#define __EXPLAIN_MAX_OPERATORS 16
+#else
+	#error __EXPLAIN_MAX_OPERATORS already defined
+#endif
+
 typedef enum {
 	INT = 1, 
 	LONG = 2, 
@@ -77,6 +396,15 @@ typedef enum {
 	FILLED = 1
 } BLOCKFLAG;
 
+typedef enum {
+	EQUAL = 0,
+	NOT_EQUAL = 1,
+	LESS = 2,
+	LESS_EQUAL = 3,
+	GREATER = 4,
+	GREATER_EQUAL = 5
+} CompareOperator;
+
 typedef struct {
 	char attributeName[__MAX_ATTRIBUTE_NAME_LENGTH];
 	DataType type;
@@ -91,9 +419,34 @@ typedef struct {
 typedef struct {
 	BLOCKFLAG flag;
 	int size;
+	long long int createdTransaction;
+	long long int deletedTransaction;
 	void *data;
 } RecordBlock;
 
+typedef struct {
+	long long int snapshot;
+	long long int transaction;
+} Snapshot;
+
+typedef struct {
+	long long int first;
+	long long int last;
+} TransactionRange;
+
+typedef struct {
+	long long int lastCommitted;
+	long long int reservedUntil;
+	long long int writeTransaction;
+	int writeDepth;
+	long long int *activeSnapshot;
+	int activeSnapshotAmount;
+	int activeSnapshotCapacity;
+	TransactionRange *aborted;
+	int abortedAmount;
+	int abortedCapacity;
+} TransactionManager;
+
 typedef struct {
 	RecordBlock *record;
 	int size;
@@ -106,6 +459,128 @@ typedef struct {
 	int capacity;
 } DynamicBlock;
 
+typedef enum {
+	COMPARE_PREDICATE = 0,
+	IN_PREDICATE = 1,
+	AND_PREDICATE = 2,
+	OR_PREDICATE = 3,
+	NOT_PREDICATE = 4
+} PredicateType;
+
+typedef struct Predicate {
+	PredicateType type;
+	CompareOperator op;
+	int attributeIndex;
+	Attribute attribute;
+	int offset;
+	char *value;
+	int valueAmount;
+	int *valueSet;
+	int valueSetCapacity;
+	struct Predicate **child;
+	int childAmount;
+	double selectivity;
+} Predicate;
+
+typedef enum {
+	WRITE_INSERT = 0,
+	WRITE_DELETE = 1,
+	WRITE_UPDATE = 2
+} WriteOperation;
+
+typedef struct WriteSetEntry {
+	WriteOperation operation;
+	char database[64];
+	char table[64];
+	int recordBlockSize;
+	RecordBlock record;
+	Predicate *where;
+	char setAttribute[64];
+	void *setValue;
+	struct WriteSetEntry *next;
+} WriteSetEntry;
+
+typedef struct Transaction {
+	WriteSetEntry *head;
+	WriteSetEntry *tail;
+	int entryAmount;
+} Transaction;
+
+typedef struct {
+	char *data;
+	int recordAmount;
+	size_t recordStride;
+	size_t dataOffset;
+	void **columnChunk;
+	char *columnVector;
+} PredicateBatch;
+
+typedef struct {
+	long long int slot;
+	long long int next;
+	unsigned int hash;
+} IndexEntry;
+
+typedef struct {
+	Attribute attribute;
+	int filled;
+	char minValue[__STATS_VALUE_SIZE];
+	char maxValue[__STATS_VALUE_SIZE];
+	long long int nullAmount;
+	int sketchAmount;
+	unsigned int sketch[__STATS_SKETCH_VALUES];
+	int bucketAmount;
+	double bucketBound[__STATS_HISTOGRAM_BUCKETS + 1];
+} ColumnStats;
+
+typedef struct {
+	long long int rowAmount;
+	long long int modifiedAmount;
+	int attributeAmount;
+	ColumnStats column[__MAX_ATTRIBUTE_ON_TABLE];
+} TableStats;
+
+typedef struct {
+	TableStats *stats;
+	int attributeOffset[__MAX_ATTRIBUTE_ON_TABLE];
+	double *sample[__MAX_ATTRIBUTE_ON_TABLE];
+	unsigned long long int random;
+} StatsCollector;
+
+typedef struct {
+	int filled;
+	char minValue[__ZONE_MAP_VALUE_SIZE];
+	char maxValue[__ZONE_MAP_VALUE_SIZE];
+} ZoneEntry;
+
+typedef struct {
+	long long int bitAmount;
+	long long int capacity;
+	long long int entryAmount;
+	int hashAmount;
+	double falsePositiveRate;
+} BloomHeader;
+
+typedef struct {
+	long long int generation;
+	long long int recordTotal;
+	long long int pageAmount;
+	int recordStride;
+	int pageRecords;
+} PageDirectoryHeader;
+
+typedef struct {
+	long long int offset;
+	int compressedSize;
+	int recordAmount;
+} PageDirectoryEntry;
+
+typedef enum {
+	SEQUENTIAL_SCAN,
+	PARALLEL_SCAN,
+	INDEX_SCAN
+} AccessPath;
+
 typedef struct ParsedStringQueue {
 	struct ParsedStringQueue *next;
 	char *parsedString;
@@ -115,1754 +590,11860 @@ typedef struct {
 	int id;
 	int openningDatabase;
 	char databaseName[64];
+	char username[64];
+	Transaction *transaction;
 } AccountData;
 
-void initRecordBlock(RecordBlock *recordBlock, int size) 
-{
-	recordBlock->data = malloc(sizeof(char) * size);
-	memset(recordBlock->data, 0, sizeof(char) * size);
-	recordBlock->size = sizeof(char) * size;
-	recordBlock->flag = FILLED;
-}
+typedef enum {
+	ROW_STORAGE = 0,
+	COLUMNAR_STORAGE = 1
+} StorageType;
 
-size_t sizeOfRecordBlock(RecordBlock *recordBlock)
-{
-	return recordBlock->size + sizeof(recordBlock->size) + sizeof(recordBlock->flag);
-}
+typedef struct {
+	StorageType storage;
+	int compressed;
+} TableOptions;
 
-void delRecordBlock(RecordBlock *recordBlock)
-{
-	free(recordBlock->data);
-}
+typedef enum {
+	NO_AGGREGATE = 0,
+	COUNT_AGGREGATE = 1,
+	SUM_AGGREGATE = 2,
+	MIN_AGGREGATE = 3,
+	MAX_AGGREGATE = 4,
+	AVG_AGGREGATE = 5
+} AggregateFunction;
 
-size_t fwriteRecordBlock(RecordBlock *recordBlock, FILE *stream)
-{
-	return 
-		fwrite(&(recordBlock->flag), sizeof(recordBlock->flag), 1, stream) +
-		fwrite(&(recordBlock->size), sizeof(recordBlock->size), 1, stream) +
-		fwrite(recordBlock->data, recordBlock->size, 1, stream);
-}
+typedef struct {
+	AggregateFunction function;
+	int attributeIndex;
+	Attribute resultAttribute;
+} SelectItem;
 
-size_t freadRecordBlock(RecordBlock *recordBlock, FILE *stream)
-{
-	if (
-		fread(&(recordBlock->flag), sizeof(recordBlock->flag), 1, stream) +
-		fread(&(recordBlock->size), sizeof(recordBlock->size), 1, stream) +
-		fread(recordBlock->data, recordBlock->size, 1, stream) == 3
-	)
-	{
-		return 1;
-	}
-	else
-	{
-		return 0;
-	}
-}
+typedef struct {
+	char tableName[64];
+	Attribute tableAttribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute;
+	int recordBlockSize;
+	SelectItem item[__MAX_ATTRIBUTE_ON_TABLE];
+	int itemAmount;
+	int aggregated;
+	int groupBy[__MAX_ATTRIBUTE_ON_TABLE];
+	int groupByAmount;
+	Predicate *where;
+	char orderByName[64];
+	int orderByDescending;
+	long long int limit;
+	long long int offset;
+	int joined;
+	char joinTableName[64];
+	int leftAttributeAmount;
+	int leftRecordSize;
+	int leftJoinIndex;
+	int rightJoinIndex;
+} SelectQuery;
 
-void initDynamicBlock(DynamicBlock *dBlock)
-{
-	dBlock->block = malloc(sizeof(char) * 2);
-	dBlock->size = 0;
-	dBlock->capacity = 2;
-}
+typedef struct {
+	long long int count;
+	long long int integerSum;
+	double decimalSum;
+	int hasValue;
+} AggregateState;
 
-void delDynamicBlock(DynamicBlock *dBlock)
-{
-	free(dBlock->block);
-}
+typedef struct {
+	unsigned int *hash;
+	char **group;
+	int size;
+	int capacity;
+	int keySize;
+	int groupSize;
+} AggregateHashTable;
 
-void concatDynamicBlock(DynamicBlock *dBlock, const void *block, size_t size)
-{
-	while (dBlock->size + size > dBlock->capacity)
-	{
-		dBlock->capacity *= 2;
-		void *newBlock = malloc(sizeof(char) * dBlock->capacity);
-		memset(newBlock, 0, sizeof(char) * dBlock->capacity);
-		memcpy(newBlock, dBlock->block, sizeof(char) * dBlock->size);
-		
-		free(dBlock->block);
-		dBlock->block = newBlock;
+typedef struct {
+	SelectQuery *query;
+	AggregateHashTable table;
+	int attributeOffset[__MAX_ATTRIBUTE_ON_TABLE];
+	int keyOffset[__MAX_ATTRIBUTE_ON_TABLE];
+	int stateOffset[__MAX_ATTRIBUTE_ON_TABLE];
+	char *key;
+} AggregateContext;
+
+typedef struct {
+	DynamicBlock frame;
+	int overflow;
+	int tableAmount;
+	char tableName[2][64];
+} ResultCapture;
+
+typedef struct ResultCacheEntry {
+	char *key;
+	unsigned int hash;
+	int tableAmount;
+	char tableName[2][64];
+	long long int tableVersion[2];
+	char *frame;
+	size_t frameSize;
+	struct ResultCacheEntry *next;
+	struct ResultCacheEntry *newer;
+	struct ResultCacheEntry *older;
+} ResultCacheEntry;
+
+typedef struct {
+	ResultCacheEntry *bucket[__RESULT_CACHE_BUCKETS];
+	ResultCacheEntry *newest;
+	ResultCacheEntry *oldest;
+	size_t memoryUsed;
+} ResultCache;
+
+typedef struct TableVersion {
+	char database[64];
+	char table[64];
+	long long int version;
+	struct TableVersion *next;
+} TableVersion;
+
+typedef struct {
+	int fileDescriptor;
+	char *message;
+	Attribute *attribute;
+	int *selectedAttribute;
+	int amountOfSelectedAttribute;
+	int offsetDataOfAttribute[__MAX_ATTRIBUTE_ON_TABLE];
+	long long int rowsSent;
+	ResultCapture *capture;
+} ResultWriter;
+
+typedef struct {
+	int recordSize;
+	Attribute keyAttribute;
+	int keyOffset;
+	int descending;
+	char *buffer;
+	char **pointer;
+	int bufferCapacity;
+	int bufferAmount;
+	int *run;
+	int runAmount;
+	int runCapacity;
+	int sorterId;
+	int nextRunId;
+	long long int recordAmount;
+	long long int keepLimit;
+	int failed;
+} RecordSorter;
+
+typedef struct {
+	FILE *file;
+	char *record;
+} SortRunCursor;
+
+typedef struct {
+	FILE *file;
+	int recordSize;
+} SortRunWriter;
+
+typedef int (*RecordCallback)(void *context, char *recordData);
+
+typedef struct {
+	RecordCallback callback;
+	void *context;
+	long long int offset;
+	long long int limit;
+	long long int seen;
+} RecordLimiter;
+
+typedef struct {
+	RecordBlockVector *records;
+	int *recordBlockSize;
+} RecordCollector;
+
+typedef enum {
+	ASYNC_IO_SYNCHRONOUS = 0,
+	ASYNC_IO_URING = 1,
+	ASYNC_IO_THREAD_POOL = 2
+} AsyncIoBackend;
+
+typedef enum {
+	ASYNC_READ = 0,
+	ASYNC_WRITE = 1
+} AsyncOperation;
+
+typedef struct AsyncRequest {
+	AsyncOperation operation;
+	int fileDescriptor;
+	char *buffer;
+	size_t size;
+	off_t offset;
+	ssize_t result;
+	int done;
+	struct AsyncRequest *queueNext;
+} AsyncRequest;
+
+typedef struct {
+	AsyncIoBackend backend;
+	int ringFileDescriptor;
+	void *submissionRing;
+	void *completionRing;
+	size_t submissionRingSize;
+	size_t completionRingSize;
+	struct io_uring_sqe *submissionEntry;
+	size_t submissionEntrySize;
+	unsigned int *submissionHead;
+	unsigned int *submissionTail;
+	unsigned int *submissionMask;
+	unsigned int *submissionArray;
+	unsigned int submissionEntryAmount;
+	unsigned int *completionHead;
+	unsigned int *completionTail;
+	unsigned int *completionMask;
+	struct io_uring_cqe *completionEntry;
+	unsigned int unsubmitted;
+	unsigned int inFlight;
+	pthread_t worker[__ASYNC_IO_THREADS];
+	pthread_mutex_t lock;
+	pthread_cond_t requestReady;
+	pthread_cond_t requestDone;
+	AsyncRequest *queueHead;
+	AsyncRequest *queueTail;
+	AsyncRequest *pendingWrite;
+	int pendingWriteAmount;
+	int pendingWriteCapacity;
+	char *writeBuffer;
+	size_t writeBufferSize;
+	size_t writeBufferCapacity;
+	int writeFailed;
+} AsyncIo;
+
+typedef struct {
+	AsyncRequest request;
+	long long int recordIndex;
+	int recordAmount;
+} ReadAheadSlot;
+
+typedef enum {
+	MORSEL_FREE = 0,
+	MORSEL_CLAIMED = 1,
+	MORSEL_READY = 2
+} MorselState;
+
+typedef struct {
+	MorselState state;
+	long long int morselId;
+	char *data;
+	int recordAmount;
+} ScanMorsel;
+
+typedef struct {
+	int fileDescriptor;
+	off_t dataStart;
+	long long int recordTotal;
+	int recordBlockSize;
+	size_t recordStride;
+	int batchCapacity;
+	Predicate *where;
+	Snapshot snapshot;
+	char *skipBlock;
+	long long int skipBlockAmount;
+	long long int morselTotal;
+	long long int nextMorsel;
+	ScanMorsel *slot;
+	int slotAmount;
+	int stopped;
+	pthread_mutex_t lock;
+	pthread_cond_t morselReady;
+	pthread_cond_t slotFree;
+} ParallelScan;
+
+typedef struct {
+	pthread_t worker[__SCAN_MAX_THREADS];
+	int workerAmount;
+	pthread_mutex_t lock;
+	pthread_cond_t jobReady;
+	pthread_cond_t jobDone;
+	ParallelScan *job;
+	int waiting;
+	int running;
+	int busy;
+} ScanWorkerPool;
+
+typedef struct JoinHashEntry {
+	struct JoinHashEntry *next;
+	unsigned int hash;
+	char record[];
+} JoinHashEntry;
+
+typedef struct {
+	JoinHashEntry **bucket;
+	int bucketAmount;
+	long long int entryAmount;
+	size_t memoryUsed;
+} JoinHashTable;
+
+typedef struct {
+	char tableName[64];
+	int recordSize;
+	Attribute keyAttribute;
+	int keyOffset;
+	int neededColumn[__MAX_ATTRIBUTE_ON_TABLE];
+	Predicate *where;
+} JoinInput;
+
+typedef struct {
+	JoinInput build;
+	JoinInput probe;
+	int buildIsLeft;
+	int keyDecimal;
+	Predicate *residual;
+	JoinHashTable table;
+	int partitioned;
+	FILE *buildPartition[__JOIN_PARTITIONS];
+	FILE *probePartition[__JOIN_PARTITIONS];
+	int joinId;
+	char *output;
+	int leftRecordSize;
+	int rightRecordSize;
+	RecordCallback callback;
+	void *context;
+	int stopped;
+	int failed;
+} HashJoin;
+
+typedef struct {
+	void (*filterInt)(const void *vector, int length, CompareOperator op, int value, unsigned long long selection[]);
+	void (*filterLong)(const void *vector, int length, CompareOperator op, long long int value, unsigned long long selection[]);
+	void (*filterDecimal)(const void *vector, int length, CompareOperator op, double value, unsigned long long selection[]);
+} FilterKernel;
+
+typedef struct DumpChunk {
+	DynamicBlock data;
+	struct DumpChunk *next;
+} DumpChunk;
+
+typedef struct {
+	char table[64];
+	DumpChunk *head;
+	DumpChunk *tail;
+	int chunkAmount;
+	int finished;
+} DumpTable;
+
+typedef struct {
+	char database[64];
+	DumpTable *table;
+	int tableAmount;
+	int nextTable;
+	int failed;
+	char failedTable[64];
+	Snapshot snapshot;
+	pthread_mutex_t lock;
+	pthread_cond_t chunkReady;
+	pthread_cond_t chunkTaken;
+} DatabaseDump;
+
+typedef struct {
+	DatabaseDump *dump;
+	DumpTable *table;
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int attributeTotal;
+	DumpChunk *chunk;
+	DynamicBlock row;
+	DynamicBlock statement;
+	int statementRows;
+} DumpWriter;
+
+typedef enum {
+	AUDIT_LOG_ENTRY = 0,
+	SLOW_QUERY_ENTRY = 1
+} LogEntryKind;
+
+typedef struct {
+	int size;
+	LogEntryKind kind;
+	int session;
+	int account;
+	int succeeded;
+	long long int second;
+	long int nanosecond;
+	long long int elapsed;
+	char database[64];
+} AuditLogEntry;
+
+typedef struct {
+	const char *path;
+	FILE *file;
+	long long int fileSize;
+	char *writeBuffer;
+	size_t writeSize;
+} LogFile;
+
+typedef struct {
+	char *ring;
+	unsigned long long int head;
+	unsigned long long int tail;
+	unsigned long long int dropped;
+	pthread_t writer;
+	LogFile audit;
+	LogFile slowQuery;
+	long long int slowQueryMicroseconds;
+	long long int slowQueryRows;
+} AuditLog;
+
+typedef enum {
+	STATEMENT_LOGIN = 0,
+	STATEMENT_SELECT = 1,
+	STATEMENT_INSERT = 2,
+	STATEMENT_UPDATE = 3,
+	STATEMENT_DELETE = 4,
+	STATEMENT_CREATE = 5,
+	STATEMENT_DROP = 6,
+	STATEMENT_USE = 7,
+	STATEMENT_GRANT = 8,
+	STATEMENT_TRANSACTION = 9,
+	STATEMENT_MAINTENANCE = 10,
+	STATEMENT_SHOW = 11,
+	STATEMENT_OTHER = 12,
+	STATEMENT_TYPE_AMOUNT = 13
+} StatementType;
+
+typedef struct {
+	unsigned long long int statement[STATEMENT_TYPE_AMOUNT];
+	unsigned long long int failed[STATEMENT_TYPE_AMOUNT];
+	unsigned long long int latencySum[STATEMENT_TYPE_AMOUNT];
+	unsigned long long int latencyMax[STATEMENT_TYPE_AMOUNT];
+	unsigned long long int latency[STATEMENT_TYPE_AMOUNT][__LATENCY_HISTOGRAM_BUCKETS];
+	unsigned long long int rowsScanned;
+	unsigned long long int bytesScanned;
+	unsigned long long int bytesSent;
+	unsigned long long int resultCacheHit;
+	unsigned long long int resultCacheMiss;
+	unsigned long long int connectionOpened;
+	unsigned long long int connectionClosed;
+	int inUse;
+} ThreadStats;
+
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_key_t key;
+	ThreadStats *thread[__STATS_MAX_THREADS];
+	int threadAmount;
+	int dumpInterval;
+	pthread_t dumpWriter;
+} StatsRegistry;
+
+typedef struct {
+	char name[16];
+	char detail[128];
+	long long int rowsIn;
+	long long int rowsOut;
+	long long int skipped;
+	long long int bytes;
+	long long int allocations;
+	long long int elapsed;
+	struct timespec started;
+} QueryOperator;
+
+typedef struct {
+	QueryOperator operator[__EXPLAIN_MAX_OPERATORS];
+	int operatorAmount;
+	int current;
+	int analyze;
+} QueryProfile;
+
+FilterKernel filterKernel;
+int recordSorterSequence = 0;
+int hashJoinSequence = 0;
+int scanThreadAmount = 1;
+ScanWorkerPool scanWorkerPool;
+AsyncIo asyncIo;
+TransactionManager transactionManager;
+ResultCache resultCache;
+AuditLog auditLog;
+StatsRegistry statsRegistry;
+__thread ThreadStats *threadStats = NULL;
+QueryProfile *activeQueryProfile = NULL;
+const char *statementTypeName[STATEMENT_TYPE_AMOUNT] = {
+	"login", "select", "insert", "update", "delete", "create", "drop", 
+	"use", "grant", "transaction", "maintenance", "show", "other"
+};
+TableVersion *tableVersionBucket[__TABLE_VERSION_BUCKETS];
+
+void endQueryOperator()
+{
+	QueryProfile *profile = activeQueryProfile;
+	if (profile == NULL || profile->current == -1)
+	{
+		return;
 	}
 	
-	memcpy(dBlock->block + dBlock->size, block, size);
-	dBlock->size += size;
+	QueryOperator *operator = &profile->operator[profile->current];
+	struct timespec finished;
+	clock_gettime(CLOCK_MONOTONIC, &finished);
+	operator->elapsed = (finished.tv_sec - operator->started.tv_sec) * 1000000LL + 
+		(finished.tv_nsec - operator->started.tv_nsec) / 1000;
+	profile->current = -1;
 }
 
-void initRecordBlockVector(RecordBlockVector *vector)
+void beginQueryOperatorAt(const char *name, struct timespec *started)
 {
-	vector->record = (RecordBlock *)malloc(sizeof(RecordBlock) * 2);
-	vector->capacity = 2;
-	vector->size = 0;
+	QueryProfile *profile = activeQueryProfile;
+	if (profile == NULL)
+	{
+		return;
+	}
+	
+	endQueryOperator();
+	if (profile->operatorAmount < __EXPLAIN_MAX_OPERATORS)
+	{
+		QueryOperator *operator = &profile->operator[profile->operatorAmount];
+		memset(operator, 0, sizeof(QueryOperator));
+		snprintf(operator->name, sizeof(operator->name), "%s", name);
+		operator->started = *started;
+		profile->current = profile->operatorAmount++;
+	}
 }
 
-RecordBlock* getRecordBlockVector(RecordBlockVector *vector)
+void beginQueryOperator(const char *name)
 {
-	return vector->record;
+	if (activeQueryProfile == NULL)
+	{
+		return;
+	}
+	
+	struct timespec started;
+	clock_gettime(CLOCK_MONOTONIC, &started);
+	beginQueryOperatorAt(name, &started);
 }
 
-int sizeRecordBlockVector(RecordBlockVector *vector)
+QueryOperator *currentQueryOperator()
 {
-	return vector->size;
+	QueryProfile *profile = activeQueryProfile;
+	if (profile == NULL || profile->current == -1)
+	{
+		return NULL;
+	}
+	return &profile->operator[profile->current];
 }
 
-void delRecordBlockVector(RecordBlockVector *vector)
+int isQueryPlanOnly()
 {
-	for (int i = 0; i < vector->size; i++)
-	{
-		delRecordBlock(&(vector->record[i]));
-	}
-	free(vector->record);
+	return activeQueryProfile != NULL && activeQueryProfile->analyze == 0;
 }
 
-void appendRecordBlockVector(RecordBlockVector *vector, RecordBlock *data)
-{	
-	if (vector->size >= vector->capacity)
+void setQueryOperatorDetail(char detail[])
+{
+	QueryOperator *operator = currentQueryOperator();
+	if (operator != NULL)
 	{
-		vector->capacity *= 2;
-		RecordBlock *newRecordBlock = (RecordBlock *)malloc(sizeof(RecordBlock) * vector->capacity);
-		
-		memcpy(newRecordBlock, vector->record, sizeof(RecordBlock) * vector->size);
-
-		free(vector->record);
-		vector->record = newRecordBlock;
+		snprintf(operator->detail, sizeof(operator->detail), "%s", detail);
 	}
-	
-	vector->record[vector->size] = *data;
-	vector->size += 1;
 }
 
-void popParsedStringQueue(ParsedStringQueue **queue)
+void addQueryOperatorStat(long long int *counter, long long int amount)
 {
-	ParsedStringQueue *next = (*queue)->next;
-	free((*queue)->parsedString);
-	free(*queue);
-	*queue = next;
+	__atomic_add_fetch(counter, amount, __ATOMIC_RELAXED);
 }
 
-ParsedStringQueue* parseStringSQLScript(char str[])
+int countSelection(unsigned long long selection[], int recordAmount)
 {
-	int scriptLength = strlen(str);
-	int lowerBound = -1;
-	int index = 0;
-	
-	ParsedStringQueue *root = NULL;
-	ParsedStringQueue *walker = root;
-	ParsedStringQueue *newString = NULL;
-	int parentheses = 0;
-	int quotation = 0;
-	
-	
-	while(index < scriptLength)
+	int amount = 0;
+	for (int i = 0; i < (recordAmount + 63) / 64; i++)
 	{
-		if (str[index] != ' ' && str[index] != ';' && str[index] != ',') 
-		{
-			if (lowerBound == -1)
-			{
-				lowerBound = index;
-			}
-			
-			if (str[index] == '(')
-			{
-				parentheses++;
-			}
-			else if (str[index] == ')')
-			{
-				parentheses--;
-			}
-			else if (str[index] == '\'')
-			{
-				quotation = quotation == 1 ? 0 : 1;
-			}
-		}
-		else if ((parentheses == 0 && quotation == 0) && lowerBound >= 0)
-		{
-			newString = (ParsedStringQueue *)malloc(sizeof(ParsedStringQueue));
-			newString->next = NULL;
-			
-			if (str[lowerBound] == '(')
-			{
-				lowerBound++;
-				index--;
-			}
-			
-			newString->parsedString = malloc(sizeof(char) * (index - lowerBound + 1));
-			memset(newString->parsedString, 0, sizeof(char) * (index - lowerBound + 1));
-			strncpy(newString->parsedString, str + lowerBound, (index - lowerBound));
-			
-			if (root == NULL)
-			{
-				root = newString;
-				walker = newString;
-			}
-			else
-			{
-				walker->next = newString;
-				walker = newString;
-			}
-			
-			lowerBound = -1;
-		}
-		
-		index++;
+		amount += __builtin_popcountll(selection[i]);
 	}
-	
-	return root;
+	return amount;
 }
 
-int isStringAlphaNumeric(char str[])
+void profileScanBatch(int recordAmount, long long int bytes, unsigned long long visible[])
 {
-	int length = strlen(str);
-	for (int i = 0; i < length; i++)
+	QueryOperator *operator = currentQueryOperator();
+	if (operator != NULL)
 	{
-		if (isalnum(str[i]) == 0)
-		{
-			return 0;
-		}
+		int visibleAmount = countSelection(visible, recordAmount);
+		addQueryOperatorStat(&operator->rowsIn, recordAmount);
+		addQueryOperatorStat(&operator->skipped, recordAmount - visibleAmount);
+		addQueryOperatorStat(&operator->bytes, bytes);
 	}
-	return 1;
 }
 
-void convertToLower(char str[], size_t size)
+void profileMatchedRecords(int recordAmount, unsigned long long matched[])
 {
-	for (int i = 0; i < size; i++)
+	QueryOperator *operator = currentQueryOperator();
+	if (operator != NULL)
 	{
-		str[i] = tolower(str[i]);
+		addQueryOperatorStat(&operator->rowsOut, countSelection(matched, recordAmount));
 	}
 }
 
-int createTCPServerSocket()
+void initRecordBlock(RecordBlock *recordBlock, int size) 
 {
-	struct sockaddr_in socketAddress;
-	int socketFileDescriptor = -1;
-
-	socketFileDescriptor = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
-	if (socketFileDescriptor == -1) {
-		fprintf(stderr, "Error: [%s]\n", strerror(errno));
-		return -1;
-	}
-
-	socketAddress.sin_family = AF_INET;         
-	socketAddress.sin_port = htons(__SERVER_PORT);     
-	socketAddress.sin_addr.s_addr = INADDR_ANY; 
-
-	if (bind(socketFileDescriptor, (struct sockaddr *)&socketAddress, sizeof(struct sockaddr_in)) != 0) {
-		fprintf(stderr, "Error: [%s]\n", strerror(errno));
-		close(socketFileDescriptor);
-		return -1;
-	}
-
-	if (listen(socketFileDescriptor, 64) != 0) {
-		fprintf(stderr, "Error: [%s]\n", strerror(errno));
-		close(socketFileDescriptor);
-		return -1;
+	QueryOperator *operator = currentQueryOperator();
+	if (operator != NULL)
+	{
+		addQueryOperatorStat(&operator->allocations, 1);
 	}
+	recordBlock->data = malloc(sizeof(char) * size);
+	memset(recordBlock->data, 0, sizeof(char) * size);
+	recordBlock->size = sizeof(char) * size;
+	recordBlock->flag = FILLED;
+	recordBlock->createdTransaction = 0;
+	recordBlock->deletedTransaction = 0;
+}
 
-	return socketFileDescriptor;
+size_t sizeOfRecordBlockHeader()
+{
+	return sizeof(BLOCKFLAG) + sizeof(int) + sizeof(long long int) * 2;
 }
 
-void setupEpollConnection(int epollFileDescriptor, int newFileDescriptor, struct epoll_event * epollEvent) 
+size_t sizeOfRecordBlock(RecordBlock *recordBlock)
 {
-	epollEvent->events = EPOLLIN;
-	epollEvent->data.fd = newFileDescriptor;
+	return recordBlock->size + sizeOfRecordBlockHeader();
+}
 
-	epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, newFileDescriptor, epollEvent);
+void delRecordBlock(RecordBlock *recordBlock)
+{
+	free(recordBlock->data);
 }
 
-int qsortFunctionForAttribute(const void *a, const void *b)
+size_t fwriteRecordBlock(RecordBlock *recordBlock, FILE *stream)
 {
-	return strcmp( ((Attribute *)a)->attributeName, ((Attribute *)b)->attributeName );
+	return 
+		fwrite(&(recordBlock->flag), sizeof(recordBlock->flag), 1, stream) +
+		fwrite(&(recordBlock->size), sizeof(recordBlock->size), 1, stream) +
+		fwrite(&(recordBlock->createdTransaction), sizeof(recordBlock->createdTransaction), 1, stream) +
+		fwrite(&(recordBlock->deletedTransaction), sizeof(recordBlock->deletedTransaction), 1, stream) +
+		fwrite(recordBlock->data, recordBlock->size, 1, stream);
 }
 
-int noDuplicateAttribute(int attributeAmount, Attribute attribute[])
+size_t freadRecordBlock(RecordBlock *recordBlock, FILE *stream)
 {
-	Attribute temp[attributeAmount];
-	memcpy(temp, attribute, sizeof(Attribute) * attributeAmount);
-	qsort(temp, attributeAmount, sizeof(Attribute), qsortFunctionForAttribute);
-	for (int i = 0; i < attributeAmount - 1; i++)
+	if (
+		fread(&(recordBlock->flag), sizeof(recordBlock->flag), 1, stream) +
+		fread(&(recordBlock->size), sizeof(recordBlock->size), 1, stream) +
+		fread(&(recordBlock->createdTransaction), sizeof(recordBlock->createdTransaction), 1, stream) +
+		fread(&(recordBlock->deletedTransaction), sizeof(recordBlock->deletedTransaction), 1, stream) +
+		fread(recordBlock->data, recordBlock->size, 1, stream) == 5
+	)
 	{
-		if (strcmp(temp[i].attributeName, temp[i+1].attributeName) == 0)
-		{
-			return 0;
-		}
+		return 1;
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+void encodeRecordBlockHeader(RecordBlock *recordBlock, char *buffer)
+{
+	memcpy(buffer, &(recordBlock->flag), sizeof(recordBlock->flag));
+	buffer += sizeof(recordBlock->flag);
+	memcpy(buffer, &(recordBlock->size), sizeof(recordBlock->size));
+	buffer += sizeof(recordBlock->size);
+	memcpy(buffer, &(recordBlock->createdTransaction), sizeof(recordBlock->createdTransaction));
+	buffer += sizeof(recordBlock->createdTransaction);
+	memcpy(buffer, &(recordBlock->deletedTransaction), sizeof(recordBlock->deletedTransaction));
+}
+
+void readRecordVersion(char *record, long long int *createdTransaction, long long int *deletedTransaction)
+{
+	size_t offset = sizeof(BLOCKFLAG) + sizeof(int);
+	memcpy(createdTransaction, record + offset, sizeof(*createdTransaction));
+	memcpy(deletedTransaction, record + offset + sizeof(*createdTransaction), sizeof(*deletedTransaction));
+}
+
+void markRecordDeleted(char *record, long long int deletedTransaction)
+{
+	size_t offset = sizeof(BLOCKFLAG) + sizeof(int) + sizeof(long long int);
+	memcpy(record + offset, &deletedTransaction, sizeof(deletedTransaction));
+}
+
+void transactionFilePath(char filePath[])
+{
+	sprintf(filePath, "%s/.transaction", __DATABASE_ROOT);
+}
+
+void commitPointFilePath(char filePath[])
+{
+	sprintf(filePath, "%s/.commit", __DATABASE_ROOT);
+}
+
+int replaceStateFile(char filePath[], void *data, size_t size, int durable)
+{
+	char tempPath[1100];
+	sprintf(tempPath, "%s.tmp", filePath);
+	FILE *stateFile = fopen(tempPath, "w");
+	if (stateFile == NULL)
+	{
+		return 0;
+	}
+	
+	int failed = fwrite(data, size, 1, stateFile) != 1 || fflush(stateFile) != 0 || (durable == 1 && fsync(fileno(stateFile)) != 0);
+	if (fclose(stateFile) != 0 || failed == 1 || rename(tempPath, filePath) != 0)
+	{
+		remove(tempPath);
+		return 0;
+	}
+	if (durable == 0)
+	{
+		return 1;
+	}
+	
+	DIR *rootDirectory = opendir(__DATABASE_ROOT);
+	if (rootDirectory != NULL)
+	{
+		fsync(dirfd(rootDirectory));
+		closedir(rootDirectory);
 	}
 	return 1;
 }
 
-int createTable(char database[], char table[], int attributeAmount, Attribute attribute[])
+void appendAbortedTransactions(long long int first, long long int last)
 {
-	char filePath[1024];
-	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
-	FILE *tableFile = fopen(filePath, "r");
+	TransactionRange *previous = transactionManager.abortedAmount > 0 ? 
+		&transactionManager.aborted[transactionManager.abortedAmount - 1] : NULL;
+	if (previous != NULL && first <= previous->last + 1)
+	{
+		previous->last = last > previous->last ? last : previous->last;
+		return;
+	}
 	
-	if (tableFile == NULL && attributeAmount <= __MAX_ATTRIBUTE_ON_TABLE && noDuplicateAttribute(attributeAmount, attribute))
+	if (transactionManager.abortedAmount >= transactionManager.abortedCapacity)
 	{
-		tableFile = fopen(filePath, "w");
-		
-		int tableData[3];
-		memset(tableData, 0, sizeof(int) * 3);
-		tableData[0] = attributeAmount;
-		
-		size_t attributeBlockSize = attributeAmount * sizeof(AttributeBlock);
-		void *attributeBlockArray = malloc(attributeBlockSize);
-		memset(attributeBlockArray, 0, attributeBlockSize);
-		
-		AttributeBlock attributeBlock[attributeAmount];
-		for (int i = 0; i < attributeAmount; i++)
+		transactionManager.abortedCapacity = transactionManager.abortedCapacity == 0 ? 16 : transactionManager.abortedCapacity * 2;
+		transactionManager.aborted = realloc(
+			transactionManager.aborted, sizeof(TransactionRange) * transactionManager.abortedCapacity
+		);
+	}
+	transactionManager.aborted[transactionManager.abortedAmount].first = first;
+	transactionManager.aborted[transactionManager.abortedAmount].last = last;
+	transactionManager.abortedAmount++;
+}
+
+int isTransactionAborted(long long int transaction)
+{
+	int low = 0;
+	int high = transactionManager.abortedAmount - 1;
+	while (low <= high)
+	{
+		int middle = (low + high) / 2;
+		if (transaction < transactionManager.aborted[middle].first)
 		{
-			attributeBlock[i].flag = FILLED;
-			attributeBlock[i].attribute = attribute[i];
-			tableData[2] += attribute[i].size;
+			high = middle - 1;
+		}
+		else if (transaction > transactionManager.aborted[middle].last)
+		{
+			low = middle + 1;
+		}
+		else
+		{
+			return 1;
 		}
-		memcpy(attributeBlockArray, attributeBlock, sizeof(AttributeBlock) * attributeAmount);
-		
-		fwrite(tableData, sizeof(int), 3, tableFile);
-		fwrite(attributeBlockArray, sizeof(AttributeBlock), attributeAmount, tableFile);
-		
-		fclose(tableFile);
-		free(attributeBlockArray);
-		
-		return 1;
 	}
 	return 0;
 }
 
-int createDatabase(char databaseName[])
+int persistCommitPoint(long long int commitPoint, int durable)
 {
+	size_t size = sizeof(long long int) * 2 + sizeof(TransactionRange) * transactionManager.abortedAmount;
+	long long int *state = malloc(size);
+	state[0] = commitPoint;
+	state[1] = transactionManager.abortedAmount;
+	memcpy(state + 2, transactionManager.aborted, sizeof(TransactionRange) * transactionManager.abortedAmount);
+	
 	char filePath[1024];
-	sprintf(filePath, "%s/%s", __DATABASE_ROOT, databaseName);
-	DIR *databaseDirectory = opendir(filePath);
-	if (databaseDirectory == NULL)
+	commitPointFilePath(filePath);
+	int result = replaceStateFile(filePath, state, size, durable);
+	free(state);
+	return result;
+}
+
+int loadCommitPoint(int versionedTableAmount)
+{
+	char filePath[1024];
+	commitPointFilePath(filePath);
+	FILE *commitFile = fopen(filePath, "r");
+	long long int state[2] = {0, 0};
+	if (commitFile == NULL && (errno != ENOENT || versionedTableAmount > 0))
 	{
-		mkdir(filePath, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
-		return 1;
+		fprintf(stderr, "Cannot read %s, the last commit point is unknown\n", filePath);
+		return 0;
 	}
 	
-	return 0;
+	int loaded = 1;
+	if (commitFile != NULL)
+	{
+		loaded = fread(state, sizeof(state[0]), 2, commitFile) == 2 && state[1] >= 0 && state[1] <= INT_MAX;
+		TransactionRange range;
+		for (long long int i = 0; i < state[1] && loaded == 1; i++)
+		{
+			loaded = fread(&range, sizeof(range), 1, commitFile) == 1;
+			if (loaded == 1)
+			{
+				appendAbortedTransactions(range.first, range.last);
+			}
+		}
+		fclose(commitFile);
+	}
+	if (loaded == 0)
+	{
+		fprintf(stderr, "%s is truncated, the last commit point is unknown\n", filePath);
+		return 0;
+	}
+	
+	if (transactionManager.reservedUntil > state[0])
+	{
+		appendAbortedTransactions(state[0] + 1, transactionManager.reservedUntil);
+	}
+	transactionManager.lastCommitted = transactionManager.reservedUntil;
+	return persistCommitPoint(transactionManager.lastCommitted, 1);
 }
 
-int determineAttributeDataType(Attribute attribute[], int *totalAttribute, char attributeType[])
+int initTransactionManager(int versionedTableAmount)
 {
-	if (strcasecmp(attributeType, "INT") == 0)
+	memset(&transactionManager, 0, sizeof(transactionManager));
+	transactionManager.activeSnapshotCapacity = __ACTIVE_SNAPSHOT_CAPACITY;
+	transactionManager.activeSnapshot = malloc(sizeof(long long int) * transactionManager.activeSnapshotCapacity);
+	
+	char filePath[1024];
+	transactionFilePath(filePath);
+	FILE *transactionFile = fopen(filePath, "r");
+	if (transactionFile == NULL && errno == ENOENT && versionedTableAmount == 0)
 	{
-		attribute[*totalAttribute].type = INT;
-		attribute[*totalAttribute].size = sizeof(int);
+		return 
+			replaceStateFile(filePath, &transactionManager.reservedUntil, sizeof(transactionManager.reservedUntil), 1) && 
+			loadCommitPoint(versionedTableAmount);
 	}
-	else if (strcasecmp(attributeType, "LONG") == 0)
+	if (transactionFile == NULL)
 	{
-		attribute[*totalAttribute].type = LONG;
-		attribute[*totalAttribute].size = sizeof(long long int);
+		fprintf(stderr, "Cannot read %s, refusing to hand out transaction ids again\n", filePath);
+		return 0;
 	}
-	else if (strcasecmp(attributeType, "DECIMAL") == 0)
+	
+	int loaded = fread(&transactionManager.reservedUntil, sizeof(transactionManager.reservedUntil), 1, transactionFile) == 1;
+	fclose(transactionFile);
+	if (loaded == 0)
 	{
-		attribute[*totalAttribute].type = DECIMAL;
-		attribute[*totalAttribute].size = sizeof(double);
+		fprintf(stderr, "%s is truncated, refusing to hand out transaction ids again\n", filePath);
+		return 0;
 	}
-	else if (strncasecmp(attributeType, "STRING", 6) == 0)
+	return loadCommitPoint(versionedTableAmount);
+}
+
+int reserveTransactionId(long long int transaction)
+{
+	if (transaction <= transactionManager.reservedUntil)
 	{
-		attribute[*totalAttribute].type = STRING;
-		
-		int length = strlen(attributeType);
-		if (length > 6 && attributeType[6] == '(')
-		{
-			int size;
-			sscanf(attributeType + 7, "%d", &size);
-			if (size > __STRING_MAX_LENGTH) 
-			{
-				attribute[*totalAttribute].size = __STRING_MAX_LENGTH;
-			}
-			else
-			{
-				attribute[*totalAttribute].size = size;
-			}
-		}
-		else
+		return 1;
+	}
+	
+	long long int reservedUntil = transaction + __TRANSACTION_ID_RESERVE - 1;
+	char filePath[1024];
+	transactionFilePath(filePath);
+	if (replaceStateFile(filePath, &reservedUntil, sizeof(reservedUntil), 1) == 0)
+	{
+		return 0;
+	}
+	transactionManager.reservedUntil = reservedUntil;
+	return 1;
+}
+
+long long int beginWriteTransaction()
+{
+	if (transactionManager.writeDepth == 0)
+	{
+		if (reserveTransactionId(transactionManager.lastCommitted + 1) == 0)
 		{
-			attribute[*totalAttribute].size = __STRING_MAX_LENGTH;
+			return 0;
 		}
+		transactionManager.writeTransaction = transactionManager.lastCommitted + 1;
 	}
-	else if (strcasecmp(attributeType, "TIME") == 0)
+	transactionManager.writeDepth++;
+	return transactionManager.writeTransaction;
+}
+
+int endWriteTransaction(int committed, int durable)
+{
+	transactionManager.writeDepth--;
+	if (transactionManager.writeDepth > 0)
 	{
-		attribute[*totalAttribute].type = TIME;
-		attribute[*totalAttribute].size = sizeof(char) * 5;
+		return committed;
 	}
-	else if (strcasecmp(attributeType, "DATE") == 0)
+	
+	long long int transaction = transactionManager.writeTransaction;
+	transactionManager.writeTransaction = 0;
+	if (committed == 1 && persistCommitPoint(transaction, durable) == 0)
 	{
-		attribute[*totalAttribute].type = DATE;
-		attribute[*totalAttribute].size = sizeof(char) * 10;
+		committed = 0;
 	}
-	else if (strcasecmp(attributeType, "DATETIME") == 0)
+	if (committed == 0)
 	{
-		attribute[*totalAttribute].type = DATETIME;
-		attribute[*totalAttribute].size = sizeof(char) * 16;
+		appendAbortedTransactions(transaction, transaction);
 	}
-	else
+	transactionManager.lastCommitted = transaction;
+	return committed;
+}
+
+
+Snapshot acquireSnapshot()
+{
+	Snapshot snapshot = {transactionManager.lastCommitted, transactionManager.writeTransaction};
+	if (transactionManager.activeSnapshotAmount >= transactionManager.activeSnapshotCapacity)
 	{
-		return 0;
+		transactionManager.activeSnapshotCapacity *= 2;
+		transactionManager.activeSnapshot = realloc(
+			transactionManager.activeSnapshot, sizeof(long long int) * transactionManager.activeSnapshotCapacity
+		);
 	}
+	transactionManager.activeSnapshot[transactionManager.activeSnapshotAmount++] = snapshot.snapshot;
+	return snapshot;
 }
-	
-int parseAttribute(Attribute attribute[], int *totalAttribute, char str[])
+
+void releaseSnapshot(Snapshot *snapshot)
 {
-	int strLength = strlen(str);
-	*totalAttribute = 0;
-	
-	int offset = 0;
-	
-	char attributeType[32];
-	int stateInserted = 0;
-	
-	for (int i = 0; i < strLength; i++)
+	for (int i = 0; i < transactionManager.activeSnapshotAmount; i++)
 	{
-		if (str[i] == ' ' || str[i] == ',')
+		if (transactionManager.activeSnapshot[i] == snapshot->snapshot)
 		{
-			if (stateInserted == 0)
-			{
-				memset(&(attribute[*totalAttribute]), 0, sizeof(Attribute));
-				strncpy(attribute[*totalAttribute].attributeName, str + offset, i - offset);
-				stateInserted = 1;
-				
-				if (isStringAlphaNumeric(attribute[*totalAttribute].attributeName) == 0)
-				{
-					return 0;
-				}
-				
-				convertToLower(attribute[*totalAttribute].attributeName, strlen(attribute[*totalAttribute].attributeName));
-			}
-			else
-			{
-				memset(attributeType, 0, sizeof(attributeType));
-				strncpy(attributeType, str + offset, i - offset);
-				if (determineAttributeDataType(attribute, totalAttribute, attributeType) == 0)
-				{
-					return 0;
-				}
-				*totalAttribute += 1;
-				stateInserted = 0;
-			}
-			offset = i + 1;
-			
-			while(offset < strLength && str[offset] == ' ')
-			{
-				offset++;
-			}
-			i = offset;
+			transactionManager.activeSnapshotAmount--;
+			transactionManager.activeSnapshot[i] = transactionManager.activeSnapshot[transactionManager.activeSnapshotAmount];
+			return;
 		}
-		else if (i == strLength - 1)
+	}
+}
+
+long long int oldestActiveSnapshot()
+{
+	long long int oldest = transactionManager.lastCommitted;
+	for (int i = 0; i < transactionManager.activeSnapshotAmount; i++)
+	{
+		if (transactionManager.activeSnapshot[i] < oldest)
 		{
-			if (stateInserted == 0)
-			{
-				return 0;
-			}
-			strncpy(attributeType, str + offset, i - offset + 1);
-			
-			if (determineAttributeDataType(attribute, totalAttribute, attributeType) == 0)
-			{
-				return 0;
-			}
-			*totalAttribute += 1;
+			oldest = transactionManager.activeSnapshot[i];
 		}
 	}
-	
-	return 1; 
+	return oldest;
 }
 
-int createDatabaseRoot()
-{ 
-	DIR *databaseDirectory = opendir(__DATABASE_ROOT);
-	if (databaseDirectory == NULL)
+int isRecordVisible(char *record, Snapshot *snapshot)
+{
+	BLOCKFLAG flag;
+	memcpy(&flag, record, sizeof(flag));
+	if (flag != FILLED)
 	{
-		mkdir(__DATABASE_ROOT, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
-		createDatabase("admin");
-		
-		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
-		int attributeAmount = 0;
-		char tableCreateAttributeString[256];
-		sprintf(tableCreateAttributeString, "id INT, username STRING(64), password STRING(64)");
-		if (parseAttribute(attribute, &attributeAmount, tableCreateAttributeString) == 1)
+		return 0;
+	}
+	
+	long long int createdTransaction;
+	long long int deletedTransaction;
+	readRecordVersion(record, &createdTransaction, &deletedTransaction);
+	
+	if (
+		(createdTransaction > snapshot->snapshot && createdTransaction != snapshot->transaction) || 
+		(transactionManager.abortedAmount > 0 && isTransactionAborted(createdTransaction))
+	)
+	{
+		return 0;
+	}
+	if (
+		deletedTransaction != 0 && 
+		(deletedTransaction <= snapshot->snapshot || deletedTransaction == snapshot->transaction) && 
+		(transactionManager.abortedAmount == 0 || isTransactionAborted(deletedTransaction) == 0)
+	)
+	{
+		return 0;
+	}
+	return 1;
+}
+
+int isVersionReclaimable(long long int createdTransaction, long long int deletedTransaction, long long int horizon)
+{
+	if (transactionManager.abortedAmount > 0 && isTransactionAborted(createdTransaction))
+	{
+		return 1;
+	}
+	return 
+		deletedTransaction != 0 && deletedTransaction <= horizon && 
+		(transactionManager.abortedAmount == 0 || isTransactionAborted(deletedTransaction) == 0);
+}
+
+int isRecordReclaimable(char *record, long long int horizon)
+{
+	BLOCKFLAG flag;
+	memcpy(&flag, record, sizeof(flag));
+	if (flag != FILLED)
+	{
+		return 1;
+	}
+	
+	long long int createdTransaction;
+	long long int deletedTransaction;
+	readRecordVersion(record, &createdTransaction, &deletedTransaction);
+	return isVersionReclaimable(createdTransaction, deletedTransaction, horizon);
+}
+
+ssize_t transferAsyncRequest(AsyncRequest *request, size_t transferred)
+{
+	while (transferred < request->size)
+	{
+		ssize_t amount;
+		if (request->operation == ASYNC_READ)
 		{
-			createTable("admin", "account", attributeAmount, attribute);
+			amount = pread(
+				request->fileDescriptor, request->buffer + transferred, request->size - transferred, 
+				request->offset + transferred
+			);
 		}
-		
-		
-		attributeAmount = 0;
-		sprintf(tableCreateAttributeString, "id INT, name STRING(64)");
-		if (parseAttribute(attribute, &attributeAmount, tableCreateAttributeString) == 1)
+		else
 		{
-			createTable("admin", "database", attributeAmount, attribute);
+			amount = pwrite(
+				request->fileDescriptor, request->buffer + transferred, request->size - transferred, 
+				request->offset + transferred
+			);
 		}
 		
-		attributeAmount = 0;
-		sprintf(tableCreateAttributeString, "accountid INT, databaseID INT");
-		if (parseAttribute(attribute, &attributeAmount, tableCreateAttributeString) == 1)
+		if (amount < 0 && errno == EINTR)
 		{
-			createTable("admin", "database_permission", attributeAmount, attribute);
+			continue;
 		}
-		
-		return 1;
+		if (amount <= 0)
+		{
+			break;
+		}
+		transferred += amount;
 	}
-	return 0;
+	return transferred;
 }
 
-int insertIntoDatabaseTable(char database[], char table[], RecordBlock *newRecordBlock)
-{	
-	char filePath[1024];
-	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
-	FILE *tableFile = fopen(filePath, "r+");
+int enterAsyncIoRing(unsigned int toSubmit, unsigned int minComplete, unsigned int flags)
+{
+#ifdef __NR_io_uring_enter
+	int result;
+	do
+	{
+		result = syscall(__NR_io_uring_enter, asyncIo.ringFileDescriptor, toSubmit, minComplete, flags, NULL, 0);
+	}
+	while (result < 0 && errno == EINTR);
 	
-	if (tableFile == NULL)
+	if (result > 0)
+	{
+		asyncIo.unsubmitted -= result;
+	}
+	return result;
+#else
+	return -1;
+#endif
+}
+
+int setupAsyncIoRing(unsigned int depth)
+{
+#ifdef __NR_io_uring_setup
+	struct io_uring_params params;
+	memset(&params, 0, sizeof(params));
+	int ringFileDescriptor = syscall(__NR_io_uring_setup, depth, &params);
+	if (ringFileDescriptor < 0)
 	{
 		return 0;
 	}
 	
-	int tableData[3];
-	fread(tableData, sizeof(tableData[0]), 3, tableFile);
+	asyncIo.submissionRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned int);
+	asyncIo.completionRingSize = params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+	if (params.features & IORING_FEAT_SINGLE_MMAP)
+	{
+		if (asyncIo.completionRingSize > asyncIo.submissionRingSize)
+		{
+			asyncIo.submissionRingSize = asyncIo.completionRingSize;
+		}
+		asyncIo.completionRingSize = asyncIo.submissionRingSize;
+	}
 	
-	fseek(tableFile, sizeof(AttributeBlock) * tableData[0], SEEK_CUR);
+	asyncIo.submissionRing = mmap(
+		NULL, asyncIo.submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, 
+		ringFileDescriptor, IORING_OFF_SQ_RING
+	);
+	if (asyncIo.submissionRing == MAP_FAILED)
+	{
+		close(ringFileDescriptor);
+		return 0;
+	}
 	
-	RecordBlock reader;
-	initRecordBlock(&reader, tableData[2]);
-	size_t recordBlockMemorySize = sizeOfRecordBlock(newRecordBlock);
+	asyncIo.completionRing = asyncIo.submissionRing;
+	if ((params.features & IORING_FEAT_SINGLE_MMAP) == 0)
+	{
+		asyncIo.completionRing = mmap(
+			NULL, asyncIo.completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, 
+			ringFileDescriptor, IORING_OFF_CQ_RING
+		);
+		if (asyncIo.completionRing == MAP_FAILED)
+		{
+			munmap(asyncIo.submissionRing, asyncIo.submissionRingSize);
+			close(ringFileDescriptor);
+			return 0;
+		}
+	}
 	
-	while(freadRecordBlock(&reader, tableFile) == 1)
+	asyncIo.submissionEntrySize = params.sq_entries * sizeof(struct io_uring_sqe);
+	asyncIo.submissionEntry = mmap(
+		NULL, asyncIo.submissionEntrySize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, 
+		ringFileDescriptor, IORING_OFF_SQES
+	);
+	if (asyncIo.submissionEntry == MAP_FAILED)
 	{
-		if (reader.flag == EMPTY) {
-			fseek(tableFile, -recordBlockMemorySize, SEEK_CUR); 
-			break;
+		if (asyncIo.completionRing != asyncIo.submissionRing)
+		{
+			munmap(asyncIo.completionRing, asyncIo.completionRingSize);
 		}
+		munmap(asyncIo.submissionRing, asyncIo.submissionRingSize);
+		close(ringFileDescriptor);
+		return 0;
 	}
-	delRecordBlock(&reader);
 	
-	fwriteRecordBlock(newRecordBlock, tableFile);
+	char *submissionRing = asyncIo.submissionRing;
+	asyncIo.submissionHead = (unsigned int *)(submissionRing + params.sq_off.head);
+	asyncIo.submissionTail = (unsigned int *)(submissionRing + params.sq_off.tail);
+	asyncIo.submissionMask = (unsigned int *)(submissionRing + params.sq_off.ring_mask);
+	asyncIo.submissionArray = (unsigned int *)(submissionRing + params.sq_off.array);
+	asyncIo.submissionEntryAmount = params.sq_entries;
 	
-	fseek(tableFile, 0, SEEK_SET);
-	tableData[1]++;
-	fwrite(tableData, sizeof(int), 3, tableFile);
+	char *completionRing = asyncIo.completionRing;
+	asyncIo.completionHead = (unsigned int *)(completionRing + params.cq_off.head);
+	asyncIo.completionTail = (unsigned int *)(completionRing + params.cq_off.tail);
+	asyncIo.completionMask = (unsigned int *)(completionRing + params.cq_off.ring_mask);
+	asyncIo.completionEntry = (struct io_uring_cqe *)(completionRing + params.cq_off.cqes);
 	
-	fclose(tableFile);
-
+	asyncIo.ringFileDescriptor = ringFileDescriptor;
+	asyncIo.unsubmitted = 0;
+	asyncIo.inFlight = 0;
 	return 1;
+#else
+	return 0;
+#endif
 }
 
-int readTableAttribute(char database[], char table[], int *totalAttribute, Attribute attribute[], int *recordBlockSize)
-{	
-	char filePath[1024];
-	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
-	FILE *tableFile = fopen(filePath, "r");
-	
-	*totalAttribute = 0;
+void reapAsyncCompletions()
+{
+	unsigned int head = *asyncIo.completionHead;
+	unsigned int tail = __atomic_load_n(asyncIo.completionTail, __ATOMIC_ACQUIRE);
 	
-	if (recordBlockSize != NULL)
+	while (head != tail)
 	{
-		*recordBlockSize = 0;
+		struct io_uring_cqe *completion = &asyncIo.completionEntry[head & *asyncIo.completionMask];
+		AsyncRequest *request = (AsyncRequest *)(uintptr_t)completion->user_data;
+		request->result = completion->res;
+		head++;
+		
+		if (request->result < 0 || (size_t)request->result < request->size)
+		{
+			request->result = transferAsyncRequest(request, request->result > 0 ? request->result : 0);
+		}
+		request->done = 1;
+		asyncIo.inFlight--;
 	}
-	
-	if (tableFile != NULL)
+	__atomic_store_n(asyncIo.completionHead, head, __ATOMIC_RELEASE);
+}
+
+void *asyncIoWorker(void *argument)
+{
+	(void)argument;
+	pthread_mutex_lock(&asyncIo.lock);
+	while (1)
 	{
-		int tableData[3];
-		fread(tableData, sizeof(int), 3, tableFile);
-		
-		if (recordBlockSize != NULL)
+		while (asyncIo.queueHead == NULL)
 		{
-			*recordBlockSize = tableData[2];
+			pthread_cond_wait(&asyncIo.requestReady, &asyncIo.lock);
 		}
 		
-		AttributeBlock attributeBlock[tableData[0]];
-		fread(attributeBlock, sizeof(attributeBlock[0]), tableData[0], tableFile);
-		
-		*totalAttribute = tableData[0];
-		
-		for (int i = 0; i < tableData[0]; i++)
+		AsyncRequest *request = asyncIo.queueHead;
+		asyncIo.queueHead = request->queueNext;
+		if (asyncIo.queueHead == NULL)
 		{
-			memcpy(&attribute[i], &(attributeBlock[i].attribute), sizeof(Attribute));
+			asyncIo.queueTail = NULL;
 		}
+		pthread_mutex_unlock(&asyncIo.lock);
 		
-		fclose(tableFile);
+		ssize_t result = transferAsyncRequest(request, 0);
 		
-		return 1;
+		pthread_mutex_lock(&asyncIo.lock);
+		request->result = result;
+		request->done = 1;
+		pthread_cond_broadcast(&asyncIo.requestDone);
 	}
-	return 0;
+	return NULL;
 }
 
-int insertIntoDatabaseScript(ParsedStringQueue **queue, AccountData *clientAccount)
+void initAsyncIo()
 {
-	if (clientAccount->openningDatabase == 1)
+	if (setupAsyncIoRing(__ASYNC_IO_QUEUE_DEPTH) == 1)
 	{
-		char tableName[64];
-		strcpy(tableName, (*queue)->parsedString);
-		convertToLower(tableName, strlen(tableName));
-		
-		popParsedStringQueue(queue);
-		
-		char filePath[1024];
-		sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, clientAccount->databaseName, tableName);
-		FILE *tableFile = fopen(filePath, "r");
-		
-		if (tableFile != NULL && *queue != NULL)
-		{
-			Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
-			int totalAttribute = 0;
-			int recordBlockSize = 0;
-			if (readTableAttribute(clientAccount->databaseName, tableName, &totalAttribute, attribute, &recordBlockSize) == 1)
-			{
-				RecordBlock recordBlockForNewData;
-				initRecordBlock(&recordBlockForNewData, recordBlockSize);
-				int recordBlockDataOffset = 0;
-				
-				int result = 1;
-				
-				int strLength = strlen((*queue)->parsedString);
-				char *stringRecordData = (*queue)->parsedString;
-				int stringRecordDataOffset = 0;
-				int flagSingleQuote = 0;
-				
-				for (int i = 0; i < strLength; i++)
-				{
-					if (stringRecordData[i] == '\'')
-					{
-						if (flagSingleQuote == 0)
-						{
-							flagSingleQuote = 1;
-						}
-						else
-						{
-							flagSingleQuote = 0;
-						}
-						stringRecordData[i] = '\0';
-					}
-					else if ((stringRecordData[i] == ' ' || stringRecordData[i] == ',') && flagSingleQuote == 0)
-					{
-						stringRecordData[i] = '\0';
-					}
-				}
-				
-				while(stringRecordDataOffset < strLength && stringRecordData[stringRecordDataOffset] == '\0')
-				{
-					stringRecordDataOffset++;
-				}
-				
-				for (int i = 0; i < totalAttribute && result == 1 && stringRecordDataOffset < strLength; i++)
-				{
-					if (
-						attribute[i].type == STRING || attribute[i].type == TIME || 
-						attribute[i].type == DATE || attribute[i].type == DATETIME
-					)
-					{	
-						int stringLength = strlen(stringRecordData + stringRecordDataOffset);
-						memcpy(
-							recordBlockForNewData.data + recordBlockDataOffset, stringRecordData + stringRecordDataOffset, 
-							attribute[i].size < stringLength ? attribute[i].size : stringLength
-						);
-					}
-					else 
-					{
-						if (attribute[i].type == INT)
-						{
-							int data = 0;
-							result = sscanf(stringRecordData + stringRecordDataOffset, "%d", &data);
-							memcpy(recordBlockForNewData.data + recordBlockDataOffset, &data, sizeof(data));
-						}
-						else if (attribute[i].type == LONG)
-						{
-							long long int data = 0;
-							result = sscanf(stringRecordData + stringRecordDataOffset, "%lld", &data);
-							memcpy(recordBlockForNewData.data + recordBlockDataOffset, &data, sizeof(data));
-						}
-						else if (attribute[i].type == DECIMAL)
-						{
-							double data = 0;
-							result = sscanf(stringRecordData + stringRecordDataOffset, "%lf", &data);
-							memcpy(recordBlockForNewData.data + recordBlockDataOffset, &data, sizeof(data));
-						}
-					}
-					
-					while(stringRecordDataOffset < strLength && stringRecordData[stringRecordDataOffset] != '\0')
-					{
-						stringRecordDataOffset++;
-					}
-					while(stringRecordDataOffset < strLength && stringRecordData[stringRecordDataOffset] == '\0')
-					{
-						stringRecordDataOffset++;
-					}
-					recordBlockDataOffset += attribute[i].size;
-				}
-				
-				if (result == 1)
-				{
-					insertIntoDatabaseTable(clientAccount->databaseName, tableName, &recordBlockForNewData);
-				}
-				
-				delRecordBlock(&recordBlockForNewData);
-				return result;
-			}
-		}
+		asyncIo.backend = ASYNC_IO_URING;
+		return;
 	}
-	return 0;
+	
+	pthread_mutex_init(&asyncIo.lock, NULL);
+	pthread_cond_init(&asyncIo.requestReady, NULL);
+	pthread_cond_init(&asyncIo.requestDone, NULL);
+	asyncIo.queueHead = NULL;
+	asyncIo.queueTail = NULL;
+	
+	int workerAmount = 0;
+	while (workerAmount < __ASYNC_IO_THREADS && pthread_create(&asyncIo.worker[workerAmount], NULL, asyncIoWorker, NULL) == 0)
+	{
+		pthread_detach(asyncIo.worker[workerAmount]);
+		workerAmount++;
+	}
+	asyncIo.backend = workerAmount > 0 ? ASYNC_IO_THREAD_POOL : ASYNC_IO_SYNCHRONOUS;
 }
 
-int parseAttributeAndGetValueFromString(char parsedAttribute[], Attribute attribute[], int totalAttribute, void **value, char str[])
+void flushAsyncSubmissions()
 {
-	int strLength = strlen(str);		
-	int offset = 0;
-	int attributeParsed = 0;
+	if (asyncIo.backend == ASYNC_IO_URING && asyncIo.unsubmitted > 0)
+	{
+		enterAsyncIoRing(asyncIo.unsubmitted, 0, 0);
+	}
+}
+
+void submitAsyncRequest(AsyncRequest *request)
+{
+	request->done = 0;
+	request->result = 0;
+	request->queueNext = NULL;
 	
-	for (int i = 0; i < strLength; i++)
+	if (asyncIo.backend == ASYNC_IO_URING)
 	{
-		if (str[i] == '=')
+		while (asyncIo.inFlight >= asyncIo.submissionEntryAmount)
 		{
-			attributeParsed = 1;
-			str[i]	= '\0';
+			enterAsyncIoRing(asyncIo.unsubmitted, 1, IORING_ENTER_GETEVENTS);
+			reapAsyncCompletions();
 		}
-		else if (str[i] == '\'')
+		
+		unsigned int tail = *asyncIo.submissionTail;
+		unsigned int index = tail & *asyncIo.submissionMask;
+		struct io_uring_sqe *entry = &asyncIo.submissionEntry[index];
+		memset(entry, 0, sizeof(*entry));
+		entry->opcode = request->operation == ASYNC_READ ? IORING_OP_READ : IORING_OP_WRITE;
+		entry->fd = request->fileDescriptor;
+		entry->addr = (uintptr_t)request->buffer;
+		entry->len = request->size;
+		entry->off = request->offset;
+		entry->user_data = (uintptr_t)request;
+		
+		asyncIo.submissionArray[index] = index;
+		__atomic_store_n(asyncIo.submissionTail, tail + 1, __ATOMIC_RELEASE);
+		asyncIo.unsubmitted++;
+		asyncIo.inFlight++;
+	}
+	else if (asyncIo.backend == ASYNC_IO_THREAD_POOL)
+	{
+		pthread_mutex_lock(&asyncIo.lock);
+		if (asyncIo.queueTail != NULL)
 		{
-			str[i]	= '\0';
+			asyncIo.queueTail->queueNext = request;
 		}
-		else if (str[i] == ' ' && attributeParsed == 0)
+		else
 		{
-			str[i]	= '\0';
+			asyncIo.queueHead = request;
 		}
+		asyncIo.queueTail = request;
+		pthread_cond_signal(&asyncIo.requestReady);
+		pthread_mutex_unlock(&asyncIo.lock);
 	}
-	
-	strcpy(parsedAttribute, str);
-	convertToLower(parsedAttribute, strlen(parsedAttribute));
-	
-	while(str[offset] != '\0' && offset < strLength)
+	else
 	{
-		offset++;
+		request->result = transferAsyncRequest(request, 0);
+		request->done = 1;
 	}
-	while(str[offset] == '\0' && offset < strLength)
+}
+
+void waitAsyncRequest(AsyncRequest *request)
+{
+	if (asyncIo.backend == ASYNC_IO_URING)
 	{
-		offset++;
+		reapAsyncCompletions();
+		while (request->done == 0)
+		{
+			if (enterAsyncIoRing(asyncIo.unsubmitted, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EBUSY)
+			{
+				break;
+			}
+			reapAsyncCompletions();
+		}
 	}
-	
-	if (offset >= strLength)
+	else if (asyncIo.backend == ASYNC_IO_THREAD_POOL)
 	{
-		return 0;
+		pthread_mutex_lock(&asyncIo.lock);
+		while (request->done == 0)
+		{
+			pthread_cond_wait(&asyncIo.requestDone, &asyncIo.lock);
+		}
+		pthread_mutex_unlock(&asyncIo.lock);
+	}
+}
+
+void drainAsyncWrites()
+{
+	size_t bufferOffset = 0;
+	for (int i = 0; i < asyncIo.pendingWriteAmount; i++)
+	{
+		asyncIo.pendingWrite[i].buffer = asyncIo.writeBuffer + bufferOffset;
+		bufferOffset += asyncIo.pendingWrite[i].size;
+		submitAsyncRequest(&asyncIo.pendingWrite[i]);
 	}
+	flushAsyncSubmissions();
 	
-	int deletedValueAttributeIndex = -1;
-	for (int i = 0; i < totalAttribute && deletedValueAttributeIndex == -1; i++)
+	for (int i = 0; i < asyncIo.pendingWriteAmount; i++)
 	{
-		if (strcmp(parsedAttribute, attribute[i].attributeName) == 0)
+		waitAsyncRequest(&asyncIo.pendingWrite[i]);
+		if (asyncIo.pendingWrite[i].result != (ssize_t)asyncIo.pendingWrite[i].size)
 		{
-			deletedValueAttributeIndex = i;
+			asyncIo.writeFailed = 1;
 		}
 	}
-	
-	if (deletedValueAttributeIndex != -1)
-	{
-		*value = malloc(attribute[deletedValueAttributeIndex].size);
-		memset(*value, 0, attribute[deletedValueAttributeIndex].size);
-		
-		DataType deletedAttributeType = attribute[deletedValueAttributeIndex].type;
-		
-		if (
-			deletedAttributeType == STRING || deletedAttributeType == TIME || 
-			deletedAttributeType == DATE || deletedAttributeType == DATETIME
-		)
-		{
-			strcpy(*value, str + offset);
-		}
-		else if (deletedAttributeType == INT)
-		{
-			int data;
-			sscanf(str + offset, "%d", &data);
-			memcpy(*value, &data, sizeof(data));
-		}
-		else if (deletedAttributeType == LONG)
-		{
-			long long int data;
-			sscanf(str + offset, "%lld", &data);
-			memcpy(*value, &data, sizeof(data));
-		}
-		else if (deletedAttributeType == DECIMAL)
-		{
-			double data;
-			sscanf(str + offset, "%lf", &data);
-			memcpy(*value, &data, sizeof(data));
-		}
-		
-		return 1;
-	}
-	
-	return 0;
+	asyncIo.pendingWriteAmount = 0;
+	asyncIo.writeBufferSize = 0;
 }
 
-int selectReadTable(
-	char database[], char table[], RecordBlockVector *records, Attribute attribute[], int *attributeTotal, 
-	int *recordBlockSize, char *whereAttr, void *whereValue
-)
-{	
-	char filePath[1024];
-	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
-	FILE *tableFile = fopen(filePath, "r");
-	
-	if (tableFile == NULL)
+int waitAsyncWrites()
+{
+	drainAsyncWrites();
+	int succeeded = asyncIo.writeFailed == 0;
+	asyncIo.writeFailed = 0;
+	return succeeded;
+}
+
+void submitAsyncWrite(int fileDescriptor, const void *data, size_t size, off_t offset)
+{
+	if (
+		asyncIo.pendingWriteAmount >= __ASYNC_IO_MAX_PENDING_WRITES || 
+		asyncIo.writeBufferSize + size > __ASYNC_IO_MAX_PENDING_BYTES
+	)
 	{
-		return 0;
+		drainAsyncWrites();
 	}
 	
-	*attributeTotal = 0;
-	*recordBlockSize = 0;
-	
-	int tableData[3];
-	fread(tableData, sizeof(tableData[0]), 3, tableFile);
-	
-	*attributeTotal = 0;
-	AttributeBlock attributeBlock[tableData[0]];
-	AttributeBlock reader;
-	for (int i = 0; i < tableData[0]; i++)
+	if (asyncIo.writeBufferSize + size > asyncIo.writeBufferCapacity)
 	{
-		fread(&reader, sizeof(reader), 1, tableFile);
-		if (reader.flag == FILLED)
+		while (asyncIo.writeBufferSize + size > asyncIo.writeBufferCapacity)
 		{
-			memcpy(&(attributeBlock[*attributeTotal]), &reader, sizeof(reader));
-			memcpy(&(attribute[*attributeTotal]), &(attributeBlock[*attributeTotal].attribute), sizeof(Attribute));
-			*attributeTotal += 1;
+			asyncIo.writeBufferCapacity = asyncIo.writeBufferCapacity > 0 ? asyncIo.writeBufferCapacity * 2 : 65536;
 		}
+		asyncIo.writeBuffer = realloc(asyncIo.writeBuffer, asyncIo.writeBufferCapacity);
 	}
+	memcpy(asyncIo.writeBuffer + asyncIo.writeBufferSize, data, size);
+	asyncIo.writeBufferSize += size;
 	
-	int whereIndex = -1;
-	if (whereAttr != NULL)
+	AsyncRequest *last = asyncIo.pendingWriteAmount > 0 ? &asyncIo.pendingWrite[asyncIo.pendingWriteAmount - 1] : NULL;
+	if (last != NULL && last->fileDescriptor == fileDescriptor && last->offset + (off_t)last->size == offset)
 	{
-		int error = 1;
-		for(int i = 0; i < *attributeTotal && error != 0; i++)
-		{
-			if (strcmp(whereAttr, attribute[i].attributeName) == 0)
-			{
-				whereIndex = i;
-				error = 0;
-			}
-		}
-		if (error != 0)
-		{
-			return 0;
-		}
+		last->size += size;
+		return;
 	}
 	
-	int whereOffsetBytePosition = 0;
-	*recordBlockSize = tableData[2];
-	for (int i = 0; i < *attributeTotal; i++)
+	if (asyncIo.pendingWriteAmount == asyncIo.pendingWriteCapacity)
 	{
-		if (i < whereIndex)
-		{
-			whereOffsetBytePosition += attribute[i].size;
-		}
+		asyncIo.pendingWriteCapacity = asyncIo.pendingWriteCapacity > 0 ? asyncIo.pendingWriteCapacity * 2 : 16;
+		asyncIo.pendingWrite = realloc(asyncIo.pendingWrite, sizeof(AsyncRequest) * asyncIo.pendingWriteCapacity);
 	}
-	
-	fseek(tableFile, sizeof(tableData) + tableData[0] * sizeof(AttributeBlock), SEEK_SET);
-	
-	RecordBlock recordBlockData;
-	int recordBlockSizeMemory = *recordBlockSize + sizeof(BLOCKFLAG) + sizeof(int);
-	char recordByte[recordBlockSizeMemory];
-	size_t offsetDataByte = sizeof(BLOCKFLAG) + sizeof(int);
-	whereOffsetBytePosition += offsetDataByte;
-	
-	while(fread(recordByte, sizeof(char), recordBlockSizeMemory, tableFile) == recordBlockSizeMemory)
+	AsyncRequest *request = &asyncIo.pendingWrite[asyncIo.pendingWriteAmount++];
+	request->operation = ASYNC_WRITE;
+	request->fileDescriptor = fileDescriptor;
+	request->buffer = NULL;
+	request->size = size;
+	request->offset = offset;
+}
+
+void initDynamicBlock(DynamicBlock *dBlock)
+{
+	dBlock->block = malloc(sizeof(char) * 2);
+	dBlock->size = 0;
+	dBlock->capacity = 2;
+}
+
+void delDynamicBlock(DynamicBlock *dBlock)
+{
+	free(dBlock->block);
+}
+
+void concatDynamicBlock(DynamicBlock *dBlock, const void *block, size_t size)
+{
+	while (dBlock->size + size > dBlock->capacity)
 	{
-		if (whereAttr != NULL && memcmp(recordByte + whereOffsetBytePosition, whereValue, attribute[whereIndex].size) == 0)
-		{
-			initRecordBlock(&recordBlockData, *recordBlockSize);
-			memcpy(&recordBlockData, recordByte, offsetDataByte);
-			memcpy(recordBlockData.data, recordByte + offsetDataByte, *recordBlockSize);
-			appendRecordBlockVector(records, &recordBlockData);
-		}
-		else if (whereAttr == NULL)
-		{
-			initRecordBlock(&recordBlockData, *recordBlockSize);
-			memcpy(&recordBlockData, recordByte, offsetDataByte);
-			memcpy(recordBlockData.data, recordByte + offsetDataByte, *recordBlockSize);
-			appendRecordBlockVector(records, &recordBlockData);
-		}
+		dBlock->capacity *= 2;
+		void *newBlock = malloc(sizeof(char) * dBlock->capacity);
+		memset(newBlock, 0, sizeof(char) * dBlock->capacity);
+		memcpy(newBlock, dBlock->block, sizeof(char) * dBlock->size);
+		
+		free(dBlock->block);
+		dBlock->block = newBlock;
 	}
 	
-	fclose(tableFile);
-	return 1;
+	memcpy(dBlock->block + dBlock->size, block, size);
+	dBlock->size += size;
 }
 
-int selectFromTableScript(ParsedStringQueue **queue, AccountData *clientAccount, Attribute tableAttribute[], 
-	int *totalAttribute, RecordBlockVector *records, int selectedAttribute[], int *amountOfSelectedAttribute)
+void initRecordBlockVector(RecordBlockVector *vector)
 {
-	if (clientAccount->openningDatabase == 1)
+	vector->record = (RecordBlock *)malloc(sizeof(RecordBlock) * 2);
+	vector->capacity = 2;
+	vector->size = 0;
+}
+
+RecordBlock* getRecordBlockVector(RecordBlockVector *vector)
+{
+	return vector->record;
+}
+
+int sizeRecordBlockVector(RecordBlockVector *vector)
+{
+	return vector->size;
+}
+
+void delRecordBlockVector(RecordBlockVector *vector)
+{
+	for (int i = 0; i < vector->size; i++)
 	{
-		char selectedAttributeName[__MAX_ATTRIBUTE_ON_TABLE][64];
-		*totalAttribute = 0;
-		int recordBlockSize = 0;
-		
-		int returnValue = 0;
-		int fromKeywordFound = 0;
-		*amountOfSelectedAttribute = 0;
+		delRecordBlock(&(vector->record[i]));
+	}
+	free(vector->record);
+}
+
+void appendRecordBlockVector(RecordBlockVector *vector, RecordBlock *data)
+{	
+	if (vector->size >= vector->capacity)
+	{
+		vector->capacity *= 2;
+		RecordBlock *newRecordBlock = (RecordBlock *)malloc(sizeof(RecordBlock) * vector->capacity);
 		
-		while(fromKeywordFound == 0 && *queue != NULL)
+		memcpy(newRecordBlock, vector->record, sizeof(RecordBlock) * vector->size);
+
+		free(vector->record);
+		vector->record = newRecordBlock;
+	}
+	
+	vector->record[vector->size] = *data;
+	vector->size += 1;
+}
+
+void popParsedStringQueue(ParsedStringQueue **queue)
+{
+	ParsedStringQueue *next = (*queue)->next;
+	free((*queue)->parsedString);
+	free(*queue);
+	*queue = next;
+}
+
+ParsedStringQueue* parseStringSQLScript(char str[])
+{
+	int scriptLength = strlen(str);
+	int lowerBound = -1;
+	int index = 0;
+	
+	ParsedStringQueue *root = NULL;
+	ParsedStringQueue *walker = root;
+	ParsedStringQueue *newString = NULL;
+	int parentheses = 0;
+	int quotation = 0;
+	
+	
+	while(index < scriptLength)
+	{
+		if (str[index] != ' ' && str[index] != ';' && str[index] != ',') 
 		{
-			if (strcasecmp((*queue)->parsedString, "FROM") == 0)
+			if (lowerBound == -1)
 			{
-				fromKeywordFound = 1;
+				lowerBound = index;
 			}
-			else
+			
+			if (str[index] == '(' && quotation == 0)
 			{
-				strcpy(selectedAttributeName[*amountOfSelectedAttribute], (*queue)->parsedString);
-				convertToLower(
-					selectedAttributeName[*amountOfSelectedAttribute], 
-					strlen(selectedAttributeName[*amountOfSelectedAttribute])
-				);
-				*amountOfSelectedAttribute += 1;
+				parentheses++;
+			}
+			else if (str[index] == ')' && quotation == 0)
+			{
+				parentheses--;
+			}
+			else if (str[index] == '\'')
+			{
+				quotation = quotation == 1 ? 0 : 1;
 			}
-			popParsedStringQueue(queue);
 		}
-		
-		if (fromKeywordFound == 1 && *queue != NULL)
+		else if ((parentheses == 0 && quotation == 0) && lowerBound >= 0)
 		{
-			char tableName[64];
-			strcpy(tableName, (*queue)->parsedString);
-			convertToLower(tableName, strlen(tableName));
+			newString = (ParsedStringQueue *)malloc(sizeof(ParsedStringQueue));
+			newString->next = NULL;
 			
-			popParsedStringQueue(queue);
+			if (str[lowerBound] == '(')
+			{
+				lowerBound++;
+				index--;
+			}
 			
-			if (*queue != NULL)
+			newString->parsedString = malloc(sizeof(char) * (index - lowerBound + 1));
+			memset(newString->parsedString, 0, sizeof(char) * (index - lowerBound + 1));
+			strncpy(newString->parsedString, str + lowerBound, (index - lowerBound));
+			
+			if (root == NULL)
 			{
-				if (strcasecmp((*queue)->parsedString, "WHERE") == 0)
-				{
-					popParsedStringQueue(queue);
-					
-					if (*queue != NULL)
-					{
-						if (
-							readTableAttribute(
-								clientAccount->databaseName, tableName, totalAttribute, tableAttribute, &recordBlockSize
-							) == 1
-						)
-						{
-							char whereAttribute[64];
-							void *whereValue = NULL;
-							
-							if (parseAttributeAndGetValueFromString(whereAttribute, tableAttribute, *totalAttribute, &whereValue, (*queue)->parsedString) == 1)
-							{
-								*totalAttribute = 0;
-								selectReadTable(
-									clientAccount->databaseName, tableName, records, tableAttribute, totalAttribute, 
-									&recordBlockSize, whereAttribute, whereValue
-								);
-								returnValue = 1;
-								
-								free(whereValue);
-							}
-						}
-					}
-				}
+				root = newString;
+				walker = newString;
 			}
 			else
 			{
-				selectReadTable(
-					clientAccount->databaseName, tableName, records, tableAttribute, totalAttribute, 
-					&recordBlockSize, NULL, NULL
-				);
-				returnValue = 1;
+				walker->next = newString;
+				walker = newString;
 			}
 			
-			if (returnValue == 1)
-			{
-				int attributeFound = 0;
-				for (int i = 0; i < *amountOfSelectedAttribute; i++)
-				{
-					if (strcmp(selectedAttributeName[i], "*") == 0)
-					{
-						for (int j = 0; j < *totalAttribute; j++)
-						{
-							selectedAttribute[j] = j;
-						}
-						*amountOfSelectedAttribute = *totalAttribute;
-						attributeFound = *totalAttribute;
-						break;
-					}
-					for (int j = 0; j < *totalAttribute; j++)
-					{
-						if (strcmp(selectedAttributeName[i], tableAttribute[j].attributeName) == 0)
-						{
-							selectedAttribute[i] = j;
-							attributeFound += 1;
-							break;
-						}					
-					}
-				}
-				
-				if (attributeFound != *amountOfSelectedAttribute)
-				{
-					returnValue = 0;
-				}
-			}
+			lowerBound = -1;
 		}
 		
-		return returnValue;
+		index++;
 	}
-	return 0;
+	
+	return root;
 }
 
-
+int isStringAlphaNumeric(char str[])
+{
+	int length = strlen(str);
+	for (int i = 0; i < length; i++)
+	{
+		if (isalnum(str[i]) == 0)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+void convertToLower(char str[], size_t size)
+{
+	for (int i = 0; i < size; i++)
+	{
+		str[i] = tolower(str[i]);
+	}
+}
+
+int createTCPServerSocket()
+{
+	struct sockaddr_in socketAddress;
+	int socketFileDescriptor = -1;
+
+	socketFileDescriptor = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (socketFileDescriptor == -1) {
+		fprintf(stderr, "Error: [%s]\n", strerror(errno));
+		return -1;
+	}
+
+	socketAddress.sin_family = AF_INET;         
+	socketAddress.sin_port = htons(__SERVER_PORT);     
+	socketAddress.sin_addr.s_addr = INADDR_ANY; 
+
+	if (bind(socketFileDescriptor, (struct sockaddr *)&socketAddress, sizeof(struct sockaddr_in)) != 0) {
+		fprintf(stderr, "Error: [%s]\n", strerror(errno));
+		close(socketFileDescriptor);
+		return -1;
+	}
+
+	if (listen(socketFileDescriptor, 64) != 0) {
+		fprintf(stderr, "Error: [%s]\n", strerror(errno));
+		close(socketFileDescriptor);
+		return -1;
+	}
+
+	return socketFileDescriptor;
+}
+
+void setupEpollConnection(int epollFileDescriptor, int newFileDescriptor, struct epoll_event * epollEvent) 
+{
+	epollEvent->events = EPOLLIN;
+	epollEvent->data.fd = newFileDescriptor;
+
+	epoll_ctl(epollFileDescriptor, EPOLL_CTL_ADD, newFileDescriptor, epollEvent);
+}
+
+int qsortFunctionForAttribute(const void *a, const void *b)
+{
+	return strcmp( ((Attribute *)a)->attributeName, ((Attribute *)b)->attributeName );
+}
+
+int noDuplicateAttribute(int attributeAmount, Attribute attribute[])
+{
+	Attribute temp[attributeAmount];
+	memcpy(temp, attribute, sizeof(Attribute) * attributeAmount);
+	qsort(temp, attributeAmount, sizeof(Attribute), qsortFunctionForAttribute);
+	for (int i = 0; i < attributeAmount - 1; i++)
+	{
+		if (strcmp(temp[i].attributeName, temp[i+1].attributeName) == 0)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+size_t sizeOfTableFormat()
+{
+	return sizeof(int) * 2;
+}
+
+off_t tableHeaderSize(int attributeAmount)
+{
+	return sizeOfTableFormat() + sizeof(int) * 3 + (off_t)attributeAmount * sizeof(AttributeBlock);
+}
+
+int freadTableHeader(int tableData[], FILE *stream)
+{
+	int tableFormat[2];
+	if (
+		fread(tableFormat, sizeof(int), 2, stream) != 2 || 
+		tableFormat[0] != __TABLE_FILE_MAGIC || tableFormat[1] != __TABLE_FILE_VERSION || 
+		fread(tableData, sizeof(int), 3, stream) != 3
+	)
+	{
+		memset(tableData, 0, sizeof(int) * 3);
+		return 0;
+	}
+	return 1;
+}
+
+int fwriteTableHeader(int tableData[], FILE *stream)
+{
+	int tableFormat[2] = {__TABLE_FILE_MAGIC, __TABLE_FILE_VERSION};
+	return fwrite(tableFormat, sizeof(int), 2, stream) == 2 && fwrite(tableData, sizeof(int), 3, stream) == 3;
+}
+
+int createTable(char database[], char table[], int attributeAmount, Attribute attribute[])
+{
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r");
+	
+	if (tableFile == NULL && attributeAmount <= __MAX_ATTRIBUTE_ON_TABLE && noDuplicateAttribute(attributeAmount, attribute))
+	{
+		tableFile = fopen(filePath, "w");
+		
+		int tableData[3];
+		memset(tableData, 0, sizeof(int) * 3);
+		tableData[0] = attributeAmount;
+		
+		size_t attributeBlockSize = attributeAmount * sizeof(AttributeBlock);
+		void *attributeBlockArray = malloc(attributeBlockSize);
+		memset(attributeBlockArray, 0, attributeBlockSize);
+		
+		AttributeBlock attributeBlock[attributeAmount];
+		for (int i = 0; i < attributeAmount; i++)
+		{
+			attributeBlock[i].flag = FILLED;
+			attributeBlock[i].attribute = attribute[i];
+			tableData[2] += attribute[i].size;
+		}
+		memcpy(attributeBlockArray, attributeBlock, sizeof(AttributeBlock) * attributeAmount);
+		
+		fwriteTableHeader(tableData, tableFile);
+		fwrite(attributeBlockArray, sizeof(AttributeBlock), attributeAmount, tableFile);
+		
+		fclose(tableFile);
+		free(attributeBlockArray);
+		
+		return 1;
+	}
+	return 0;
+}
+
+int createDatabase(char databaseName[])
+{
+	char filePath[1024];
+	sprintf(filePath, "%s/%s", __DATABASE_ROOT, databaseName);
+	DIR *databaseDirectory = opendir(filePath);
+	if (databaseDirectory == NULL)
+	{
+		mkdir(filePath, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+		return 1;
+	}
+	
+	return 0;
+}
+
+int determineAttributeDataType(Attribute attribute[], int *totalAttribute, char attributeType[])
+{
+	if (strcasecmp(attributeType, "INT") == 0)
+	{
+		attribute[*totalAttribute].type = INT;
+		attribute[*totalAttribute].size = sizeof(int);
+	}
+	else if (strcasecmp(attributeType, "LONG") == 0)
+	{
+		attribute[*totalAttribute].type = LONG;
+		attribute[*totalAttribute].size = sizeof(long long int);
+	}
+	else if (strcasecmp(attributeType, "DECIMAL") == 0)
+	{
+		attribute[*totalAttribute].type = DECIMAL;
+		attribute[*totalAttribute].size = sizeof(double);
+	}
+	else if (strncasecmp(attributeType, "STRING", 6) == 0)
+	{
+		attribute[*totalAttribute].type = STRING;
+		
+		int length = strlen(attributeType);
+		if (length > 6 && attributeType[6] == '(')
+		{
+			int size;
+			sscanf(attributeType + 7, "%d", &size);
+			if (size > __STRING_MAX_LENGTH) 
+			{
+				attribute[*totalAttribute].size = __STRING_MAX_LENGTH;
+			}
+			else
+			{
+				attribute[*totalAttribute].size = size;
+			}
+		}
+		else
+		{
+			attribute[*totalAttribute].size = __STRING_MAX_LENGTH;
+		}
+	}
+	else if (strcasecmp(attributeType, "TIME") == 0)
+	{
+		attribute[*totalAttribute].type = TIME;
+		attribute[*totalAttribute].size = sizeof(char) * 5;
+	}
+	else if (strcasecmp(attributeType, "DATE") == 0)
+	{
+		attribute[*totalAttribute].type = DATE;
+		attribute[*totalAttribute].size = sizeof(char) * 10;
+	}
+	else if (strcasecmp(attributeType, "DATETIME") == 0)
+	{
+		attribute[*totalAttribute].type = DATETIME;
+		attribute[*totalAttribute].size = sizeof(char) * 16;
+	}
+	else
+	{
+		return 0;
+	}
+	
+	return 1;
+}
+	
+int parseAttribute(Attribute attribute[], int *totalAttribute, char str[])
+{
+	int strLength = strlen(str);
+	*totalAttribute = 0;
+	
+	int offset = 0;
+	
+	char attributeType[32];
+	int stateInserted = 0;
+	
+	for (int i = 0; i < strLength; i++)
+	{
+		if (str[i] == ' ' || str[i] == ',')
+		{
+			if (stateInserted == 0)
+			{
+				memset(&(attribute[*totalAttribute]), 0, sizeof(Attribute));
+				strncpy(attribute[*totalAttribute].attributeName, str + offset, i - offset);
+				stateInserted = 1;
+				
+				if (isStringAlphaNumeric(attribute[*totalAttribute].attributeName) == 0)
+				{
+					return 0;
+				}
+				
+				convertToLower(attribute[*totalAttribute].attributeName, strlen(attribute[*totalAttribute].attributeName));
+			}
+			else
+			{
+				memset(attributeType, 0, sizeof(attributeType));
+				strncpy(attributeType, str + offset, i - offset);
+				if (determineAttributeDataType(attribute, totalAttribute, attributeType) == 0)
+				{
+					return 0;
+				}
+				*totalAttribute += 1;
+				stateInserted = 0;
+			}
+			offset = i + 1;
+			
+			while(offset < strLength && str[offset] == ' ')
+			{
+				offset++;
+			}
+			i = offset;
+		}
+		else if (i == strLength - 1)
+		{
+			if (stateInserted == 0)
+			{
+				return 0;
+			}
+			memset(attributeType, 0, sizeof(attributeType));
+			strncpy(attributeType, str + offset, i - offset + 1);
+			
+			if (determineAttributeDataType(attribute, totalAttribute, attributeType) == 0)
+			{
+				return 0;
+			}
+			*totalAttribute += 1;
+		}
+	}
+	
+	return 1; 
+}
+
+int createDatabaseRoot()
+{ 
+	DIR *databaseDirectory = opendir(__DATABASE_ROOT);
+	if (databaseDirectory == NULL)
+	{
+		mkdir(__DATABASE_ROOT, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH);
+		createDatabase("admin");
+		
+		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+		int attributeAmount = 0;
+		char tableCreateAttributeString[256];
+		sprintf(tableCreateAttributeString, "id INT, username STRING(64), password STRING(64)");
+		if (parseAttribute(attribute, &attributeAmount, tableCreateAttributeString) == 1)
+		{
+			createTable("admin", "account", attributeAmount, attribute);
+		}
+		
+		
+		attributeAmount = 0;
+		sprintf(tableCreateAttributeString, "id INT, name STRING(64)");
+		if (parseAttribute(attribute, &attributeAmount, tableCreateAttributeString) == 1)
+		{
+			createTable("admin", "database", attributeAmount, attribute);
+		}
+		
+		attributeAmount = 0;
+		sprintf(tableCreateAttributeString, "accountid INT, databaseID INT");
+		if (parseAttribute(attribute, &attributeAmount, tableCreateAttributeString) == 1)
+		{
+			createTable("admin", "database_permission", attributeAmount, attribute);
+		}
+		
+		return 1;
+	}
+	return 0;
+}
+
+int migrateTableFile(char filePath[])
+{
+	FILE *tableFile = fopen(filePath, "r");
+	if (tableFile == NULL)
+	{
+		return -1;
+	}
+	
+	int tableFormat[2];
+	if (fread(tableFormat, sizeof(int), 2, tableFile) == 2 && tableFormat[0] == __TABLE_FILE_MAGIC)
+	{
+		fclose(tableFile);
+		return tableFormat[1] == __TABLE_FILE_VERSION ? 0 : -1;
+	}
+	
+	int tableData[3];
+	rewind(tableFile);
+	if (
+		fread(tableData, sizeof(int), 3, tableFile) != 3 || 
+		tableData[0] <= 0 || tableData[0] > __MAX_ATTRIBUTE_ON_TABLE || tableData[2] <= 0
+	)
+	{
+		fclose(tableFile);
+		return -1;
+	}
+	
+	AttributeBlock attributeBlock[tableData[0]];
+	char tempPath[1100];
+	sprintf(tempPath, "%s.migrate", filePath);
+	FILE *newFile = NULL;
+	if (
+		fread(attributeBlock, sizeof(attributeBlock[0]), tableData[0], tableFile) != (size_t)tableData[0] || 
+		(newFile = fopen(tempPath, "w")) == NULL
+	)
+	{
+		fclose(tableFile);
+		return -1;
+	}
+	
+	int failed = 
+		fwriteTableHeader(tableData, newFile) == 0 || 
+		fwrite(attributeBlock, sizeof(attributeBlock[0]), tableData[0], newFile) != (size_t)tableData[0];
+	
+	RecordBlock record;
+	initRecordBlock(&record, tableData[2]);
+	while (
+		failed == 0 && 
+		fread(&record.flag, sizeof(record.flag), 1, tableFile) == 1 && 
+		fread(&record.size, sizeof(record.size), 1, tableFile) == 1 && 
+		fread(record.data, tableData[2], 1, tableFile) == 1
+	)
+	{
+		record.size = tableData[2];
+		failed = fwriteRecordBlock(&record, newFile) != 5;
+	}
+	delRecordBlock(&record);
+	fclose(tableFile);
+	
+	if (fflush(newFile) != 0 || fsync(fileno(newFile)) != 0)
+	{
+		failed = 1;
+	}
+	if (fclose(newFile) != 0 || failed == 1 || rename(tempPath, filePath) != 0)
+	{
+		remove(tempPath);
+		return -1;
+	}
+	return 1;
+}
+
+int migrateDatabaseRoot()
+{
+	DIR *rootDirectory = opendir(__DATABASE_ROOT);
+	if (rootDirectory == NULL)
+	{
+		return 0;
+	}
+	
+	int currentAmount = 0;
+	char directoryPath[1024];
+	char filePath[2048];
+	struct stat fileStat;
+	struct dirent *databaseEntry;
+	while ((databaseEntry = readdir(rootDirectory)) != NULL && currentAmount >= 0)
+	{
+		sprintf(directoryPath, "%s/%s", __DATABASE_ROOT, databaseEntry->d_name);
+		if (databaseEntry->d_name[0] == '.' || stat(directoryPath, &fileStat) != 0 || S_ISDIR(fileStat.st_mode) == 0)
+		{
+			continue;
+		}
+		
+		DIR *databaseDirectory = opendir(directoryPath);
+		if (databaseDirectory == NULL)
+		{
+			currentAmount = -1;
+			break;
+		}
+		
+		struct dirent *entry;
+		while ((entry = readdir(databaseDirectory)) != NULL && currentAmount >= 0)
+		{
+			sprintf(filePath, "%s/%s", directoryPath, entry->d_name);
+			if (strchr(entry->d_name, '.') != NULL || stat(filePath, &fileStat) != 0 || S_ISREG(fileStat.st_mode) == 0)
+			{
+				continue;
+			}
+			
+			int migrated = migrateTableFile(filePath);
+			if (migrated == -1)
+			{
+				fprintf(stderr, "Cannot migrate table file %s to format version %d\n", filePath, __TABLE_FILE_VERSION);
+				currentAmount = -1;
+			}
+			else if (migrated == 0)
+			{
+				currentAmount++;
+			}
+		}
+		closedir(databaseDirectory);
+	}
+	closedir(rootDirectory);
+	return currentAmount;
+}
+
+unsigned int combineCompareMask(CompareOperator op, unsigned int equal, unsigned int less, unsigned int greater)
+{
+	switch (op)
+	{
+		case EQUAL:
+			return equal;
+		case NOT_EQUAL:
+			return ~equal;
+		case LESS:
+			return less;
+		case LESS_EQUAL:
+			return less | equal;
+		case GREATER:
+			return greater;
+		default:
+			return greater | equal;
+	}
+}
+
+void filterIntScalar(const void *vector, int length, CompareOperator op, int value, unsigned long long selection[])
+{
+	const int *column = (const int *)vector;
+	for (int i = 0; i < length; i++)
+	{
+		if (combineCompareMask(op, column[i] == value, column[i] < value, column[i] > value) & 1)
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+
+void filterLongScalar(const void *vector, int length, CompareOperator op, long long int value, unsigned long long selection[])
+{
+	const long long int *column = (const long long int *)vector;
+	for (int i = 0; i < length; i++)
+	{
+		if (combineCompareMask(op, column[i] == value, column[i] < value, column[i] > value) & 1)
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+
+void filterDecimalScalar(const void *vector, int length, CompareOperator op, double value, unsigned long long selection[])
+{
+	const double *column = (const double *)vector;
+	for (int i = 0; i < length; i++)
+	{
+		if (combineCompareMask(op, column[i] == value, column[i] < value, column[i] > value) & 1)
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+void filterIntSSE(const void *vector, int length, CompareOperator op, int value, unsigned long long selection[])
+{
+	const int *column = (const int *)vector;
+	__m128i needle = _mm_set1_epi32(value);
+	int i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m128i lane = _mm_loadu_si128((const __m128i *)(column + i));
+		unsigned int equal = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(lane, needle)));
+		unsigned int less = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmplt_epi32(lane, needle)));
+		unsigned int greater = _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(lane, needle)));
+		selection[i >> 6] |= (unsigned long long)(combineCompareMask(op, equal, less, greater) & 0xF) << (i & 63);
+	}
+	for (; i < length; i++)
+	{
+		if (combineCompareMask(op, column[i] == value, column[i] < value, column[i] > value) & 1)
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+
+__attribute__((target("sse4.2")))
+void filterLongSSE(const void *vector, int length, CompareOperator op, long long int value, unsigned long long selection[])
+{
+	const long long int *column = (const long long int *)vector;
+	__m128i needle = _mm_set1_epi64x(value);
+	int i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		__m128i lane = _mm_loadu_si128((const __m128i *)(column + i));
+		unsigned int equal = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpeq_epi64(lane, needle)));
+		unsigned int less = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(needle, lane)));
+		unsigned int greater = _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(lane, needle)));
+		selection[i >> 6] |= (unsigned long long)(combineCompareMask(op, equal, less, greater) & 0x3) << (i & 63);
+	}
+	for (; i < length; i++)
+	{
+		if (combineCompareMask(op, column[i] == value, column[i] < value, column[i] > value) & 1)
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+
+void filterDecimalSSE(const void *vector, int length, CompareOperator op, double value, unsigned long long selection[])
+{
+	const double *column = (const double *)vector;
+	__m128d needle = _mm_set1_pd(value);
+	int i = 0;
+	for (; i + 2 <= length; i += 2)
+	{
+		__m128d lane = _mm_loadu_pd(column + i);
+		unsigned int equal = _mm_movemask_pd(_mm_cmpeq_pd(lane, needle));
+		unsigned int less = _mm_movemask_pd(_mm_cmplt_pd(lane, needle));
+		unsigned int greater = _mm_movemask_pd(_mm_cmpgt_pd(lane, needle));
+		selection[i >> 6] |= (unsigned long long)(combineCompareMask(op, equal, less, greater) & 0x3) << (i & 63);
+	}
+	for (; i < length; i++)
+	{
+		if (combineCompareMask(op, column[i] == value, column[i] < value, column[i] > value) & 1)
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+
+__attribute__((target("avx2")))
+void filterIntAVX2(const void *vector, int length, CompareOperator op, int value, unsigned long long selection[])
+{
+	const int *column = (const int *)vector;
+	__m256i needle = _mm256_set1_epi32(value);
+	int i = 0;
+	for (; i + 8 <= length; i += 8)
+	{
+		__m256i lane = _mm256_loadu_si256((const __m256i *)(column + i));
+		unsigned int equal = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(lane, needle)));
+		unsigned int less = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(needle, lane)));
+		unsigned int greater = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(lane, needle)));
+		selection[i >> 6] |= (unsigned long long)(combineCompareMask(op, equal, less, greater) & 0xFF) << (i & 63);
+	}
+	for (; i < length; i++)
+	{
+		if (combineCompareMask(op, column[i] == value, column[i] < value, column[i] > value) & 1)
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+
+__attribute__((target("avx2")))
+void filterLongAVX2(const void *vector, int length, CompareOperator op, long long int value, unsigned long long selection[])
+{
+	const long long int *column = (const long long int *)vector;
+	__m256i needle = _mm256_set1_epi64x(value);
+	int i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m256i lane = _mm256_loadu_si256((const __m256i *)(column + i));
+		unsigned int equal = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(lane, needle)));
+		unsigned int less = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(needle, lane)));
+		unsigned int greater = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(lane, needle)));
+		selection[i >> 6] |= (unsigned long long)(combineCompareMask(op, equal, less, greater) & 0xF) << (i & 63);
+	}
+	for (; i < length; i++)
+	{
+		if (combineCompareMask(op, column[i] == value, column[i] < value, column[i] > value) & 1)
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+
+__attribute__((target("avx2")))
+void filterDecimalAVX2(const void *vector, int length, CompareOperator op, double value, unsigned long long selection[])
+{
+	const double *column = (const double *)vector;
+	__m256d needle = _mm256_set1_pd(value);
+	int i = 0;
+	for (; i + 4 <= length; i += 4)
+	{
+		__m256d lane = _mm256_loadu_pd(column + i);
+		unsigned int equal = _mm256_movemask_pd(_mm256_cmp_pd(lane, needle, _CMP_EQ_OQ));
+		unsigned int less = _mm256_movemask_pd(_mm256_cmp_pd(lane, needle, _CMP_LT_OQ));
+		unsigned int greater = _mm256_movemask_pd(_mm256_cmp_pd(lane, needle, _CMP_GT_OQ));
+		selection[i >> 6] |= (unsigned long long)(combineCompareMask(op, equal, less, greater) & 0xF) << (i & 63);
+	}
+	for (; i < length; i++)
+	{
+		if (combineCompareMask(op, column[i] == value, column[i] < value, column[i] > value) & 1)
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+#endif
+
+void releaseThreadStats(void *argument)
+{
+	pthread_mutex_lock(&statsRegistry.lock);
+	((ThreadStats *)argument)->inUse = 0;
+	pthread_mutex_unlock(&statsRegistry.lock);
+}
+
+void initServerStats()
+{
+	memset(&statsRegistry, 0, sizeof(statsRegistry));
+	pthread_mutex_init(&statsRegistry.lock, NULL);
+	pthread_key_create(&statsRegistry.key, releaseThreadStats);
+}
+
+ThreadStats *currentThreadStats()
+{
+	if (threadStats != NULL)
+	{
+		return threadStats;
+	}
+	
+	pthread_mutex_lock(&statsRegistry.lock);
+	for (int i = 0; i < statsRegistry.threadAmount && threadStats == NULL; i++)
+	{
+		if (statsRegistry.thread[i]->inUse == 0)
+		{
+			threadStats = statsRegistry.thread[i];
+		}
+	}
+	if (threadStats == NULL && statsRegistry.threadAmount < __STATS_MAX_THREADS)
+	{
+		threadStats = calloc(1, sizeof(ThreadStats));
+		if (threadStats != NULL)
+		{
+			statsRegistry.thread[statsRegistry.threadAmount++] = threadStats;
+		}
+	}
+	if (threadStats != NULL)
+	{
+		threadStats->inUse = 1;
+		pthread_setspecific(statsRegistry.key, threadStats);
+	}
+	pthread_mutex_unlock(&statsRegistry.lock);
+	
+	return threadStats;
+}
+
+void addThreadStat(unsigned long long int *counter, unsigned long long int amount)
+{
+	__atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + amount, __ATOMIC_RELAXED);
+}
+
+int latencyBucket(unsigned long long int value)
+{
+	if (value < (1ULL << __LATENCY_SUB_BUCKET_BITS))
+	{
+		return value;
+	}
+	
+	int exponent = 63 - __builtin_clzll(value);
+	int bucket = (exponent - __LATENCY_SUB_BUCKET_BITS + 1) * (1 << __LATENCY_SUB_BUCKET_BITS) + 
+		((value >> (exponent - __LATENCY_SUB_BUCKET_BITS)) & ((1ULL << __LATENCY_SUB_BUCKET_BITS) - 1));
+	return bucket < __LATENCY_HISTOGRAM_BUCKETS ? bucket : __LATENCY_HISTOGRAM_BUCKETS - 1;
+}
+
+unsigned long long int latencyBucketUpperBound(int bucket)
+{
+	int subBuckets = 1 << __LATENCY_SUB_BUCKET_BITS;
+	if (bucket < subBuckets)
+	{
+		return bucket;
+	}
+	
+	int shift = bucket / subBuckets - 1;
+	unsigned long long int lowerBound = (unsigned long long int)(subBuckets + bucket % subBuckets) << shift;
+	return lowerBound + (1ULL << shift) - 1;
+}
+
+void recordStatementStats(StatementType type, int succeeded, long long int elapsed)
+{
+	ThreadStats *stats = currentThreadStats();
+	if (stats == NULL)
+	{
+		return;
+	}
+	
+	unsigned long long int latency = elapsed > 0 ? elapsed : 0;
+	addThreadStat(&stats->statement[type], 1);
+	addThreadStat(&stats->failed[type], succeeded == 1 ? 0 : 1);
+	addThreadStat(&stats->latencySum[type], latency);
+	addThreadStat(&stats->latency[type][latencyBucket(latency)], 1);
+	if (latency > stats->latencyMax[type])
+	{
+		__atomic_store_n(&stats->latencyMax[type], latency, __ATOMIC_RELAXED);
+	}
+}
+
+void recordScanStats(long long int rows, long long int bytes)
+{
+	ThreadStats *stats = currentThreadStats();
+	if (stats != NULL && rows > 0)
+	{
+		addThreadStat(&stats->rowsScanned, rows);
+		addThreadStat(&stats->bytesScanned, bytes);
+	}
+}
+
+void recordResultCacheLookup(int hit)
+{
+	ThreadStats *stats = currentThreadStats();
+	if (stats != NULL)
+	{
+		addThreadStat(hit == 1 ? &stats->resultCacheHit : &stats->resultCacheMiss, 1);
+	}
+}
+
+void recordConnection(int opened)
+{
+	ThreadStats *stats = currentThreadStats();
+	if (stats != NULL)
+	{
+		addThreadStat(opened == 1 ? &stats->connectionOpened : &stats->connectionClosed, 1);
+	}
+}
+
+long long int elapsedMicroseconds(struct timespec *started)
+{
+	struct timespec finished;
+	clock_gettime(CLOCK_MONOTONIC, &finished);
+	return (finished.tv_sec - started->tv_sec) * 1000000LL + (finished.tv_nsec - started->tv_nsec) / 1000;
+}
+
+ssize_t sendToClient(int fileDescriptor, const void *data, size_t size, int flags)
+{
+	ssize_t sent = send(fileDescriptor, data, size, flags);
+	ThreadStats *stats = currentThreadStats();
+	if (stats != NULL && sent > 0)
+	{
+		addThreadStat(&stats->bytesSent, sent);
+	}
+	return sent;
+}
+
+void collectServerStats(ThreadStats *total)
+{
+	memset(total, 0, sizeof(ThreadStats));
+	
+	pthread_mutex_lock(&statsRegistry.lock);
+	for (int i = 0; i < statsRegistry.threadAmount; i++)
+	{
+		ThreadStats *stats = statsRegistry.thread[i];
+		for (int type = 0; type < STATEMENT_TYPE_AMOUNT; type++)
+		{
+			total->statement[type] += __atomic_load_n(&stats->statement[type], __ATOMIC_RELAXED);
+			total->failed[type] += __atomic_load_n(&stats->failed[type], __ATOMIC_RELAXED);
+			total->latencySum[type] += __atomic_load_n(&stats->latencySum[type], __ATOMIC_RELAXED);
+			
+			unsigned long long int latencyMax = __atomic_load_n(&stats->latencyMax[type], __ATOMIC_RELAXED);
+			if (latencyMax > total->latencyMax[type])
+			{
+				total->latencyMax[type] = latencyMax;
+			}
+			for (int bucket = 0; bucket < __LATENCY_HISTOGRAM_BUCKETS; bucket++)
+			{
+				total->latency[type][bucket] += __atomic_load_n(&stats->latency[type][bucket], __ATOMIC_RELAXED);
+			}
+		}
+		total->rowsScanned += __atomic_load_n(&stats->rowsScanned, __ATOMIC_RELAXED);
+		total->bytesScanned += __atomic_load_n(&stats->bytesScanned, __ATOMIC_RELAXED);
+		total->bytesSent += __atomic_load_n(&stats->bytesSent, __ATOMIC_RELAXED);
+		total->resultCacheHit += __atomic_load_n(&stats->resultCacheHit, __ATOMIC_RELAXED);
+		total->resultCacheMiss += __atomic_load_n(&stats->resultCacheMiss, __ATOMIC_RELAXED);
+		total->connectionOpened += __atomic_load_n(&stats->connectionOpened, __ATOMIC_RELAXED);
+		total->connectionClosed += __atomic_load_n(&stats->connectionClosed, __ATOMIC_RELAXED);
+	}
+	pthread_mutex_unlock(&statsRegistry.lock);
+}
+
+unsigned long long int latencyPercentile(
+	unsigned long long int histogram[], unsigned long long int amount, unsigned long long int latencyMax, double quantile
+)
+{
+	if (amount == 0)
+	{
+		return 0;
+	}
+	
+	unsigned long long int rank = (unsigned long long int)(quantile * amount + 0.999999);
+	if (rank < 1)
+	{
+		rank = 1;
+	}
+	
+	unsigned long long int seen = 0;
+	for (int bucket = 0; bucket < __LATENCY_HISTOGRAM_BUCKETS; bucket++)
+	{
+		seen += histogram[bucket];
+		if (seen >= rank)
+		{
+			unsigned long long int upperBound = latencyBucketUpperBound(bucket);
+			return upperBound < latencyMax ? upperBound : latencyMax;
+		}
+	}
+	return latencyMax;
+}
+
+void initScanThreadAmount()
+{
+	long processorAmount = sysconf(_SC_NPROCESSORS_ONLN);
+	scanThreadAmount = processorAmount < 1 ? 1 : processorAmount;
+	if (scanThreadAmount > __SCAN_MAX_THREADS)
+	{
+		scanThreadAmount = __SCAN_MAX_THREADS;
+	}
+}
+
+void initFilterKernel()
+{
+	filterKernel.filterInt = filterIntScalar;
+	filterKernel.filterLong = filterLongScalar;
+	filterKernel.filterDecimal = filterDecimalScalar;
+	
+#if defined(__x86_64__) || defined(__i386__)
+	__builtin_cpu_init();
+	if (__builtin_cpu_supports("avx2"))
+	{
+		filterKernel.filterInt = filterIntAVX2;
+		filterKernel.filterLong = filterLongAVX2;
+		filterKernel.filterDecimal = filterDecimalAVX2;
+	}
+	else if (__builtin_cpu_supports("sse2"))
+	{
+		filterKernel.filterInt = filterIntSSE;
+		filterKernel.filterDecimal = filterDecimalSSE;
+		if (__builtin_cpu_supports("sse4.2"))
+		{
+			filterKernel.filterLong = filterLongSSE;
+		}
+	}
+#endif
+}
+
+unsigned int hashBytes(const void *data, size_t size)
+{
+	unsigned int hash = 2166136261u;
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= ((const unsigned char *)data)[i];
+		hash *= 16777619u;
+	}
+	return hash;
+}
+
+void gatherRecordColumn(char *batch, int recordAmount, size_t recordStride, size_t columnOffset, int columnSize, void *vector)
+{
+	for (int i = 0; i < recordAmount; i++)
+	{
+		memcpy((char *)vector + (size_t)i * columnSize, batch + i * recordStride + columnOffset, columnSize);
+	}
+}
+
+void buildVisibleSelection(
+	char *batch, int recordAmount, size_t recordStride, Snapshot *snapshot, unsigned long long selection[]
+)
+{
+	memset(selection, 0, sizeof(unsigned long long) * ((recordAmount + 63) / 64));
+	for (int i = 0; i < recordAmount; i++)
+	{
+		if (isRecordVisible(batch + i * recordStride, snapshot))
+		{
+			selection[i >> 6] |= 1ULL << (i & 63);
+		}
+	}
+}
+
+void filterColumnVector(
+	Attribute *attribute, void *vector, int length, CompareOperator op, void *value, unsigned long long matched[]
+)
+{
+	memset(matched, 0, sizeof(unsigned long long) * ((length + 63) / 64));
+	
+	if (attribute->type == INT)
+	{
+		filterKernel.filterInt(vector, length, op, *(int *)value, matched);
+	}
+	else if (attribute->type == LONG)
+	{
+		filterKernel.filterLong(vector, length, op, *(long long int *)value, matched);
+	}
+	else if (attribute->type == DECIMAL)
+	{
+		filterKernel.filterDecimal(vector, length, op, *(double *)value, matched);
+	}
+	else
+	{
+		for (int i = 0; i < length; i++)
+		{
+			int compared = memcmp((char *)vector + (size_t)i * attribute->size, value, attribute->size);
+			if (combineCompareMask(op, compared == 0, compared < 0, compared > 0) & 1)
+			{
+				matched[i >> 6] |= 1ULL << (i & 63);
+			}
+		}
+	}
+}
+
+int attributeDataOffset(Attribute attribute[], int index)
+{
+	int offset = 0;
+	for (int i = 0; i < index; i++)
+	{
+		offset += attribute[i].size;
+	}
+	return offset;
+}
+
+int isNumericAttribute(Attribute *attribute)
+{
+	return attribute->type == INT || attribute->type == LONG || attribute->type == DECIMAL;
+}
+
+int compareAttributeValue(Attribute *attribute, const void *a, const void *b)
+{
+	if (attribute->type == INT)
+	{
+		int x, y;
+		memcpy(&x, a, sizeof(x));
+		memcpy(&y, b, sizeof(y));
+		return (x > y) - (x < y);
+	}
+	else if (attribute->type == LONG)
+	{
+		long long int x, y;
+		memcpy(&x, a, sizeof(x));
+		memcpy(&y, b, sizeof(y));
+		return (x > y) - (x < y);
+	}
+	else if (attribute->type == DECIMAL)
+	{
+		double x, y;
+		memcpy(&x, a, sizeof(x));
+		memcpy(&y, b, sizeof(y));
+		return (x > y) - (x < y);
+	}
+	return memcmp(a, b, attribute->size);
+}
+
+Predicate* newPredicate(PredicateType type)
+{
+	Predicate *predicate = calloc(1, sizeof(Predicate));
+	predicate->type = type;
+	predicate->attributeIndex = -1;
+	return predicate;
+}
+
+void delPredicate(Predicate *predicate)
+{
+	if (predicate == NULL)
+	{
+		return;
+	}
+	for (int i = 0; i < predicate->childAmount; i++)
+	{
+		delPredicate(predicate->child[i]);
+	}
+	free(predicate->child);
+	free(predicate->value);
+	free(predicate->valueSet);
+	free(predicate);
+}
+
+void appendPredicateChild(Predicate *parent, Predicate *child)
+{
+	parent->child = realloc(parent->child, sizeof(Predicate *) * (parent->childAmount + 1));
+	parent->child[parent->childAmount++] = child;
+}
+
+int findPredicateValue(Predicate *predicate, const char *value)
+{
+	int mask = predicate->valueSetCapacity - 1;
+	int index = hashBytes(value, predicate->attribute.size) & mask;
+	while (predicate->valueSet[index] != -1)
+	{
+		if (memcmp(predicate->value + (size_t)predicate->valueSet[index] * predicate->attribute.size, value, predicate->attribute.size) == 0)
+		{
+			return 1;
+		}
+		index = (index + 1) & mask;
+	}
+	return 0;
+}
+
+void buildPredicateValueSet(Predicate *predicate)
+{
+	predicate->valueSetCapacity = 16;
+	while (predicate->valueSetCapacity < predicate->valueAmount * 2)
+	{
+		predicate->valueSetCapacity *= 2;
+	}
+	predicate->valueSet = malloc(sizeof(int) * predicate->valueSetCapacity);
+	memset(predicate->valueSet, -1, sizeof(int) * predicate->valueSetCapacity);
+	
+	int mask = predicate->valueSetCapacity - 1;
+	for (int i = 0; i < predicate->valueAmount; i++)
+	{
+		char *value = predicate->value + (size_t)i * predicate->attribute.size;
+		if (findPredicateValue(predicate, value) == 0)
+		{
+			int index = hashBytes(value, predicate->attribute.size) & mask;
+			while (predicate->valueSet[index] != -1)
+			{
+				index = (index + 1) & mask;
+			}
+			predicate->valueSet[index] = i;
+		}
+	}
+}
+
+int predicateMaxAttributeSize(Predicate *predicate)
+{
+	if (predicate == NULL)
+	{
+		return 0;
+	}
+	
+	int maxSize = predicate->attributeIndex != -1 ? predicate->attribute.size : 0;
+	for (int i = 0; i < predicate->childAmount; i++)
+	{
+		int childSize = predicateMaxAttributeSize(predicate->child[i]);
+		if (childSize > maxSize)
+		{
+			maxSize = childSize;
+		}
+	}
+	return maxSize;
+}
+
+void markPredicateColumns(Predicate *predicate, int column[])
+{
+	if (predicate == NULL)
+	{
+		return;
+	}
+	if (predicate->attributeIndex != -1)
+	{
+		column[predicate->attributeIndex] = 1;
+	}
+	for (int i = 0; i < predicate->childAmount; i++)
+	{
+		markPredicateColumns(predicate->child[i], column);
+	}
+}
+
+char* predicateColumn(PredicateBatch *batch, Predicate *predicate)
+{
+	if (batch->columnChunk != NULL)
+	{
+		return batch->columnChunk[predicate->attributeIndex];
+	}
+	if (batch->recordAmount == 1)
+	{
+		return batch->data + batch->dataOffset + predicate->offset;
+	}
+	gatherRecordColumn(
+		batch->data, batch->recordAmount, batch->recordStride, batch->dataOffset + predicate->offset, 
+		predicate->attribute.size, batch->columnVector
+	);
+	return batch->columnVector;
+}
+
+int isSelectionEmpty(unsigned long long selection[], int wordAmount)
+{
+	for (int i = 0; i < wordAmount; i++)
+	{
+		if (selection[i] != 0)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+void evaluatePredicate(
+	Predicate *predicate, PredicateBatch *batch, unsigned long long candidate[], unsigned long long result[]
+)
+{
+	int wordAmount = (batch->recordAmount + 63) / 64;
+	unsigned long long matched[(__SCAN_BATCH_RECORDS + 63) / 64];
+	unsigned long long remaining[(__SCAN_BATCH_RECORDS + 63) / 64];
+	
+	if (predicate->type == COMPARE_PREDICATE)
+	{
+		filterColumnVector(
+			&predicate->attribute, predicateColumn(batch, predicate), batch->recordAmount, 
+			predicate->op, predicate->value, result
+		);
+		for (int i = 0; i < wordAmount; i++)
+		{
+			result[i] &= candidate[i];
+		}
+	}
+	else if (predicate->type == IN_PREDICATE)
+	{
+		char *column = predicateColumn(batch, predicate);
+		memset(result, 0, sizeof(unsigned long long) * wordAmount);
+		
+		if (predicate->valueAmount <= __IN_LIST_LINEAR_MAX)
+		{
+			for (int i = 0; i < predicate->valueAmount; i++)
+			{
+				filterColumnVector(
+					&predicate->attribute, column, batch->recordAmount, EQUAL, 
+					predicate->value + (size_t)i * predicate->attribute.size, matched
+				);
+				for (int j = 0; j < wordAmount; j++)
+				{
+					result[j] |= matched[j] & candidate[j];
+				}
+			}
+		}
+		else
+		{
+			for (int i = 0; i < wordAmount; i++)
+			{
+				unsigned long long word = candidate[i];
+				while (word != 0)
+				{
+					int index = i * 64 + __builtin_ctzll(word);
+					word &= word - 1;
+					if (findPredicateValue(predicate, column + (size_t)index * predicate->attribute.size) == 1)
+					{
+						result[i] |= 1ULL << (index & 63);
+					}
+				}
+			}
+		}
+	}
+	else if (predicate->type == AND_PREDICATE)
+	{
+		memcpy(result, candidate, sizeof(unsigned long long) * wordAmount);
+		for (int i = 0; i < predicate->childAmount && isSelectionEmpty(result, wordAmount) == 0; i++)
+		{
+			evaluatePredicate(predicate->child[i], batch, result, matched);
+			memcpy(result, matched, sizeof(unsigned long long) * wordAmount);
+		}
+	}
+	else if (predicate->type == OR_PREDICATE)
+	{
+		memset(result, 0, sizeof(unsigned long long) * wordAmount);
+		memcpy(remaining, candidate, sizeof(unsigned long long) * wordAmount);
+		for (int i = 0; i < predicate->childAmount && isSelectionEmpty(remaining, wordAmount) == 0; i++)
+		{
+			evaluatePredicate(predicate->child[i], batch, remaining, matched);
+			for (int j = 0; j < wordAmount; j++)
+			{
+				result[j] |= matched[j];
+				remaining[j] &= ~matched[j];
+			}
+		}
+	}
+	else
+	{
+		evaluatePredicate(predicate->child[0], batch, candidate, matched);
+		for (int i = 0; i < wordAmount; i++)
+		{
+			result[i] = candidate[i] & ~matched[i];
+		}
+	}
+}
+
+int matchPredicateRecord(Predicate *predicate, char *recordData)
+{
+	PredicateBatch batch = {recordData, 1, 0, 0, NULL, NULL};
+	unsigned long long candidate[1] = {1};
+	unsigned long long result[(__SCAN_BATCH_RECORDS + 63) / 64];
+	evaluatePredicate(predicate, &batch, candidate, result);
+	return result[0] & 1;
+}
+
+unsigned int mixStatsHash(unsigned int hash)
+{
+	hash ^= hash >> 16;
+	hash *= 0x85ebca6bu;
+	hash ^= hash >> 13;
+	hash *= 0xc2b2ae35u;
+	hash ^= hash >> 16;
+	return hash;
+}
+
+int statsValueSize(Attribute *attribute)
+{
+	return attribute->size < __STATS_VALUE_SIZE ? attribute->size : __STATS_VALUE_SIZE;
+}
+
+int compareStatsValue(Attribute *attribute, const char *a, const char *b)
+{
+	if (isNumericAttribute(attribute))
+	{
+		return compareAttributeValue(attribute, a, b);
+	}
+	return memcmp(a, b, statsValueSize(attribute));
+}
+
+double statsNumericValue(Attribute *attribute, const char *value)
+{
+	if (attribute->type == INT)
+	{
+		int x;
+		memcpy(&x, value, sizeof(x));
+		return x;
+	}
+	else if (attribute->type == LONG)
+	{
+		long long int x;
+		memcpy(&x, value, sizeof(x));
+		return x;
+	}
+	double x;
+	memcpy(&x, value, sizeof(x));
+	return x;
+}
+
+void addColumnStatsValue(ColumnStats *column, const char *value)
+{
+	int valueSize = statsValueSize(&column->attribute);
+	if (column->filled == 0 || compareStatsValue(&column->attribute, value, column->minValue) < 0)
+	{
+		memcpy(column->minValue, value, valueSize);
+	}
+	if (column->filled == 0 || compareStatsValue(&column->attribute, value, column->maxValue) > 0)
+	{
+		memcpy(column->maxValue, value, valueSize);
+	}
+	column->filled = 1;
+	
+	unsigned int hash = mixStatsHash(hashBytes(value, column->attribute.size));
+	int position = 0;
+	while (position < column->sketchAmount && column->sketch[position] < hash)
+	{
+		position += 1;
+	}
+	if (position == __STATS_SKETCH_VALUES || (position < column->sketchAmount && column->sketch[position] == hash))
+	{
+		return;
+	}
+	
+	if (column->sketchAmount < __STATS_SKETCH_VALUES)
+	{
+		column->sketchAmount += 1;
+	}
+	memmove(
+		&column->sketch[position + 1], &column->sketch[position], 
+		sizeof(unsigned int) * (column->sketchAmount - 1 - position)
+	);
+	column->sketch[position] = hash;
+}
+
+double estimateDistinctAmount(ColumnStats *column, long long int rowAmount)
+{
+	double distinct = column->sketchAmount;
+	if (column->sketchAmount == __STATS_SKETCH_VALUES)
+	{
+		distinct = (__STATS_SKETCH_VALUES - 1) * 4294967296.0 / ((double)column->sketch[__STATS_SKETCH_VALUES - 1] + 1);
+	}
+	if (distinct > rowAmount)
+	{
+		distinct = rowAmount;
+	}
+	return distinct < 1 ? 1 : distinct;
+}
+
+double estimateFractionBelow(TableStats *stats, ColumnStats *column, double value)
+{
+	double range[2] = {
+		statsNumericValue(&column->attribute, column->minValue), 
+		statsNumericValue(&column->attribute, column->maxValue)
+	};
+	double *bound = column->bucketBound;
+	int bucketAmount = column->bucketAmount;
+	
+	if (bucketAmount == 0 || stats->modifiedAmount * 5 > stats->rowAmount)
+	{
+		bound = range;
+		bucketAmount = 1;
+	}
+	
+	if (value <= bound[0])
+	{
+		return 0;
+	}
+	for (int i = 0; i < bucketAmount; i++)
+	{
+		if (value < bound[i + 1])
+		{
+			return (i + (value - bound[i]) / (bound[i + 1] - bound[i])) / bucketAmount;
+		}
+	}
+	return 1;
+}
+
+ColumnStats* findColumnStats(TableStats *stats, Predicate *predicate)
+{
+	if (stats == NULL || stats->rowAmount == 0 || predicate->attributeIndex >= stats->attributeAmount)
+	{
+		return NULL;
+	}
+	
+	ColumnStats *column = &stats->column[predicate->attributeIndex];
+	if (column->filled == 0 || strcmp(column->attribute.attributeName, predicate->attribute.attributeName) != 0)
+	{
+		return NULL;
+	}
+	return column;
+}
+
+double estimateLeafSelectivity(Predicate *predicate, TableStats *stats)
+{
+	ColumnStats *column = findColumnStats(stats, predicate);
+	
+	if (column == NULL)
+	{
+		if (predicate->type == IN_PREDICATE)
+		{
+			return predicate->valueAmount * 0.05 < 0.5 ? predicate->valueAmount * 0.05 : 0.5;
+		}
+		if (predicate->op == EQUAL)
+		{
+			return 0.05;
+		}
+		if (predicate->op == NOT_EQUAL)
+		{
+			return 0.95;
+		}
+		return 0.33;
+	}
+	
+	double equalSelectivity = 1 / estimateDistinctAmount(column, stats->rowAmount);
+	
+	if (predicate->type == IN_PREDICATE)
+	{
+		return predicate->valueAmount * equalSelectivity < 1 ? predicate->valueAmount * equalSelectivity : 1;
+	}
+	
+	if (isNumericAttribute(&predicate->attribute) == 0)
+	{
+		if (predicate->op == EQUAL)
+		{
+			return equalSelectivity;
+		}
+		return predicate->op == NOT_EQUAL ? 1 - equalSelectivity : 0.33;
+	}
+	
+	int belowMin = compareAttributeValue(&predicate->attribute, predicate->value, column->minValue) < 0;
+	int aboveMax = compareAttributeValue(&predicate->attribute, predicate->value, column->maxValue) > 0;
+	if (predicate->op == EQUAL || predicate->op == NOT_EQUAL)
+	{
+		double selectivity = belowMin || aboveMax ? 0 : equalSelectivity;
+		return predicate->op == EQUAL ? selectivity : 1 - selectivity;
+	}
+	
+	double below = estimateFractionBelow(stats, column, statsNumericValue(&predicate->attribute, predicate->value));
+	double equal = belowMin || aboveMax ? 0 : equalSelectivity;
+	double selectivity;
+	if (predicate->op == LESS)
+	{
+		selectivity = below;
+	}
+	else if (predicate->op == LESS_EQUAL)
+	{
+		selectivity = below + equal;
+	}
+	else if (predicate->op == GREATER)
+	{
+		selectivity = 1 - below - equal;
+	}
+	else
+	{
+		selectivity = 1 - below;
+	}
+	return selectivity < 0 ? 0 : (selectivity > 1 ? 1 : selectivity);
+}
+
+int comparePredicateSelectivity(const void *a, const void *b)
+{
+	double x = (*(Predicate **)a)->selectivity;
+	double y = (*(Predicate **)b)->selectivity;
+	return (x > y) - (x < y);
+}
+
+void optimizePredicate(Predicate *predicate, TableStats *stats)
+{
+	if (predicate->type == COMPARE_PREDICATE || predicate->type == IN_PREDICATE)
+	{
+		predicate->selectivity = estimateLeafSelectivity(predicate, stats);
+		return;
+	}
+	
+	for (int i = 0; i < predicate->childAmount; i++)
+	{
+		optimizePredicate(predicate->child[i], stats);
+	}
+	
+	if (predicate->type == NOT_PREDICATE)
+	{
+		predicate->selectivity = 1 - predicate->child[0]->selectivity;
+		return;
+	}
+	
+	for (int i = 0; i < predicate->childAmount; i++)
+	{
+		Predicate *child = predicate->child[i];
+		if (child->type == predicate->type)
+		{
+			predicate->child = realloc(
+				predicate->child, sizeof(Predicate *) * (predicate->childAmount + child->childAmount - 1)
+			);
+			memmove(
+				&predicate->child[i + child->childAmount], &predicate->child[i + 1], 
+				sizeof(Predicate *) * (predicate->childAmount - i - 1)
+			);
+			memcpy(&predicate->child[i], child->child, sizeof(Predicate *) * child->childAmount);
+			predicate->childAmount += child->childAmount - 1;
+			child->childAmount = 0;
+			delPredicate(child);
+			i -= 1;
+		}
+	}
+	
+	qsort(predicate->child, predicate->childAmount, sizeof(Predicate *), comparePredicateSelectivity);
+	
+	double selectivity = 1;
+	for (int i = 0; i < predicate->childAmount; i++)
+	{
+		if (predicate->type == AND_PREDICATE)
+		{
+			selectivity *= predicate->child[i]->selectivity;
+		}
+		else
+		{
+			selectivity *= 1 - predicate->child[i]->selectivity;
+		}
+	}
+	
+	if (predicate->type == OR_PREDICATE)
+	{
+		selectivity = 1 - selectivity;
+		for (int i = 0; i < predicate->childAmount / 2; i++)
+		{
+			Predicate *swap = predicate->child[i];
+			predicate->child[i] = predicate->child[predicate->childAmount - 1 - i];
+			predicate->child[predicate->childAmount - 1 - i] = swap;
+		}
+	}
+	predicate->selectivity = selectivity;
+}
+
+Predicate* clonePredicate(Predicate *predicate, int attributeShift, int offsetShift)
+{
+	Predicate *clone = newPredicate(predicate->type);
+	clone->op = predicate->op;
+	clone->attribute = predicate->attribute;
+	clone->attributeIndex = predicate->attributeIndex == -1 ? -1 : predicate->attributeIndex - attributeShift;
+	clone->offset = predicate->offset - offsetShift;
+	clone->valueAmount = predicate->valueAmount;
+	clone->selectivity = predicate->selectivity;
+	
+	if (predicate->value != NULL)
+	{
+		size_t valueSize = (size_t)predicate->attribute.size * (predicate->valueAmount > 0 ? predicate->valueAmount : 1);
+		clone->value = malloc(valueSize);
+		memcpy(clone->value, predicate->value, valueSize);
+	}
+	if (predicate->valueSet != NULL)
+	{
+		clone->valueSetCapacity = predicate->valueSetCapacity;
+		clone->valueSet = malloc(sizeof(int) * predicate->valueSetCapacity);
+		memcpy(clone->valueSet, predicate->valueSet, sizeof(int) * predicate->valueSetCapacity);
+	}
+	for (int i = 0; i < predicate->childAmount; i++)
+	{
+		appendPredicateChild(clone, clonePredicate(predicate->child[i], attributeShift, offsetShift));
+	}
+	return clone;
+}
+
+int isPredicateWithinAttributes(Predicate *predicate, int firstAttribute, int attributeAmount)
+{
+	if (
+		predicate->attributeIndex != -1 && 
+		(predicate->attributeIndex < firstAttribute || predicate->attributeIndex >= firstAttribute + attributeAmount)
+	)
+	{
+		return 0;
+	}
+	for (int i = 0; i < predicate->childAmount; i++)
+	{
+		if (isPredicateWithinAttributes(predicate->child[i], firstAttribute, attributeAmount) == 0)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+void initEqualPredicate(Predicate *predicate, Attribute attribute[], int attributeIndex, void *value)
+{
+	memset(predicate, 0, sizeof(Predicate));
+	predicate->type = COMPARE_PREDICATE;
+	predicate->op = EQUAL;
+	predicate->attributeIndex = attributeIndex;
+	predicate->attribute = attribute[attributeIndex];
+	predicate->offset = attributeDataOffset(attribute, attributeIndex);
+	predicate->value = value;
+	predicate->selectivity = estimateLeafSelectivity(predicate, NULL);
+}
+
+int columnarFilePath(char filePath[], size_t size, char database[], char table[], char attributeName[])
+{
+	int length;
+	if (attributeName == NULL)
+	{
+		length = snprintf(filePath, size, "%s/%s/%s.deleted", __DATABASE_ROOT, database, table);
+	}
+	else
+	{
+		length = snprintf(filePath, size, "%s/%s/%s.column.%s", __DATABASE_ROOT, database, table, attributeName);
+	}
+	return length >= 0 && (size_t)length < size;
+}
+
+int isColumnarTable(char database[], char table[])
+{
+	char filePath[1024];
+	return columnarFilePath(filePath, sizeof(filePath), database, table, NULL) == 1 && access(filePath, F_OK) == 0;
+}
+
+off_t columnarSegmentSize(Attribute *attribute)
+{
+	return sizeof(int) + (off_t)__COLUMNAR_SEGMENT_ROWS * attribute->size;
+}
+
+int createColumnarTable(char database[], char table[], int attributeAmount, Attribute attribute[])
+{
+	char filePath[1024];
+	for (int i = 0; i < attributeAmount; i++)
+	{
+		if (columnarFilePath(filePath, sizeof(filePath), database, table, attribute[i].attributeName) == 0)
+		{
+			return 0;
+		}
+	}
+	if (createTable(database, table, attributeAmount, attribute) == 0)
+	{
+		return 0;
+	}
+	
+	for (int i = 0; i < attributeAmount; i++)
+	{
+		columnarFilePath(filePath, sizeof(filePath), database, table, attribute[i].attributeName);
+		fclose(fopen(filePath, "w"));
+	}
+	columnarFilePath(filePath, sizeof(filePath), database, table, NULL);
+	fclose(fopen(filePath, "w"));
+	
+	return 1;
+}
+
+int readColumnarSegmentRowCount(FILE *columnFile, off_t segmentSize, int segment)
+{
+	int rowCount = 0;
+	fseeko(columnFile, segmentSize * segment, SEEK_SET);
+	if (fread(&rowCount, sizeof(rowCount), 1, columnFile) != 1)
+	{
+		return 0;
+	}
+	return rowCount;
+}
+
+int countColumnarSegment(FILE *columnFile, off_t segmentSize)
+{
+	fseeko(columnFile, 0, SEEK_END);
+	return ftello(columnFile) / segmentSize;
+}
+
+char* readColumnarDeleteBitmap(char database[], char table[], size_t *bitmapSize)
+{
+	char filePath[1024];
+	*bitmapSize = 0;
+	if (columnarFilePath(filePath, sizeof(filePath), database, table, NULL) == 0)
+	{
+		return NULL;
+	}
+	FILE *bitmapFile = fopen(filePath, "r");
+	if (bitmapFile == NULL)
+	{
+		return NULL;
+	}
+	
+	fseeko(bitmapFile, 0, SEEK_END);
+	*bitmapSize = ftello(bitmapFile);
+	fseeko(bitmapFile, 0, SEEK_SET);
+	
+	char *bitmap = malloc(*bitmapSize + 1);
+	*bitmapSize = fread(bitmap, 1, *bitmapSize, bitmapFile);
+	fclose(bitmapFile);
+	
+	return bitmap;
+}
+
+int isColumnarRowDeleted(char *bitmap, size_t bitmapSize, long long int row)
+{
+	return (size_t)(row >> 3) < bitmapSize && (bitmap[row >> 3] & (1 << (row & 7))) != 0;
+}
+
+int insertIntoColumnarTable(char database[], char table[], RecordBlock *newRecordBlock)
+{
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute = 0;
+	int recordBlockSize = 0;
+	
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r+");
+	
+	if (tableFile == NULL)
+	{
+		return 0;
+	}
+	
+	int tableData[3];
+	freadTableHeader(tableData, tableFile);
+	
+	AttributeBlock attributeBlock[tableData[0]];
+	fread(attributeBlock, sizeof(attributeBlock[0]), tableData[0], tableFile);
+	for (int i = 0; i < tableData[0]; i++)
+	{
+		attribute[totalAttribute++] = attributeBlock[i].attribute;
+	}
+	recordBlockSize = tableData[2];
+	
+	FILE *columnFile[totalAttribute];
+	int openedAmount = 0;
+	for (; openedAmount < totalAttribute; openedAmount++)
+	{
+		columnFile[openedAmount] = NULL;
+		if (columnarFilePath(filePath, sizeof(filePath), database, table, attribute[openedAmount].attributeName) == 1)
+		{
+			columnFile[openedAmount] = fopen(filePath, "r+");
+		}
+		if (columnFile[openedAmount] == NULL)
+		{
+			break;
+		}
+	}
+	if (openedAmount < totalAttribute)
+	{
+		for (int i = 0; i < openedAmount; i++)
+		{
+			fclose(columnFile[i]);
+		}
+		fclose(tableFile);
+		return 0;
+	}
+	
+	off_t originalSize[totalAttribute];
+	int originalRowCount[totalAttribute];
+	int writtenAmount = 0;
+	int failed = 0;
+	int dataOffset = 0;
+	for (int i = 0; i < totalAttribute && dataOffset < recordBlockSize && failed == 0; i++)
+	{
+		off_t segmentSize = columnarSegmentSize(&attribute[i]);
+		int segmentAmount = countColumnarSegment(columnFile[i], segmentSize);
+		int rowCount = __COLUMNAR_SEGMENT_ROWS;
+		
+		if (segmentAmount > 0)
+		{
+			rowCount = readColumnarSegmentRowCount(columnFile[i], segmentSize, segmentAmount - 1);
+		}
+		originalSize[i] = segmentSize * segmentAmount;
+		originalRowCount[i] = rowCount;
+		writtenAmount = i + 1;
+		
+		if (rowCount >= __COLUMNAR_SEGMENT_ROWS)
+		{
+			segmentAmount++;
+			rowCount = 0;
+			fflush(columnFile[i]);
+			failed = ftruncate(fileno(columnFile[i]), segmentSize * segmentAmount) != 0;
+		}
+		
+		off_t segmentOffset = segmentSize * (segmentAmount - 1);
+		fseeko(columnFile[i], segmentOffset + sizeof(int) + (off_t)rowCount * attribute[i].size, SEEK_SET);
+		failed = failed == 1 || fwrite((char *)newRecordBlock->data + dataOffset, attribute[i].size, 1, columnFile[i]) != 1;
+		
+		rowCount++;
+		fseeko(columnFile[i], segmentOffset, SEEK_SET);
+		failed = failed == 1 || fwrite(&rowCount, sizeof(rowCount), 1, columnFile[i]) != 1 || fflush(columnFile[i]) != 0;
+		dataOffset += attribute[i].size;
+	}
+	
+	for (int i = 0; i < writtenAmount && failed == 1; i++)
+	{
+		fflush(columnFile[i]);
+		ftruncate(fileno(columnFile[i]), originalSize[i]);
+		if (originalSize[i] > 0 && originalRowCount[i] < __COLUMNAR_SEGMENT_ROWS)
+		{
+			fseeko(columnFile[i], originalSize[i] - columnarSegmentSize(&attribute[i]), SEEK_SET);
+			fwrite(&originalRowCount[i], sizeof(originalRowCount[i]), 1, columnFile[i]);
+		}
+	}
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		fclose(columnFile[i]);
+	}
+	if (failed == 1)
+	{
+		fclose(tableFile);
+		return 0;
+	}
+	
+	fseek(tableFile, 0, SEEK_SET);
+	tableData[1]++;
+	fwriteTableHeader(tableData, tableFile);
+	fclose(tableFile);
+	
+	return 1;
+}
+
+int scanColumnarTable(
+	char database[], char table[], Attribute attribute[], int totalAttribute, int recordBlockSize, 
+	int neededColumn[], Predicate *where, int markDeleted, RecordCallback callback, void *context
+)
+{
+	char filePath[1024];
+	FILE *columnFile[totalAttribute];
+	int columnOffset[totalAttribute];
+	int predicateAttribute[totalAttribute];
+	int offset = 0;
+	
+	memset(predicateAttribute, 0, sizeof(predicateAttribute));
+	markPredicateColumns(where, predicateAttribute);
+	
+	int driverColumn = -1;
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		columnFile[i] = NULL;
+		columnOffset[i] = offset;
+		offset += attribute[i].size;
+		
+		if (
+			(neededColumn == NULL || neededColumn[i] == 1 || predicateAttribute[i] == 1) && 
+			columnarFilePath(filePath, sizeof(filePath), database, table, attribute[i].attributeName) == 1
+		)
+		{
+			columnFile[i] = fopen(filePath, "r");
+		}
+		if (predicateAttribute[i] == 1 && driverColumn == -1)
+		{
+			driverColumn = i;
+		}
+	}
+	
+	for (int i = 0; i < totalAttribute && driverColumn == -1; i++)
+	{
+		if (columnFile[i] != NULL)
+		{
+			driverColumn = i;
+		}
+	}
+	if (driverColumn == -1)
+	{
+		if (columnarFilePath(filePath, sizeof(filePath), database, table, attribute[0].attributeName) == 1)
+		{
+			columnFile[0] = fopen(filePath, "r");
+		}
+		driverColumn = 0;
+	}
+	
+	size_t bitmapSize = 0;
+	char *bitmap = readColumnarDeleteBitmap(database, table, &bitmapSize);
+	
+	int chunkCapacity = recordBlockSize > 0 ? __SCAN_BATCH_BYTES / recordBlockSize : __SCAN_BATCH_RECORDS;
+	if (chunkCapacity > __SCAN_BATCH_RECORDS)
+	{
+		chunkCapacity = __SCAN_BATCH_RECORDS;
+	}
+	if (chunkCapacity < 1)
+	{
+		chunkCapacity = 1;
+	}
+	
+	void *columnChunk[totalAttribute];
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		columnChunk[i] = columnFile[i] != NULL ? malloc((size_t)attribute[i].size * chunkCapacity) : NULL;
+	}
+	char *record = malloc(recordBlockSize > 0 ? recordBlockSize : 1);
+	unsigned long long selection[(__SCAN_BATCH_RECORDS + 63) / 64];
+	unsigned long long matched[(__SCAN_BATCH_RECORDS + 63) / 64];
+	
+	int affected = 0;
+	int scanning = 1;
+	int segmentAmount = columnFile[driverColumn] != NULL ? 
+		countColumnarSegment(columnFile[driverColumn], columnarSegmentSize(&attribute[driverColumn])) : 0;
+	
+	for (int segment = 0; segment < segmentAmount && scanning == 1; segment++)
+	{
+		int rowCount = readColumnarSegmentRowCount(
+			columnFile[driverColumn], columnarSegmentSize(&attribute[driverColumn]), segment
+		);
+		
+		for (int chunkStart = 0; chunkStart < rowCount && scanning == 1; chunkStart += chunkCapacity)
+		{
+			int chunkRows = rowCount - chunkStart < chunkCapacity ? rowCount - chunkStart : chunkCapacity;
+			int wordAmount = (chunkRows + 63) / 64;
+			long long int firstRow = (long long int)segment * __COLUMNAR_SEGMENT_ROWS + chunkStart;
+			
+			long long int chunkBytes = 0;
+			for (int i = 0; i < totalAttribute; i++)
+			{
+				if (columnFile[i] != NULL)
+				{
+					fseeko(
+						columnFile[i], 
+						columnarSegmentSize(&attribute[i]) * segment + sizeof(int) + (off_t)chunkStart * attribute[i].size, 
+						SEEK_SET
+					);
+					fread(columnChunk[i], attribute[i].size, chunkRows, columnFile[i]);
+					chunkBytes += (long long int)attribute[i].size * chunkRows;
+				}
+			}
+			recordScanStats(chunkRows, chunkBytes);
+			
+			memset(selection, 0, sizeof(selection[0]) * wordAmount);
+			for (int i = 0; i < chunkRows; i++)
+			{
+				if (isColumnarRowDeleted(bitmap, bitmapSize, firstRow + i) == 0)
+				{
+					selection[i >> 6] |= 1ULL << (i & 63);
+				}
+			}
+			if (activeQueryProfile != NULL)
+			{
+				profileScanBatch(chunkRows, chunkBytes, selection);
+			}
+			
+			if (where != NULL)
+			{
+				PredicateBatch predicateBatch = {NULL, chunkRows, 0, 0, columnChunk, NULL};
+				evaluatePredicate(where, &predicateBatch, selection, matched);
+				memcpy(selection, matched, sizeof(selection[0]) * wordAmount);
+			}
+			if (activeQueryProfile != NULL)
+			{
+				profileMatchedRecords(chunkRows, selection);
+			}
+			
+			for (int i = 0; i < wordAmount && scanning == 1; i++)
+			{
+				unsigned long long word = selection[i];
+				while (word != 0 && scanning == 1)
+				{
+					int index = i * 64 + __builtin_ctzll(word);
+					word &= word - 1;
+					affected++;
+					
+					if (markDeleted == 1)
+					{
+						long long int row = firstRow + index;
+						if ((size_t)(row >> 3) >= bitmapSize)
+						{
+							size_t newSize = (row >> 3) + 1;
+							bitmap = realloc(bitmap, newSize);
+							memset(bitmap + bitmapSize, 0, newSize - bitmapSize);
+							bitmapSize = newSize;
+						}
+						bitmap[row >> 3] |= 1 << (row & 7);
+					}
+					if (callback != NULL)
+					{
+						memset(record, 0, recordBlockSize);
+						for (int j = 0; j < totalAttribute; j++)
+						{
+							if (columnChunk[j] != NULL)
+							{
+								memcpy(
+									record + columnOffset[j], (char *)columnChunk[j] + (size_t)index * attribute[j].size, 
+									attribute[j].size
+								);
+							}
+						}
+						scanning = callback(context, record);
+					}
+				}
+			}
+		}
+	}
+	
+	if (markDeleted == 1 && affected > 0 && columnarFilePath(filePath, sizeof(filePath), database, table, NULL) == 1)
+	{
+		FILE *bitmapFile = fopen(filePath, "w");
+		if (bitmapFile == NULL || fwrite(bitmap, 1, bitmapSize, bitmapFile) != bitmapSize)
+		{
+			affected = -1;
+		}
+		if (bitmapFile != NULL && fclose(bitmapFile) != 0)
+		{
+			affected = -1;
+		}
+	}
+	
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		if (columnFile[i] != NULL)
+		{
+			fclose(columnFile[i]);
+		}
+		free(columnChunk[i]);
+	}
+	free(record);
+	free(bitmap);
+	
+	return affected;
+}
+
+int readTableAttribute(char database[], char table[], int *totalAttribute, Attribute attribute[], int *recordBlockSize)
+{	
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r");
+	
+	*totalAttribute = 0;
+	
+	if (recordBlockSize != NULL)
+	{
+		*recordBlockSize = 0;
+	}
+	
+	if (tableFile != NULL)
+	{
+		int tableData[3];
+		freadTableHeader(tableData, tableFile);
+		
+		if (recordBlockSize != NULL)
+		{
+			*recordBlockSize = tableData[2];
+		}
+		
+		AttributeBlock attributeBlock[tableData[0]];
+		fread(attributeBlock, sizeof(attributeBlock[0]), tableData[0], tableFile);
+		
+		*totalAttribute = tableData[0];
+		
+		for (int i = 0; i < tableData[0]; i++)
+		{
+			memcpy(&attribute[i], &(attributeBlock[i].attribute), sizeof(Attribute));
+		}
+		
+		fclose(tableFile);
+		
+		return 1;
+	}
+	return 0;
+}
+
+TableVersion* findTableVersion(char database[], char table[], int create)
+{
+	char key[128];
+	int keyLength = sprintf(key, "%s\n%s", database, table);
+	unsigned int index = hashBytes(key, keyLength) & (__TABLE_VERSION_BUCKETS - 1);
+	
+	TableVersion *node = tableVersionBucket[index];
+	while (node != NULL)
+	{
+		if (strcmp(node->database, database) == 0 && strcmp(node->table, table) == 0)
+		{
+			return node;
+		}
+		node = node->next;
+	}
+	
+	if (create == 0)
+	{
+		return NULL;
+	}
+	
+	node = calloc(1, sizeof(TableVersion));
+	strncpy(node->database, database, sizeof(node->database) - 1);
+	strncpy(node->table, table, sizeof(node->table) - 1);
+	node->next = tableVersionBucket[index];
+	tableVersionBucket[index] = node;
+	return node;
+}
+
+long long int getTableVersion(char database[], char table[])
+{
+	TableVersion *node = findTableVersion(database, table, 0);
+	if (node == NULL)
+	{
+		return 0;
+	}
+	return node->version;
+}
+
+void bumpTableVersion(char database[], char table[])
+{
+	TableVersion *node = findTableVersion(database, table, 0);
+	if (node != NULL)
+	{
+		node->version++;
+	}
+}
+
+void bumpDatabaseVersions(char database[])
+{
+	for (int i = 0; i < __TABLE_VERSION_BUCKETS; i++)
+	{
+		for (TableVersion *node = tableVersionBucket[i]; node != NULL; node = node->next)
+		{
+			if (strcmp(node->database, database) == 0)
+			{
+				node->version++;
+			}
+		}
+	}
+}
+
+void statsFilePath(char filePath[], char database[], char table[])
+{
+	sprintf(filePath, "%s/%s/%s.stats", __DATABASE_ROOT, database, table);
+}
+
+TableStats* newTableStats(Attribute attribute[], int totalAttribute)
+{
+	TableStats *stats = calloc(1, sizeof(TableStats));
+	stats->attributeAmount = totalAttribute;
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		stats->column[i].attribute = attribute[i];
+	}
+	return stats;
+}
+
+TableStats* loadTableStats(char database[], char table[])
+{
+	char filePath[1024];
+	statsFilePath(filePath, database, table);
+	FILE *statsFile = fopen(filePath, "r");
+	if (statsFile == NULL)
+	{
+		return NULL;
+	}
+	
+	TableStats *stats = calloc(1, sizeof(TableStats));
+	if (
+		fread(&stats->rowAmount, sizeof(stats->rowAmount), 1, statsFile) != 1 ||
+		fread(&stats->modifiedAmount, sizeof(stats->modifiedAmount), 1, statsFile) != 1 ||
+		fread(&stats->attributeAmount, sizeof(stats->attributeAmount), 1, statsFile) != 1 ||
+		stats->attributeAmount < 0 || stats->attributeAmount > __MAX_ATTRIBUTE_ON_TABLE ||
+		fread(stats->column, sizeof(ColumnStats), stats->attributeAmount, statsFile) != (size_t)stats->attributeAmount
+	)
+	{
+		free(stats);
+		stats = NULL;
+	}
+	fclose(statsFile);
+	return stats;
+}
+
+int saveTableStats(char database[], char table[], TableStats *stats)
+{
+	char filePath[1024];
+	statsFilePath(filePath, database, table);
+	FILE *statsFile = fopen(filePath, "w");
+	if (statsFile == NULL)
+	{
+		return 0;
+	}
+	
+	fwrite(&stats->rowAmount, sizeof(stats->rowAmount), 1, statsFile);
+	fwrite(&stats->modifiedAmount, sizeof(stats->modifiedAmount), 1, statsFile);
+	fwrite(&stats->attributeAmount, sizeof(stats->attributeAmount), 1, statsFile);
+	fwrite(stats->column, sizeof(ColumnStats), stats->attributeAmount, statsFile);
+	fclose(statsFile);
+	return 1;
+}
+
+void resetTableStats(char database[], char table[])
+{
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute = 0;
+	if (readTableAttribute(database, table, &totalAttribute, attribute, NULL) == 1)
+	{
+		TableStats *stats = newTableStats(attribute, totalAttribute);
+		saveTableStats(database, table, stats);
+		free(stats);
+	}
+}
+
+void recordTableInsert(char database[], char table[], RecordBlock *newRecordBlock[], int amount)
+{
+	TableStats *stats = loadTableStats(database, table);
+	if (stats == NULL)
+	{
+		return;
+	}
+	
+	for (int k = 0; k < amount; k++)
+	{
+		int offset = 0;
+		for (int i = 0; i < stats->attributeAmount; i++)
+		{
+			addColumnStatsValue(&stats->column[i], (char *)newRecordBlock[k]->data + offset);
+			offset += stats->column[i].attribute.size;
+		}
+	}
+	stats->rowAmount += amount;
+	stats->modifiedAmount += amount;
+	
+	saveTableStats(database, table, stats);
+	free(stats);
+}
+
+void recordTableDelete(char database[], char table[], long long int deleted)
+{
+	TableStats *stats = loadTableStats(database, table);
+	if (stats == NULL || deleted <= 0)
+	{
+		free(stats);
+		return;
+	}
+	
+	stats->rowAmount = stats->rowAmount > deleted ? stats->rowAmount - deleted : 0;
+	stats->modifiedAmount += deleted;
+	
+	saveTableStats(database, table, stats);
+	free(stats);
+}
+
+int indexFilePath(char filePath[], size_t size, char database[], char table[], char attributeName[])
+{
+	int length = snprintf(filePath, size, "%s/%s/%s.index.%s", __DATABASE_ROOT, database, table, attributeName);
+	return length >= 0 && (size_t)length < size;
+}
+
+int appendIndexEntry(FILE *indexFile, unsigned int hash, long long int slot)
+{
+	long long int bucketAmount;
+	fseeko(indexFile, 0, SEEK_SET);
+	if (fread(&bucketAmount, sizeof(bucketAmount), 1, indexFile) != 1)
+	{
+		return 0;
+	}
+	
+	off_t bucketPosition = sizeof(long long int) * (1 + (hash & (bucketAmount - 1)));
+	IndexEntry entry = {slot, -1, hash};
+	fseeko(indexFile, bucketPosition, SEEK_SET);
+	fread(&entry.next, sizeof(entry.next), 1, indexFile);
+	
+	fseeko(indexFile, 0, SEEK_END);
+	long long int entryPosition = ftello(indexFile);
+	fwrite(&entry, sizeof(entry), 1, indexFile);
+	
+	fseeko(indexFile, bucketPosition, SEEK_SET);
+	fwrite(&entryPosition, sizeof(entryPosition), 1, indexFile);
+	return 1;
+}
+
+void appendTableIndexes(
+	char database[], char table[], AttributeBlock attributeBlock[], int attributeAmount, char *recordData, 
+	long long int slot
+)
+{
+	char filePath[1024];
+	int offset = 0;
+	for (int i = 0; i < attributeAmount; i++)
+	{
+		FILE *indexFile = NULL;
+		if (indexFilePath(filePath, sizeof(filePath), database, table, attributeBlock[i].attribute.attributeName) == 1)
+		{
+			indexFile = fopen(filePath, "r+");
+		}
+		if (indexFile != NULL)
+		{
+			appendIndexEntry(indexFile, hashBytes(recordData + offset, attributeBlock[i].attribute.size), slot);
+			fclose(indexFile);
+		}
+		offset += attributeBlock[i].attribute.size;
+	}
+}
+
+int buildTableIndex(char database[], char table[], char attributeName[])
+{
+	waitAsyncWrites();
+	
+	char filePath[1024];
+	char indexPath[1024];
+	char indexPathForTemp[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	
+	if (
+		isColumnarTable(database, table) || 
+		indexFilePath(indexPath, sizeof(indexPath) - strlen(" temp"), database, table, attributeName) == 0
+	)
+	{
+		return 0;
+	}
+	
+	FILE *tableFile = fopen(filePath, "r");
+	if (tableFile == NULL)
+	{
+		return 0;
+	}
+	
+	int tableData[3];
+	freadTableHeader(tableData, tableFile);
+	AttributeBlock attributeBlock[tableData[0]];
+	fread(attributeBlock, sizeof(attributeBlock[0]), tableData[0], tableFile);
+	
+	int attributeIndex = -1;
+	int offset = 0;
+	for (int i = 0; i < tableData[0] && attributeIndex == -1; i++)
+	{
+		if (strcmp(attributeBlock[i].attribute.attributeName, attributeName) == 0)
+		{
+			attributeIndex = i;
+		}
+		else
+		{
+			offset += attributeBlock[i].attribute.size;
+		}
+	}
+	if (attributeIndex == -1)
+	{
+		fclose(tableFile);
+		return 0;
+	}
+	
+	struct stat fileStat;
+	fstat(fileno(tableFile), &fileStat);
+	off_t dataStart = tableHeaderSize(tableData[0]);
+	size_t recordStride = tableData[2] + sizeOfRecordBlockHeader();
+	long long int recordTotal = (fileStat.st_size - dataStart) / recordStride;
+	
+	long long int bucketAmount = __INDEX_MIN_BUCKETS;
+	while (bucketAmount < recordTotal * 2)
+	{
+		bucketAmount *= 2;
+	}
+	long long int *bucket = malloc(sizeof(long long int) * bucketAmount);
+	memset(bucket, -1, sizeof(long long int) * bucketAmount);
+	
+	strcpy(indexPathForTemp, indexPath);
+	strcat(indexPathForTemp, " temp");
+	FILE *indexFile = fopen(indexPathForTemp, "w");
+	if (indexFile == NULL)
+	{
+		free(bucket);
+		fclose(tableFile);
+		return 0;
+	}
+	fwrite(&bucketAmount, sizeof(bucketAmount), 1, indexFile);
+	fwrite(bucket, sizeof(long long int), bucketAmount, indexFile);
+	
+	char *record = malloc(recordStride);
+	long long int entryPosition = sizeof(long long int) * (1 + bucketAmount);
+	for (long long int slot = 0; fread(record, recordStride, 1, tableFile) == 1; slot++)
+	{
+		BLOCKFLAG flag;
+		memcpy(&flag, record, sizeof(flag));
+		if (flag == FILLED)
+		{
+			unsigned int hash = hashBytes(
+				record + sizeOfRecordBlockHeader() + offset, attributeBlock[attributeIndex].attribute.size
+			);
+			IndexEntry entry = {slot, bucket[hash & (bucketAmount - 1)], hash};
+			fwrite(&entry, sizeof(entry), 1, indexFile);
+			bucket[hash & (bucketAmount - 1)] = entryPosition;
+			entryPosition += sizeof(entry);
+		}
+	}
+	
+	fseeko(indexFile, sizeof(bucketAmount), SEEK_SET);
+	fwrite(bucket, sizeof(long long int), bucketAmount, indexFile);
+	fclose(indexFile);
+	rename(indexPathForTemp, indexPath);
+	
+	free(record);
+	free(bucket);
+	fclose(tableFile);
+	return 1;
+}
+
+void rebuildTableIndexes(char database[], char table[])
+{
+	char filePath[1024];
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute = 0;
+	readTableAttribute(database, table, &totalAttribute, attribute, NULL);
+	
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		if (
+			indexFilePath(filePath, sizeof(filePath), database, table, attribute[i].attributeName) == 1 && 
+			access(filePath, F_OK) == 0
+		)
+		{
+			buildTableIndex(database, table, attribute[i].attributeName);
+		}
+	}
+}
+
+void zoneMapFilePath(char filePath[], char database[], char table[])
+{
+	sprintf(filePath, "%s/%s/%s.zonemap", __DATABASE_ROOT, database, table);
+}
+
+int isZoneMapAttribute(Attribute *attribute)
+{
+	return attribute->type != STRING && attribute->size <= __ZONE_MAP_VALUE_SIZE;
+}
+
+void addZoneEntryValue(ZoneEntry *entry, Attribute *attribute, const char *value)
+{
+	if (entry->filled == 0 || compareAttributeValue(attribute, value, entry->minValue) < 0)
+	{
+		memcpy(entry->minValue, value, attribute->size);
+	}
+	if (entry->filled == 0 || compareAttributeValue(attribute, value, entry->maxValue) > 0)
+	{
+		memcpy(entry->maxValue, value, attribute->size);
+	}
+	entry->filled = 1;
+}
+
+void addZoneBlockRecord(ZoneEntry entry[], AttributeBlock attributeBlock[], int attributeAmount, char *recordData)
+{
+	int offset = 0;
+	for (int i = 0; i < attributeAmount; i++)
+	{
+		if (isZoneMapAttribute(&attributeBlock[i].attribute))
+		{
+			addZoneEntryValue(&entry[i], &attributeBlock[i].attribute, recordData + offset);
+		}
+		offset += attributeBlock[i].attribute.size;
+	}
+}
+
+void appendZoneMap(
+	char database[], char table[], AttributeBlock attributeBlock[], int attributeAmount, char *recordData, 
+	long long int slot
+)
+{
+	char filePath[1024];
+	zoneMapFilePath(filePath, database, table);
+	FILE *zoneFile = fopen(filePath, "r+");
+	if (zoneFile == NULL)
+	{
+		return;
+	}
+	
+	int zoneAttributeAmount = 0;
+	fread(&zoneAttributeAmount, sizeof(zoneAttributeAmount), 1, zoneFile);
+	if (zoneAttributeAmount == attributeAmount)
+	{
+		ZoneEntry entry[attributeAmount];
+		memset(entry, 0, sizeof(entry));
+		off_t blockPosition = sizeof(int) + (off_t)(slot / __ZONE_MAP_BLOCK_RECORDS) * sizeof(entry);
+		
+		fseeko(zoneFile, blockPosition, SEEK_SET);
+		fread(entry, sizeof(entry), 1, zoneFile);
+		addZoneBlockRecord(entry, attributeBlock, attributeAmount, recordData);
+		fseeko(zoneFile, blockPosition, SEEK_SET);
+		fwrite(entry, sizeof(entry), 1, zoneFile);
+	}
+	fclose(zoneFile);
+}
+
+int buildTableZoneMap(char database[], char table[])
+{
+	waitAsyncWrites();
+	
+	char filePath[1024];
+	char zonePath[1024];
+	char zonePathForTemp[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	
+	if (isColumnarTable(database, table))
+	{
+		return 0;
+	}
+	
+	FILE *tableFile = fopen(filePath, "r");
+	if (tableFile == NULL)
+	{
+		return 0;
+	}
+	
+	int tableData[3];
+	freadTableHeader(tableData, tableFile);
+	AttributeBlock attributeBlock[tableData[0]];
+	fread(attributeBlock, sizeof(attributeBlock[0]), tableData[0], tableFile);
+	
+	zoneMapFilePath(zonePath, database, table);
+	strcpy(zonePathForTemp, zonePath);
+	strcat(zonePathForTemp, " temp");
+	FILE *zoneFile = fopen(zonePathForTemp, "w");
+	if (zoneFile == NULL)
+	{
+		fclose(tableFile);
+		return 0;
+	}
+	fwrite(&tableData[0], sizeof(tableData[0]), 1, zoneFile);
+	
+	size_t recordStride = tableData[2] + sizeOfRecordBlockHeader();
+	char *record = malloc(recordStride);
+	ZoneEntry entry[tableData[0]];
+	memset(entry, 0, sizeof(entry));
+	
+	long long int slot = 0;
+	for (; fread(record, recordStride, 1, tableFile) == 1; slot++)
+	{
+		if (slot > 0 && slot % __ZONE_MAP_BLOCK_RECORDS == 0)
+		{
+			fwrite(entry, sizeof(entry), 1, zoneFile);
+			memset(entry, 0, sizeof(entry));
+		}
+		
+		BLOCKFLAG flag;
+		memcpy(&flag, record, sizeof(flag));
+		if (flag == FILLED)
+		{
+			addZoneBlockRecord(entry, attributeBlock, tableData[0], record + sizeOfRecordBlockHeader());
+		}
+	}
+	if (slot > 0)
+	{
+		fwrite(entry, sizeof(entry), 1, zoneFile);
+	}
+	
+	fclose(zoneFile);
+	rename(zonePathForTemp, zonePath);
+	
+	free(record);
+	fclose(tableFile);
+	return 1;
+}
+
+int zoneMayMatch(Predicate *predicate, ZoneEntry entry[], int attributeAmount)
+{
+	if (predicate->type == AND_PREDICATE)
+	{
+		for (int i = 0; i < predicate->childAmount; i++)
+		{
+			if (zoneMayMatch(predicate->child[i], entry, attributeAmount) == 0)
+			{
+				return 0;
+			}
+		}
+		return 1;
+	}
+	if (predicate->type == OR_PREDICATE)
+	{
+		for (int i = 0; i < predicate->childAmount; i++)
+		{
+			if (zoneMayMatch(predicate->child[i], entry, attributeAmount) == 1)
+			{
+				return 1;
+			}
+		}
+		return 0;
+	}
+	if (
+		predicate->type == NOT_PREDICATE || predicate->attributeIndex >= attributeAmount || 
+		isZoneMapAttribute(&predicate->attribute) == 0 || entry[predicate->attributeIndex].filled == 0
+	)
+	{
+		return 1;
+	}
+	
+	Attribute *attribute = &predicate->attribute;
+	ZoneEntry *zone = &entry[predicate->attributeIndex];
+	
+	if (predicate->type == IN_PREDICATE)
+	{
+		for (int i = 0; i < predicate->valueAmount; i++)
+		{
+			char *value = predicate->value + (size_t)i * attribute->size;
+			if (
+				compareAttributeValue(attribute, value, zone->minValue) >= 0 && 
+				compareAttributeValue(attribute, value, zone->maxValue) <= 0
+			)
+			{
+				return 1;
+			}
+		}
+		return 0;
+	}
+	
+	int minCompared = compareAttributeValue(attribute, zone->minValue, predicate->value);
+	int maxCompared = compareAttributeValue(attribute, zone->maxValue, predicate->value);
+	
+	if (predicate->op == EQUAL)
+	{
+		return minCompared <= 0 && maxCompared >= 0;
+	}
+	if (predicate->op == NOT_EQUAL)
+	{
+		return minCompared != 0 || maxCompared != 0;
+	}
+	if (predicate->op == LESS)
+	{
+		return minCompared < 0;
+	}
+	if (predicate->op == LESS_EQUAL)
+	{
+		return minCompared <= 0;
+	}
+	if (predicate->op == GREATER)
+	{
+		return maxCompared > 0;
+	}
+	return maxCompared >= 0;
+}
+
+char* buildZoneSkipList(char database[], char table[], Predicate *where, long long int *blockAmount)
+{
+	*blockAmount = 0;
+	if (where == NULL)
+	{
+		return NULL;
+	}
+	
+	char filePath[1024];
+	zoneMapFilePath(filePath, database, table);
+	FILE *zoneFile = fopen(filePath, "r");
+	if (zoneFile == NULL)
+	{
+		return NULL;
+	}
+	
+	int attributeAmount = 0;
+	fread(&attributeAmount, sizeof(attributeAmount), 1, zoneFile);
+	struct stat fileStat;
+	fstat(fileno(zoneFile), &fileStat);
+	
+	char *skipBlock = NULL;
+	int skipped = 0;
+	if (attributeAmount > 0 && attributeAmount <= __MAX_ATTRIBUTE_ON_TABLE)
+	{
+		ZoneEntry entry[attributeAmount];
+		*blockAmount = (fileStat.st_size - sizeof(int)) / sizeof(entry);
+		skipBlock = calloc(*blockAmount + 1, 1);
+		
+		for (long long int i = 0; i < *blockAmount && fread(entry, sizeof(entry), 1, zoneFile) == 1; i++)
+		{
+			skipBlock[i] = zoneMayMatch(where, entry, attributeAmount) == 0;
+			skipped += skipBlock[i];
+		}
+	}
+	fclose(zoneFile);
+	
+	if (skipped == 0)
+	{
+		free(skipBlock);
+		skipBlock = NULL;
+		*blockAmount = 0;
+	}
+	return skipBlock;
+}
+
+int isRecordBlockSkipped(char *skipBlock, long long int blockAmount, long long int record)
+{
+	long long int block = record / __ZONE_MAP_BLOCK_RECORDS;
+	return skipBlock != NULL && block < blockAmount && skipBlock[block] == 1;
+}
+
+int isRecordRangeSkipped(char *skipBlock, long long int blockAmount, long long int firstRecord, long long int recordAmount)
+{
+	for (
+		long long int record = firstRecord; 
+		record < firstRecord + recordAmount; 
+		record = (record / __ZONE_MAP_BLOCK_RECORDS + 1) * __ZONE_MAP_BLOCK_RECORDS
+	)
+	{
+		if (isRecordBlockSkipped(skipBlock, blockAmount, record) == 0)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+long long int countScannedRecords(char *skipBlock, long long int blockAmount, long long int recordTotal)
+{
+	long long int scanned = recordTotal;
+	for (long long int i = 0; i < blockAmount && skipBlock != NULL; i++)
+	{
+		if (skipBlock[i] == 1)
+		{
+			long long int blockEnd = (i + 1) * __ZONE_MAP_BLOCK_RECORDS;
+			long long int blockStart = i * __ZONE_MAP_BLOCK_RECORDS;
+			if (blockStart < recordTotal)
+			{
+				scanned -= (blockEnd < recordTotal ? blockEnd : recordTotal) - blockStart;
+			}
+		}
+	}
+	return scanned;
+}
+
+void pageFilePath(char filePath[], char database[], char table[], int directory)
+{
+	sprintf(filePath, "%s/%s/%s.%s", __DATABASE_ROOT, database, table, directory == 1 ? "pagedir" : "pages");
+}
+
+int isCompressedTable(char database[], char table[])
+{
+	char filePath[1024];
+	pageFilePath(filePath, database, table, 1);
+	return access(filePath, F_OK) == 0;
+}
+
+size_t compressPageBound(size_t sourceSize)
+{
+	return sourceSize + sourceSize / 128 + 1;
+}
+
+size_t flushPageLiteral(const unsigned char *source, size_t literalSize, unsigned char *target)
+{
+	size_t written = 0;
+	while (literalSize > 0)
+	{
+		size_t chunk = literalSize < 128 ? literalSize : 128;
+		target[written++] = (unsigned char)(chunk - 1);
+		memcpy(target + written, source, chunk);
+		written += chunk;
+		source += chunk;
+		literalSize -= chunk;
+	}
+	return written;
+}
+
+size_t compressPage(const unsigned char *source, size_t sourceSize, unsigned char *target)
+{
+	size_t maxRun = 127 + __COMPRESSION_MIN_RUN;
+	size_t written = 0;
+	size_t literalStart = 0;
+	size_t position = 0;
+	
+	while (position < sourceSize)
+	{
+		size_t run = 1;
+		while (position + run < sourceSize && run < maxRun && source[position + run] == source[position])
+		{
+			run++;
+		}
+		
+		if (run >= __COMPRESSION_MIN_RUN)
+		{
+			written += flushPageLiteral(source + literalStart, position - literalStart, target + written);
+			target[written++] = (unsigned char)(128 + run - __COMPRESSION_MIN_RUN);
+			target[written++] = source[position];
+			position += run;
+			literalStart = position;
+		}
+		else
+		{
+			position++;
+		}
+	}
+	written += flushPageLiteral(source + literalStart, position - literalStart, target + written);
+	return written;
+}
+
+long long int decompressPage(const unsigned char *source, size_t compressedSize, unsigned char *target, size_t targetSize)
+{
+	size_t position = 0;
+	size_t written = 0;
+	while (position < compressedSize)
+	{
+		unsigned char control = source[position++];
+		if (control < 128)
+		{
+			size_t literalSize = (size_t)control + 1;
+			if (position + literalSize > compressedSize || written + literalSize > targetSize)
+			{
+				return -1;
+			}
+			memcpy(target + written, source + position, literalSize);
+			position += literalSize;
+			written += literalSize;
+		}
+		else
+		{
+			size_t run = (size_t)control - 128 + __COMPRESSION_MIN_RUN;
+			if (position >= compressedSize || written + run > targetSize)
+			{
+				return -1;
+			}
+			memset(target + written, source[position++], run);
+			written += run;
+		}
+	}
+	return written;
+}
+
+int buildTableCompressedPages(char database[], char table[])
+{
+	waitAsyncWrites();
+	
+	if (isColumnarTable(database, table))
+	{
+		return 0;
+	}
+	
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r");
+	if (tableFile == NULL)
+	{
+		return 0;
+	}
+	
+	int tableData[3];
+	freadTableHeader(tableData, tableFile);
+	fseeko(tableFile, tableData[0] * sizeof(AttributeBlock), SEEK_CUR);
+	
+	char pagePath[1024];
+	char pagePathForTemp[1024];
+	char directoryPath[1024];
+	char directoryPathForTemp[1024];
+	pageFilePath(pagePath, database, table, 0);
+	pageFilePath(directoryPath, database, table, 1);
+	strcpy(pagePathForTemp, pagePath);
+	strcat(pagePathForTemp, " temp");
+	strcpy(directoryPathForTemp, directoryPath);
+	strcat(directoryPathForTemp, " temp");
+	
+	FILE *pageFile = fopen(pagePathForTemp, "w");
+	FILE *directoryFile = fopen(directoryPathForTemp, "w");
+	if (pageFile == NULL || directoryFile == NULL)
+	{
+		if (pageFile != NULL)
+		{
+			fclose(pageFile);
+		}
+		if (directoryFile != NULL)
+		{
+			fclose(directoryFile);
+		}
+		fclose(tableFile);
+		return 0;
+	}
+	
+	PageDirectoryHeader header;
+	memset(&header, 0, sizeof(header));
+	header.recordStride = tableData[2] + sizeOfRecordBlockHeader();
+	header.pageRecords = __ZONE_MAP_BLOCK_RECORDS;
+	fwrite(&header, sizeof(header), 1, directoryFile);
+	
+	size_t pageSize = (size_t)header.recordStride * header.pageRecords;
+	unsigned char *page = malloc(pageSize);
+	unsigned char *compressed = malloc(compressPageBound(pageSize));
+	
+	PageDirectoryEntry entry;
+	entry.offset = 0;
+	size_t recordAmount;
+	while ((recordAmount = fread(page, header.recordStride, header.pageRecords, tableFile)) > 0)
+	{
+		entry.recordAmount = recordAmount;
+		entry.compressedSize = compressPage(page, recordAmount * header.recordStride, compressed);
+		fwrite(compressed, 1, entry.compressedSize, pageFile);
+		fwrite(&entry, sizeof(entry), 1, directoryFile);
+		
+		entry.offset += entry.compressedSize;
+		header.recordTotal += recordAmount;
+		header.pageAmount++;
+	}
+	
+	fseeko(directoryFile, 0, SEEK_SET);
+	fwrite(&header, sizeof(header), 1, directoryFile);
+	
+	free(page);
+	free(compressed);
+	fclose(pageFile);
+	fclose(directoryFile);
+	fclose(tableFile);
+	
+	rename(pagePathForTemp, pagePath);
+	rename(directoryPathForTemp, directoryPath);
+	return 1;
+}
+
+PageDirectoryEntry* loadFreshPageDirectory(
+	char database[], char table[], size_t recordStride, long long int recordTotal, PageDirectoryHeader *header
+)
+{
+	char filePath[1024];
+	pageFilePath(filePath, database, table, 1);
+	FILE *directoryFile = fopen(filePath, "r");
+	if (directoryFile == NULL)
+	{
+		return NULL;
+	}
+	
+	PageDirectoryEntry *entry = NULL;
+	if (
+		fread(header, sizeof(PageDirectoryHeader), 1, directoryFile) == 1 && 
+		header->generation % 2 == 0 && 
+		header->recordTotal == recordTotal && 
+		header->recordStride == (int)recordStride && 
+		header->pageRecords == __ZONE_MAP_BLOCK_RECORDS
+	)
+	{
+		entry = malloc(sizeof(PageDirectoryEntry) * (header->pageAmount + 1));
+		if (fread(entry, sizeof(PageDirectoryEntry), header->pageAmount, directoryFile) != (size_t)header->pageAmount)
+		{
+			free(entry);
+			entry = NULL;
+		}
+	}
+	fclose(directoryFile);
+	return entry;
+}
+
+void beginCompressedPageWrite(char database[], char table[])
+{
+	char filePath[1024];
+	pageFilePath(filePath, database, table, 1);
+	FILE *directoryFile = fopen(filePath, "r+");
+	if (directoryFile == NULL)
+	{
+		return;
+	}
+	
+	PageDirectoryHeader header;
+	if (fread(&header, sizeof(header), 1, directoryFile) == 1 && header.generation % 2 == 0)
+	{
+		header.generation++;
+		fseeko(directoryFile, 0, SEEK_SET);
+		fwrite(&header, sizeof(header), 1, directoryFile);
+	}
+	fclose(directoryFile);
+}
+
+int refreshCompressedPages(
+	char database[], char table[], int tableFileDescriptor, off_t dataStart, size_t recordStride, 
+	char dirtyPage[], long long int pageAmount
+)
+{
+	char pagePath[1024];
+	char directoryPath[1024];
+	pageFilePath(pagePath, database, table, 0);
+	pageFilePath(directoryPath, database, table, 1);
+	FILE *pageFile = fopen(pagePath, "r+");
+	FILE *directoryFile = fopen(directoryPath, "r+");
+	
+	PageDirectoryHeader header;
+	if (
+		pageFile == NULL || directoryFile == NULL || 
+		fread(&header, sizeof(header), 1, directoryFile) != 1 || 
+		header.recordStride != (int)recordStride || 
+		header.pageRecords != __ZONE_MAP_BLOCK_RECORDS
+	)
+	{
+		if (pageFile != NULL)
+		{
+			fclose(pageFile);
+		}
+		if (directoryFile != NULL)
+		{
+			fclose(directoryFile);
+		}
+		return 0;
+	}
+	
+	long long int entryAmount = header.pageAmount > pageAmount ? header.pageAmount : pageAmount;
+	PageDirectoryEntry *entry = calloc(entryAmount + 1, sizeof(PageDirectoryEntry));
+	int written = fread(entry, sizeof(PageDirectoryEntry), header.pageAmount, directoryFile) == (size_t)header.pageAmount;
+	
+	size_t pageSize = recordStride * header.pageRecords;
+	unsigned char *page = malloc(pageSize);
+	unsigned char *compressed = malloc(compressPageBound(pageSize));
+	fseeko(pageFile, 0, SEEK_END);
+	off_t pageEnd = ftello(pageFile);
+	
+	for (long long int i = 0; i < pageAmount && written == 1; i++)
+	{
+		if (i < header.pageAmount && dirtyPage[i] == 0)
+		{
+			continue;
+		}
+		
+		ssize_t readBytes = pread(tableFileDescriptor, page, pageSize, dataStart + i * pageSize);
+		int recordAmount = readBytes > 0 ? readBytes / recordStride : 0;
+		size_t compressedSize = compressPage(page, recordAmount * recordStride, compressed);
+		
+		off_t offset = pageEnd;
+		if (
+			i < header.pageAmount && 
+			(compressedSize <= (size_t)entry[i].compressedSize || entry[i].offset + entry[i].compressedSize == pageEnd)
+		)
+		{
+			offset = entry[i].offset;
+		}
+		if (offset + (off_t)compressedSize > pageEnd)
+		{
+			pageEnd = offset + compressedSize;
+		}
+		
+		header.recordTotal += recordAmount - entry[i].recordAmount;
+		entry[i].offset = offset;
+		entry[i].compressedSize = compressedSize;
+		entry[i].recordAmount = recordAmount;
+		
+		fseeko(pageFile, offset, SEEK_SET);
+		fseeko(directoryFile, sizeof(header) + i * sizeof(PageDirectoryEntry), SEEK_SET);
+		written = fwrite(compressed, 1, compressedSize, pageFile) == compressedSize && 
+			fwrite(&entry[i], sizeof(PageDirectoryEntry), 1, directoryFile) == 1;
+	}
+	
+	free(page);
+	free(compressed);
+	free(entry);
+	
+	if (fclose(pageFile) == 0 && written == 1)
+	{
+		header.pageAmount = entryAmount;
+		header.generation = (header.generation | 1) + 1;
+		fseeko(directoryFile, 0, SEEK_SET);
+		fwrite(&header, sizeof(header), 1, directoryFile);
+	}
+	fclose(directoryFile);
+	return written;
+}
+
+void markDirtyPages(char dirtyPage[], long long int firstSlot, long long int slotAmount)
+{
+	if (dirtyPage == NULL || slotAmount <= 0)
+	{
+		return;
+	}
+	
+	for (
+		long long int page = firstSlot / __ZONE_MAP_BLOCK_RECORDS; 
+		page <= (firstSlot + slotAmount - 1) / __ZONE_MAP_BLOCK_RECORDS; 
+		page++
+	)
+	{
+		dirtyPage[page] = 1;
+	}
+}
+
+void bloomFilterPath(char filePath[], char database[], char table[], char attributeName[])
+{
+	sprintf(filePath, "%s/%s/%s.bloom.%s", __DATABASE_ROOT, database, table, attributeName);
+}
+
+void initBloomHeader(BloomHeader *header, long long int capacity, double falsePositiveRate)
+{
+	memset(header, 0, sizeof(BloomHeader));
+	header->falsePositiveRate = falsePositiveRate;
+	header->capacity = capacity > __BLOOM_MIN_CAPACITY ? capacity : __BLOOM_MIN_CAPACITY;
+	
+	for (double inverse = 1 / falsePositiveRate; inverse > 1; inverse /= 2)
+	{
+		header->hashAmount += 1;
+	}
+	if (header->hashAmount == 0)
+	{
+		header->hashAmount = 1;
+	}
+	header->bitAmount = ((long long int)(header->capacity * header->hashAmount * 1.4427) + 63) / 64 * 64;
+}
+
+long long int bloomBitPosition(BloomHeader *header, const char *value, int size, int probe)
+{
+	unsigned int firstHash = hashBytes(value, size);
+	unsigned int secondHash = mixStatsHash(firstHash ^ 0x9e3779b9u) | 1;
+	return ((unsigned long long int)firstHash + (unsigned long long int)probe * secondHash) % header->bitAmount;
+}
+
+void setBloomBits(BloomHeader *header, unsigned char bit[], const char *value, int size)
+{
+	for (int i = 0; i < header->hashAmount; i++)
+	{
+		long long int position = bloomBitPosition(header, value, size, i);
+		bit[position >> 3] |= 1 << (position & 7);
+	}
+}
+
+int bloomMayContain(FILE *bloomFile, BloomHeader *header, const char *value, int size)
+{
+	for (int i = 0; i < header->hashAmount; i++)
+	{
+		long long int position = bloomBitPosition(header, value, size, i);
+		unsigned char byte = 0;
+		fseeko(bloomFile, sizeof(BloomHeader) + (position >> 3), SEEK_SET);
+		if (fread(&byte, 1, 1, bloomFile) != 1 || (byte & (1 << (position & 7))) == 0)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int buildTableBloomFilter(char database[], char table[], char attributeName[], double falsePositiveRate)
+{
+	waitAsyncWrites();
+	
+	char filePath[1024];
+	char bloomPath[1024];
+	char bloomPathForTemp[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	
+	if (isColumnarTable(database, table) || falsePositiveRate <= 0 || falsePositiveRate >= 1)
+	{
+		return 0;
+	}
+	
+	FILE *tableFile = fopen(filePath, "r");
+	if (tableFile == NULL)
+	{
+		return 0;
+	}
+	
+	int tableData[3];
+	freadTableHeader(tableData, tableFile);
+	AttributeBlock attributeBlock[tableData[0]];
+	fread(attributeBlock, sizeof(attributeBlock[0]), tableData[0], tableFile);
+	
+	int attributeIndex = -1;
+	int offset = 0;
+	for (int i = 0; i < tableData[0] && attributeIndex == -1; i++)
+	{
+		if (strcmp(attributeBlock[i].attribute.attributeName, attributeName) == 0)
+		{
+			attributeIndex = i;
+		}
+		else
+		{
+			offset += attributeBlock[i].attribute.size;
+		}
+	}
+	if (attributeIndex == -1)
+	{
+		fclose(tableFile);
+		return 0;
+	}
+	
+	struct stat fileStat;
+	fstat(fileno(tableFile), &fileStat);
+	off_t dataStart = tableHeaderSize(tableData[0]);
+	size_t recordStride = tableData[2] + sizeOfRecordBlockHeader();
+	
+	BloomHeader header;
+	initBloomHeader(&header, (fileStat.st_size - dataStart) / recordStride * 2, falsePositiveRate);
+	unsigned char *bit = calloc(header.bitAmount / 8, 1);
+	
+	char *record = malloc(recordStride);
+	while (fread(record, recordStride, 1, tableFile) == 1)
+	{
+		BLOCKFLAG flag;
+		memcpy(&flag, record, sizeof(flag));
+		if (flag == FILLED)
+		{
+			setBloomBits(
+				&header, bit, record + sizeOfRecordBlockHeader() + offset, attributeBlock[attributeIndex].attribute.size
+			);
+			header.entryAmount += 1;
+		}
+	}
+	free(record);
+	fclose(tableFile);
+	
+	bloomFilterPath(bloomPath, database, table, attributeName);
+	strcpy(bloomPathForTemp, bloomPath);
+	strcat(bloomPathForTemp, " temp");
+	FILE *bloomFile = fopen(bloomPathForTemp, "w");
+	if (bloomFile == NULL)
+	{
+		free(bit);
+		return 0;
+	}
+	fwrite(&header, sizeof(header), 1, bloomFile);
+	fwrite(bit, 1, header.bitAmount / 8, bloomFile);
+	fclose(bloomFile);
+	rename(bloomPathForTemp, bloomPath);
+	
+	free(bit);
+	return 1;
+}
+
+double readBloomFalsePositiveRate(char database[], char table[], char attributeName[])
+{
+	char filePath[1024];
+	bloomFilterPath(filePath, database, table, attributeName);
+	FILE *bloomFile = fopen(filePath, "r");
+	if (bloomFile == NULL)
+	{
+		return 0;
+	}
+	
+	BloomHeader header;
+	header.falsePositiveRate = __BLOOM_FALSE_POSITIVE_RATE;
+	fread(&header, sizeof(header), 1, bloomFile);
+	fclose(bloomFile);
+	return header.falsePositiveRate;
+}
+
+void rebuildTableBloomFilters(char database[], char table[])
+{
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute = 0;
+	readTableAttribute(database, table, &totalAttribute, attribute, NULL);
+	
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		double falsePositiveRate = readBloomFalsePositiveRate(database, table, attribute[i].attributeName);
+		if (falsePositiveRate > 0)
+		{
+			buildTableBloomFilter(database, table, attribute[i].attributeName, falsePositiveRate);
+		}
+	}
+}
+
+void ensureTableBloomFilter(char database[], char table[], char attributeName[])
+{
+	if (readBloomFalsePositiveRate(database, table, attributeName) == 0)
+	{
+		buildTableBloomFilter(database, table, attributeName, __BLOOM_FALSE_POSITIVE_RATE);
+	}
+}
+
+void appendTableBloomFilters(
+	char database[], char table[], AttributeBlock attributeBlock[], int attributeAmount, char *recordData
+)
+{
+	char filePath[1024];
+	int offset = 0;
+	for (int i = 0; i < attributeAmount; i++)
+	{
+		Attribute *attribute = &attributeBlock[i].attribute;
+		bloomFilterPath(filePath, database, table, attribute->attributeName);
+		FILE *bloomFile = fopen(filePath, "r+");
+		BloomHeader header;
+		
+		if (bloomFile != NULL && fread(&header, sizeof(header), 1, bloomFile) == 1)
+		{
+			if (header.entryAmount >= header.capacity)
+			{
+				fclose(bloomFile);
+				bloomFile = NULL;
+				buildTableBloomFilter(database, table, attribute->attributeName, header.falsePositiveRate);
+			}
+			else
+			{
+				for (int j = 0; j < header.hashAmount; j++)
+				{
+					long long int position = bloomBitPosition(&header, recordData + offset, attribute->size, j);
+					unsigned char byte = 0;
+					fseeko(bloomFile, sizeof(header) + (position >> 3), SEEK_SET);
+					fread(&byte, 1, 1, bloomFile);
+					byte |= 1 << (position & 7);
+					fseeko(bloomFile, sizeof(header) + (position >> 3), SEEK_SET);
+					fwrite(&byte, 1, 1, bloomFile);
+				}
+				header.entryAmount += 1;
+				fseeko(bloomFile, 0, SEEK_SET);
+				fwrite(&header, sizeof(header), 1, bloomFile);
+			}
+		}
+		if (bloomFile != NULL)
+		{
+			fclose(bloomFile);
+		}
+		offset += attribute->size;
+	}
+}
+
+int isBloomFilterExcluded(char database[], char table[], Predicate *where)
+{
+	Predicate **conjunct = where->type == AND_PREDICATE ? where->child : &where;
+	int conjunctAmount = where->type == AND_PREDICATE ? where->childAmount : 1;
+	char filePath[1024];
+	
+	for (int i = 0; i < conjunctAmount; i++)
+	{
+		Predicate *predicate = conjunct[i];
+		if ((predicate->type != COMPARE_PREDICATE || predicate->op != EQUAL) && predicate->type != IN_PREDICATE)
+		{
+			continue;
+		}
+		
+		bloomFilterPath(filePath, database, table, predicate->attribute.attributeName);
+		FILE *bloomFile = fopen(filePath, "r");
+		BloomHeader header;
+		if (bloomFile == NULL)
+		{
+			continue;
+		}
+		
+		int mayContain = fread(&header, sizeof(header), 1, bloomFile) != 1;
+		int valueAmount = predicate->type == IN_PREDICATE ? predicate->valueAmount : 1;
+		for (int j = 0; j < valueAmount && mayContain == 0; j++)
+		{
+			mayContain = bloomMayContain(
+				bloomFile, &header, predicate->value + (size_t)j * predicate->attribute.size, predicate->attribute.size
+			);
+		}
+		fclose(bloomFile);
+		
+		if (mayContain == 0)
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int compareSlot(const void *a, const void *b)
+{
+	long long int x = *(const long long int *)a;
+	long long int y = *(const long long int *)b;
+	return (x > y) - (x < y);
+}
+
+int lookupIndexSlots(
+	char database[], char table[], Predicate *predicate, long long int **slot, long long int *slotAmount
+)
+{
+	char filePath[1024];
+	if (indexFilePath(filePath, sizeof(filePath), database, table, predicate->attribute.attributeName) == 0)
+	{
+		return 0;
+	}
+	FILE *indexFile = fopen(filePath, "r");
+	if (indexFile == NULL)
+	{
+		return 0;
+	}
+	
+	long long int bucketAmount;
+	fread(&bucketAmount, sizeof(bucketAmount), 1, indexFile);
+	
+	long long int slotCapacity = 16;
+	*slot = malloc(sizeof(long long int) * slotCapacity);
+	*slotAmount = 0;
+	
+	int valueAmount = predicate->type == IN_PREDICATE ? predicate->valueAmount : 1;
+	for (int i = 0; i < valueAmount; i++)
+	{
+		unsigned int hash = hashBytes(predicate->value + (size_t)i * predicate->attribute.size, predicate->attribute.size);
+		long long int position;
+		fseeko(indexFile, sizeof(long long int) * (1 + (hash & (bucketAmount - 1))), SEEK_SET);
+		fread(&position, sizeof(position), 1, indexFile);
+		
+		while (position != -1)
+		{
+			IndexEntry entry;
+			fseeko(indexFile, position, SEEK_SET);
+			if (fread(&entry, sizeof(entry), 1, indexFile) != 1)
+			{
+				break;
+			}
+			if (entry.hash == hash)
+			{
+				if (*slotAmount == slotCapacity)
+				{
+					slotCapacity *= 2;
+					*slot = realloc(*slot, sizeof(long long int) * slotCapacity);
+				}
+				(*slot)[(*slotAmount)++] = entry.slot;
+			}
+			position = entry.next;
+		}
+	}
+	fclose(indexFile);
+	
+	qsort(*slot, *slotAmount, sizeof(long long int), compareSlot);
+	long long int uniqueAmount = 0;
+	for (long long int i = 0; i < *slotAmount; i++)
+	{
+		if (uniqueAmount == 0 || (*slot)[uniqueAmount - 1] != (*slot)[i])
+		{
+			(*slot)[uniqueAmount++] = (*slot)[i];
+		}
+	}
+	*slotAmount = uniqueAmount;
+	return 1;
+}
+
+int chooseIndexSlots(
+	char database[], char table[], Predicate *where, long long int rowAmount, long long int maxSlotAmount, 
+	long long int **slot, long long int *slotAmount
+)
+{
+	Predicate **conjunct = where->type == AND_PREDICATE ? where->child : &where;
+	int conjunctAmount = where->type == AND_PREDICATE ? where->childAmount : 1;
+	int chosen = 0;
+	
+	for (int i = 0; i < conjunctAmount && (chosen == 0 || *slotAmount > 0); i++)
+	{
+		long long int *candidateSlot;
+		long long int candidateAmount;
+		if (
+			((conjunct[i]->type == COMPARE_PREDICATE && conjunct[i]->op == EQUAL) || conjunct[i]->type == IN_PREDICATE) &&
+			conjunct[i]->selectivity * rowAmount <= maxSlotAmount &&
+			lookupIndexSlots(database, table, conjunct[i], &candidateSlot, &candidateAmount) == 1
+		)
+		{
+			if (candidateAmount <= maxSlotAmount && (chosen == 0 || candidateAmount < *slotAmount))
+			{
+				if (chosen == 1)
+				{
+					free(*slot);
+				}
+				*slot = candidateSlot;
+				*slotAmount = candidateAmount;
+				chosen = 1;
+			}
+			else
+			{
+				free(candidateSlot);
+			}
+		}
+	}
+	return chosen;
+}
+
+AccessPath chooseAccessPath(
+	char database[], char table[], long long int recordTotal, size_t recordStride, Predicate *where, 
+	int allowParallel, long long int **slot, long long int *slotAmount
+)
+{
+	AccessPath path = SEQUENTIAL_SCAN;
+	double scanCost = recordTotal;
+	
+	if (allowParallel == 1 && scanThreadAmount > 1 && recordTotal * recordStride >= __PARALLEL_SCAN_MIN_BYTES)
+	{
+		path = PARALLEL_SCAN;
+		scanCost = (double)recordTotal / scanThreadAmount;
+	}
+	
+	if (where == NULL)
+	{
+		return path;
+	}
+	
+	TableStats *stats = loadTableStats(database, table);
+	long long int rowAmount = stats != NULL ? stats->rowAmount : recordTotal;
+	free(stats);
+	
+	if (
+		chooseIndexSlots(
+			database, table, where, rowAmount, (long long int)(scanCost / __INDEX_RANDOM_READ_COST), slot, slotAmount
+		) == 1
+	)
+	{
+		path = INDEX_SCAN;
+	}
+	return path;
+}
+
+int insertRecordsIntoRowTable(char database[], char table[], RecordBlock *newRecordBlock[], int amount)
+{	
+	waitAsyncWrites();
+	
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r+");
+	
+	if (tableFile == NULL)
+	{
+		return 0;
+	}
+	
+	int tableData[3];
+	freadTableHeader(tableData, tableFile);
+	
+	AttributeBlock attributeBlock[tableData[0]];
+	fread(attributeBlock, sizeof(attributeBlock[0]), tableData[0], tableFile);
+	off_t dataStart = ftello(tableFile);
+	
+	struct stat fileStat;
+	fstat(fileno(tableFile), &fileStat);
+	
+	RecordBlock reader;
+	initRecordBlock(&reader, tableData[2]);
+	size_t recordBlockMemorySize = tableData[2] + sizeOfRecordBlockHeader();
+	long long int horizon = oldestActiveSnapshot();
+	long long int appendSlot = (fileStat.st_size - dataStart) / recordBlockMemorySize;
+	char *recordBuffer = malloc(recordBlockMemorySize);
+	
+	char *dirtyPage = NULL;
+	if (isCompressedTable(database, table))
+	{
+		beginCompressedPageWrite(database, table);
+		dirtyPage = calloc((appendSlot + amount) / __ZONE_MAP_BLOCK_RECORDS + 1, sizeof(char));
+	}
+	
+	for (int i = 0; i < amount; i++)
+	{
+		long long int slot = -1;
+		while(slot == -1 && freadRecordBlock(&reader, tableFile) == 1)
+		{
+			if (reader.flag == EMPTY || isVersionReclaimable(reader.createdTransaction, reader.deletedTransaction, horizon)) {
+				slot = (ftello(tableFile) - dataStart) / recordBlockMemorySize - 1;
+			}
+		}
+		if (slot == -1)
+		{
+			slot = appendSlot++;
+		}
+		
+		newRecordBlock[i]->flag = FILLED;
+		newRecordBlock[i]->createdTransaction = transactionManager.writeTransaction;
+		newRecordBlock[i]->deletedTransaction = 0;
+		
+		encodeRecordBlockHeader(newRecordBlock[i], recordBuffer);
+		memcpy(recordBuffer + sizeOfRecordBlockHeader(), newRecordBlock[i]->data, newRecordBlock[i]->size);
+		submitAsyncWrite(fileno(tableFile), recordBuffer, recordBlockMemorySize, dataStart + slot * recordBlockMemorySize);
+		markDirtyPages(dirtyPage, slot, 1);
+		
+		appendTableIndexes(database, table, attributeBlock, tableData[0], newRecordBlock[i]->data, slot);
+		appendZoneMap(database, table, attributeBlock, tableData[0], newRecordBlock[i]->data, slot);
+	}
+	free(recordBuffer);
+	delRecordBlock(&reader);
+	
+	if (waitAsyncWrites() == 0)
+	{
+		free(dirtyPage);
+		fclose(tableFile);
+		return 0;
+	}
+	
+	if (dirtyPage != NULL)
+	{
+		long long int pageAmount = (appendSlot + __ZONE_MAP_BLOCK_RECORDS - 1) / __ZONE_MAP_BLOCK_RECORDS;
+		refreshCompressedPages(database, table, fileno(tableFile), dataStart, recordBlockMemorySize, dirtyPage, pageAmount);
+		free(dirtyPage);
+	}
+	
+	fseek(tableFile, 0, SEEK_SET);
+	tableData[1] += amount;
+	fwriteTableHeader(tableData, tableFile);
+	
+	fclose(tableFile);
+	for (int i = 0; i < amount; i++)
+	{
+		appendTableBloomFilters(database, table, attributeBlock, tableData[0], newRecordBlock[i]->data);
+	}
+
+	return amount;
+}
+
+int insertRecordsIntoDatabaseTable(char database[], char table[], RecordBlock *newRecordBlock[], int amount)
+{
+	if (beginWriteTransaction() == 0)
+	{
+		return 0;
+	}
+	
+	int inserted = 0;
+	if (isColumnarTable(database, table))
+	{
+		while (inserted < amount && insertIntoColumnarTable(database, table, newRecordBlock[inserted]) == 1)
+		{
+			inserted++;
+		}
+	}
+	else
+	{
+		inserted = insertRecordsIntoRowTable(database, table, newRecordBlock, amount);
+	}
+	
+	if (inserted > 0)
+	{
+		recordTableInsert(database, table, newRecordBlock, inserted);
+		bumpTableVersion(database, table);
+	}
+	
+	if (endWriteTransaction(inserted == amount, 0) == 0)
+	{
+		inserted = 0;
+	}
+	return inserted;
+}
+
+int insertIntoDatabaseTable(char database[], char table[], RecordBlock *newRecordBlock)
+{
+	return insertRecordsIntoDatabaseTable(database, table, &newRecordBlock, 1);
+}
+
+WriteSetEntry* appendWriteSetEntry(
+	Transaction *transaction, WriteOperation operation, char database[], char table[], int recordBlockSize
+)
+{
+	WriteSetEntry *entry = calloc(1, sizeof(WriteSetEntry));
+	size_t databaseLength = strnlen(database, sizeof(entry->database));
+	size_t tableLength = strnlen(table, sizeof(entry->table));
+	if (
+		databaseLength == sizeof(entry->database) || tableLength == sizeof(entry->table) || 
+		isColumnarTable(database, table) == 1
+	)
+	{
+		free(entry);
+		return NULL;
+	}
+	
+	entry->operation = operation;
+	memcpy(entry->database, database, databaseLength + 1);
+	memcpy(entry->table, table, tableLength + 1);
+	entry->recordBlockSize = recordBlockSize;
+	
+	if (transaction->tail != NULL)
+	{
+		transaction->tail->next = entry;
+	}
+	else
+	{
+		transaction->head = entry;
+	}
+	transaction->tail = entry;
+	transaction->entryAmount++;
+	return entry;
+}
+
+void delTransaction(Transaction *transaction)
+{
+	WriteSetEntry *entry = transaction->head;
+	while (entry != NULL)
+	{
+		WriteSetEntry *next = entry->next;
+		if (entry->operation == WRITE_INSERT)
+		{
+			delRecordBlock(&entry->record);
+		}
+		delPredicate(entry->where);
+		free(entry->setValue);
+		free(entry);
+		entry = next;
+	}
+	free(transaction);
+}
+
+int parseInsertRecord(char stringRecordData[], Attribute attribute[], int totalAttribute, RecordBlock *record)
+{
+	int result = 1;
+	int recordBlockDataOffset = 0;
+	
+	int strLength = strlen(stringRecordData);
+	int flagSingleQuote = 0;
+	
+	char *value[__MAX_ATTRIBUTE_ON_TABLE];
+	int valueAmount = 0;
+	int valueOpen = 0;
+	int writeOffset = 0;
+	for (int i = 0; i < strLength; i++)
+	{
+		char character = stringRecordData[i];
+		if ((character == ' ' || character == ',') && flagSingleQuote == 0)
+		{
+			if (valueOpen == 1)
+			{
+				stringRecordData[writeOffset++] = '\0';
+				valueOpen = 0;
+			}
+			continue;
+		}
+		
+		if (valueOpen == 0 && valueAmount < __MAX_ATTRIBUTE_ON_TABLE)
+		{
+			value[valueAmount++] = stringRecordData + writeOffset;
+		}
+		valueOpen = 1;
+		
+		if (character == '\'' && flagSingleQuote == 1 && stringRecordData[i + 1] == '\'')
+		{
+			stringRecordData[writeOffset++] = '\'';
+			i++;
+		}
+		else if (character == '\'')
+		{
+			flagSingleQuote = flagSingleQuote == 0 ? 1 : 0;
+		}
+		else
+		{
+			stringRecordData[writeOffset++] = character;
+		}
+	}
+	stringRecordData[writeOffset] = '\0';
+	
+	for (int i = 0; i < totalAttribute && result == 1 && i < valueAmount; i++)
+	{
+		if (
+			attribute[i].type == STRING || attribute[i].type == TIME || 
+			attribute[i].type == DATE || attribute[i].type == DATETIME
+		)
+		{	
+			int stringLength = strlen(value[i]);
+			memcpy(
+				record->data + recordBlockDataOffset, value[i], 
+				attribute[i].size < stringLength ? attribute[i].size : stringLength
+			);
+		}
+		else 
+		{
+			if (attribute[i].type == INT)
+			{
+				int data = 0;
+				result = sscanf(value[i], "%d", &data);
+				memcpy(record->data + recordBlockDataOffset, &data, sizeof(data));
+			}
+			else if (attribute[i].type == LONG)
+			{
+				long long int data = 0;
+				result = sscanf(value[i], "%lld", &data);
+				memcpy(record->data + recordBlockDataOffset, &data, sizeof(data));
+			}
+			else if (attribute[i].type == DECIMAL)
+			{
+				double data = 0;
+				result = sscanf(value[i], "%lf", &data);
+				memcpy(record->data + recordBlockDataOffset, &data, sizeof(data));
+			}
+		}
+		recordBlockDataOffset += attribute[i].size;
+	}
+	
+	return result;
+}
+
+int insertIntoDatabaseScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (clientAccount->openningDatabase == 1)
+	{
+		char tableName[64];
+		strcpy(tableName, (*queue)->parsedString);
+		convertToLower(tableName, strlen(tableName));
+		
+		popParsedStringQueue(queue);
+		
+		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+		int totalAttribute = 0;
+		int recordBlockSize = 0;
+		if (
+			*queue != NULL && 
+			readTableAttribute(clientAccount->databaseName, tableName, &totalAttribute, attribute, &recordBlockSize) == 1
+		)
+		{
+			RecordBlockVector records;
+			initRecordBlockVector(&records);
+			
+			int result = 1;
+			while (*queue != NULL && result == 1)
+			{
+				RecordBlock recordBlockForNewData;
+				initRecordBlock(&recordBlockForNewData, recordBlockSize);
+				result = parseInsertRecord((*queue)->parsedString, attribute, totalAttribute, &recordBlockForNewData);
+				appendRecordBlockVector(&records, &recordBlockForNewData);
+				popParsedStringQueue(queue);
+			}
+			
+			if (result == 1 && clientAccount->transaction != NULL)
+			{
+				for (int i = 0; i < records.size && result == 1; i++)
+				{
+					WriteSetEntry *entry = appendWriteSetEntry(
+						clientAccount->transaction, WRITE_INSERT, clientAccount->databaseName, tableName, recordBlockSize
+					);
+					if (entry == NULL)
+					{
+						result = 0;
+					}
+					else
+					{
+						entry->record = records.record[i];
+					}
+				}
+				if (result == 1)
+				{
+					records.size = 0;
+				}
+			}
+			else if (result == 1)
+			{
+				RecordBlock **newRecordBlock = malloc(sizeof(RecordBlock *) * records.size);
+				for (int i = 0; i < records.size; i++)
+				{
+					newRecordBlock[i] = &records.record[i];
+				}
+				if (insertRecordsIntoDatabaseTable(clientAccount->databaseName, tableName, newRecordBlock, records.size) < records.size)
+				{
+					result = 0;
+				}
+				free(newRecordBlock);
+			}
+			
+			delRecordBlockVector(&records);
+			return result;
+		}
+	}
+	return 0;
+}
+
+int findTableAttributeIndex(Attribute attribute[], int totalAttribute, char name[])
+{
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		if (strcasecmp(name, attribute[i].attributeName) == 0)
+		{
+			return i;
+		}
+	}
+	
+	int found = -1;
+	if (strchr(name, '.') == NULL)
+	{
+		for (int i = 0; i < totalAttribute; i++)
+		{
+			char *unqualifiedName = strchr(attribute[i].attributeName, '.');
+			if (unqualifiedName != NULL && strcasecmp(name, unqualifiedName + 1) == 0)
+			{
+				if (found != -1)
+				{
+					return -1;
+				}
+				found = i;
+			}
+		}
+	}
+	return found;
+}
+
+int parseAttributeAndGetValueFromString(char parsedAttribute[], Attribute attribute[], int totalAttribute, void **value, char str[])
+{
+	int strLength = strlen(str);		
+	int offset = 0;
+	int attributeParsed = 0;
+	
+	for (int i = 0; i < strLength; i++)
+	{
+		if (str[i] == '=')
+		{
+			attributeParsed = 1;
+			str[i]	= '\0';
+		}
+		else if (str[i] == '\'')
+		{
+			str[i]	= '\0';
+		}
+		else if (str[i] == ' ' && attributeParsed == 0)
+		{
+			str[i]	= '\0';
+		}
+	}
+	
+	strcpy(parsedAttribute, str);
+	convertToLower(parsedAttribute, strlen(parsedAttribute));
+	
+	while(str[offset] != '\0' && offset < strLength)
+	{
+		offset++;
+	}
+	while(str[offset] == '\0' && offset < strLength)
+	{
+		offset++;
+	}
+	
+	if (offset >= strLength)
+	{
+		return 0;
+	}
+	
+	int deletedValueAttributeIndex = findTableAttributeIndex(attribute, totalAttribute, parsedAttribute);
+	
+	if (deletedValueAttributeIndex != -1)
+	{
+		strcpy(parsedAttribute, attribute[deletedValueAttributeIndex].attributeName);
+		
+		*value = malloc(attribute[deletedValueAttributeIndex].size);
+		memset(*value, 0, attribute[deletedValueAttributeIndex].size);
+		
+		DataType deletedAttributeType = attribute[deletedValueAttributeIndex].type;
+		
+		if (
+			deletedAttributeType == STRING || deletedAttributeType == TIME || 
+			deletedAttributeType == DATE || deletedAttributeType == DATETIME
+		)
+		{
+			strcpy(*value, str + offset);
+		}
+		else if (deletedAttributeType == INT)
+		{
+			int data;
+			sscanf(str + offset, "%d", &data);
+			memcpy(*value, &data, sizeof(data));
+		}
+		else if (deletedAttributeType == LONG)
+		{
+			long long int data;
+			sscanf(str + offset, "%lld", &data);
+			memcpy(*value, &data, sizeof(data));
+		}
+		else if (deletedAttributeType == DECIMAL)
+		{
+			double data;
+			sscanf(str + offset, "%lf", &data);
+			memcpy(*value, &data, sizeof(data));
+		}
+		
+		return 1;
+	}
+	
+	return 0;
+}
+
+int isSelectClauseKeyword(char str[])
+{
+	return 
+		strcasecmp(str, "WHERE") == 0 || strcasecmp(str, "GROUP") == 0 || strcasecmp(str, "ORDER") == 0 || 
+		strcasecmp(str, "LIMIT") == 0 || strcasecmp(str, "OFFSET") == 0;
+}
+
+int isPredicateKeyword(char str[])
+{
+	return strcasecmp(str, "AND") == 0 || strcasecmp(str, "OR") == 0 || isSelectClauseKeyword(str);
+}
+
+int findCompareOperator(char str[])
+{
+	int quotation = 0;
+	for (int i = 0; str[i] != '\0'; i++)
+	{
+		if (str[i] == '\'')
+		{
+			quotation = quotation == 1 ? 0 : 1;
+		}
+		else if (quotation == 0 && (str[i] == '=' || str[i] == '<' || str[i] == '>' || str[i] == '!'))
+		{
+			return i;
+		}
+	}
+	return -1;
+}
+
+int hasUnquotedSpace(char str[])
+{
+	int quotation = 0;
+	for (int i = 0; str[i] != '\0'; i++)
+	{
+		if (str[i] == '\'')
+		{
+			quotation = quotation == 1 ? 0 : 1;
+		}
+		else if (quotation == 0 && str[i] == ' ')
+		{
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int parseCompareOperator(char str[], CompareOperator *op)
+{
+	if (strncmp(str, "<=", 2) == 0)
+	{
+		*op = LESS_EQUAL;
+		return 2;
+	}
+	if (strncmp(str, ">=", 2) == 0)
+	{
+		*op = GREATER_EQUAL;
+		return 2;
+	}
+	if (strncmp(str, "!=", 2) == 0 || strncmp(str, "<>", 2) == 0)
+	{
+		*op = NOT_EQUAL;
+		return 2;
+	}
+	if (strncmp(str, "==", 2) == 0)
+	{
+		*op = EQUAL;
+		return 2;
+	}
+	if (str[0] == '=')
+	{
+		*op = EQUAL;
+		return 1;
+	}
+	if (str[0] == '<')
+	{
+		*op = LESS;
+		return 1;
+	}
+	if (str[0] == '>')
+	{
+		*op = GREATER;
+		return 1;
+	}
+	return 0;
+}
+
+int parseAttributeValue(Attribute *attribute, char str[], void *value)
+{
+	while (*str == ' ')
+	{
+		str++;
+	}
+	int length = strlen(str);
+	while (length > 0 && str[length - 1] == ' ')
+	{
+		length--;
+	}
+	if (length > 0 && str[0] == '\'')
+	{
+		str++;
+		length -= length > 1 && str[length - 2] == '\'' ? 2 : 1;
+	}
+	
+	char text[length + 1];
+	memcpy(text, str, length);
+	text[length] = '\0';
+	memset(value, 0, attribute->size);
+	
+	if (attribute->type == INT)
+	{
+		int data;
+		if (sscanf(text, "%d", &data) != 1)
+		{
+			return 0;
+		}
+		memcpy(value, &data, sizeof(data));
+	}
+	else if (attribute->type == LONG)
+	{
+		long long int data;
+		if (sscanf(text, "%lld", &data) != 1)
+		{
+			return 0;
+		}
+		memcpy(value, &data, sizeof(data));
+	}
+	else if (attribute->type == DECIMAL)
+	{
+		double data;
+		if (sscanf(text, "%lf", &data) != 1)
+		{
+			return 0;
+		}
+		memcpy(value, &data, sizeof(data));
+	}
+	else
+	{
+		strncpy(value, text, attribute->size);
+	}
+	return 1;
+}
+
+Predicate* newLeafPredicate(PredicateType type, Attribute attribute[], int totalAttribute, char name[])
+{
+	convertToLower(name, strlen(name));
+	int attributeIndex = findTableAttributeIndex(attribute, totalAttribute, name);
+	if (attributeIndex == -1)
+	{
+		return NULL;
+	}
+	
+	Predicate *predicate = newPredicate(type);
+	predicate->attributeIndex = attributeIndex;
+	predicate->attribute = attribute[attributeIndex];
+	predicate->offset = attributeDataOffset(attribute, attributeIndex);
+	return predicate;
+}
+
+Predicate* parseInPredicate(char name[], char list[], Attribute attribute[], int totalAttribute)
+{
+	Predicate *predicate = newLeafPredicate(IN_PREDICATE, attribute, totalAttribute, name);
+	if (predicate == NULL)
+	{
+		return NULL;
+	}
+	
+	int listLength = strlen(list);
+	int quotation = 0;
+	int valueStart = 0;
+	for (int i = 0; i <= listLength; i++)
+	{
+		if (i < listLength && list[i] == '\'')
+		{
+			quotation = quotation == 1 ? 0 : 1;
+		}
+		else if (i == listLength || (quotation == 0 && list[i] == ','))
+		{
+			char saved = list[i];
+			list[i] = '\0';
+			predicate->value = realloc(predicate->value, (size_t)predicate->attribute.size * (predicate->valueAmount + 1));
+			if (parseAttributeValue(
+				&predicate->attribute, list + valueStart, 
+				predicate->value + (size_t)predicate->valueAmount * predicate->attribute.size
+			) == 0)
+			{
+				delPredicate(predicate);
+				return NULL;
+			}
+			list[i] = saved;
+			predicate->valueAmount += 1;
+			valueStart = i + 1;
+		}
+	}
+	
+	buildPredicateValueSet(predicate);
+	return predicate;
+}
+
+Predicate* parseComparisonPredicate(ParsedStringQueue **queue, Attribute attribute[], int totalAttribute)
+{
+	char *text = strdup((*queue)->parsedString);
+	popParsedStringQueue(queue);
+	
+	int negated = 0;
+	if (findCompareOperator(text) == -1 && *queue != NULL && strcasecmp((*queue)->parsedString, "NOT") == 0)
+	{
+		negated = 1;
+		popParsedStringQueue(queue);
+	}
+	
+	if (findCompareOperator(text) == -1 && *queue != NULL && strcasecmp((*queue)->parsedString, "IN") == 0)
+	{
+		popParsedStringQueue(queue);
+		Predicate *predicate = NULL;
+		if (*queue != NULL)
+		{
+			predicate = parseInPredicate(text, (*queue)->parsedString, attribute, totalAttribute);
+			popParsedStringQueue(queue);
+		}
+		free(text);
+		
+		if (predicate != NULL && negated == 1)
+		{
+			Predicate *negation = newPredicate(NOT_PREDICATE);
+			appendPredicateChild(negation, predicate);
+			return negation;
+		}
+		return predicate;
+	}
+	
+	int operatorIndex;
+	CompareOperator op;
+	while (
+		negated == 0 && *queue != NULL && isPredicateKeyword((*queue)->parsedString) == 0 && 
+		((operatorIndex = findCompareOperator(text)) == -1 || 
+		text[operatorIndex + parseCompareOperator(text + operatorIndex, &op)] == '\0')
+	)
+	{
+		text = realloc(text, strlen(text) + strlen((*queue)->parsedString) + 1);
+		strcat(text, (*queue)->parsedString);
+		popParsedStringQueue(queue);
+	}
+	
+	operatorIndex = findCompareOperator(text);
+	int operatorLength = operatorIndex == -1 ? 0 : parseCompareOperator(text + operatorIndex, &op);
+	if (negated == 1 || operatorLength == 0 || text[operatorIndex + operatorLength] == '\0')
+	{
+		free(text);
+		return NULL;
+	}
+	
+	text[operatorIndex] = '\0';
+	Predicate *predicate = newLeafPredicate(COMPARE_PREDICATE, attribute, totalAttribute, text);
+	if (predicate != NULL)
+	{
+		predicate->op = op;
+		predicate->value = malloc(predicate->attribute.size);
+		if (parseAttributeValue(&predicate->attribute, text + operatorIndex + operatorLength, predicate->value) == 0)
+		{
+			delPredicate(predicate);
+			predicate = NULL;
+		}
+	}
+	free(text);
+	return predicate;
+}
+
+Predicate* parsePredicateExpression(ParsedStringQueue **queue, Attribute attribute[], int totalAttribute);
+
+Predicate* parsePredicateFactor(ParsedStringQueue **queue, Attribute attribute[], int totalAttribute)
+{
+	if (*queue == NULL || isPredicateKeyword((*queue)->parsedString) == 1)
+	{
+		return NULL;
+	}
+	
+	if (strcasecmp((*queue)->parsedString, "NOT") == 0)
+	{
+		popParsedStringQueue(queue);
+		Predicate *child = parsePredicateFactor(queue, attribute, totalAttribute);
+		if (child == NULL)
+		{
+			return NULL;
+		}
+		Predicate *predicate = newPredicate(NOT_PREDICATE);
+		appendPredicateChild(predicate, child);
+		return predicate;
+	}
+	
+	if (hasUnquotedSpace((*queue)->parsedString) == 1)
+	{
+		char script[strlen((*queue)->parsedString) + 2];
+		sprintf(script, "%s;", (*queue)->parsedString);
+		popParsedStringQueue(queue);
+		
+		ParsedStringQueue *group = parseStringSQLScript(script);
+		Predicate *predicate = parsePredicateExpression(&group, attribute, totalAttribute);
+		if (group != NULL)
+		{
+			delPredicate(predicate);
+			predicate = NULL;
+		}
+		while (group != NULL)
+		{
+			popParsedStringQueue(&group);
+		}
+		return predicate;
+	}
+	
+	return parseComparisonPredicate(queue, attribute, totalAttribute);
+}
+
+Predicate* parsePredicateList(
+	ParsedStringQueue **queue, Attribute attribute[], int totalAttribute, PredicateType type, char keyword[]
+)
+{
+	Predicate *first = type == AND_PREDICATE ? 
+		parsePredicateFactor(queue, attribute, totalAttribute) : 
+		parsePredicateList(queue, attribute, totalAttribute, AND_PREDICATE, "AND");
+	
+	if (first == NULL || *queue == NULL || strcasecmp((*queue)->parsedString, keyword) != 0)
+	{
+		return first;
+	}
+	
+	Predicate *predicate = newPredicate(type);
+	appendPredicateChild(predicate, first);
+	while (*queue != NULL && strcasecmp((*queue)->parsedString, keyword) == 0)
+	{
+		popParsedStringQueue(queue);
+		Predicate *next = type == AND_PREDICATE ? 
+			parsePredicateFactor(queue, attribute, totalAttribute) : 
+			parsePredicateList(queue, attribute, totalAttribute, AND_PREDICATE, "AND");
+		if (next == NULL)
+		{
+			delPredicate(predicate);
+			return NULL;
+		}
+		appendPredicateChild(predicate, next);
+	}
+	return predicate;
+}
+
+Predicate* parsePredicateExpression(ParsedStringQueue **queue, Attribute attribute[], int totalAttribute)
+{
+	return parsePredicateList(queue, attribute, totalAttribute, OR_PREDICATE, "OR");
+}
+
+Predicate* parseWherePredicate(ParsedStringQueue **queue, Attribute attribute[], int totalAttribute, TableStats *stats)
+{
+	Predicate *predicate = parsePredicateExpression(queue, attribute, totalAttribute);
+	if (predicate != NULL)
+	{
+		optimizePredicate(predicate, stats);
+	}
+	return predicate;
+}
+
+int scanBatchCapacity(size_t recordStride)
+{
+	int batchCapacity = __SCAN_BATCH_BYTES / recordStride;
+	if (batchCapacity > __SCAN_BATCH_RECORDS)
+	{
+		batchCapacity = __SCAN_BATCH_RECORDS;
+	}
+	if (batchCapacity < 1)
+	{
+		batchCapacity = 1;
+	}
+	return batchCapacity;
+}
+
+void selectRecordBatch(
+	char *batch, int recordAmount, size_t recordStride, Snapshot *snapshot, Predicate *where, char *columnVector, 
+	unsigned long long selection[]
+)
+{
+	unsigned long long matched[(__SCAN_BATCH_RECORDS + 63) / 64];
+	recordScanStats(recordAmount, recordAmount * recordStride);
+	buildVisibleSelection(batch, recordAmount, recordStride, snapshot, selection);
+	if (activeQueryProfile != NULL)
+	{
+		profileScanBatch(recordAmount, recordAmount * recordStride, selection);
+	}
+	
+	if (where != NULL)
+	{
+		PredicateBatch predicateBatch = {batch, recordAmount, recordStride, sizeOfRecordBlockHeader(), NULL, columnVector};
+		evaluatePredicate(where, &predicateBatch, selection, matched);
+		memcpy(selection, matched, sizeof(selection[0]) * ((recordAmount + 63) / 64));
+	}
+	if (activeQueryProfile != NULL)
+	{
+		profileMatchedRecords(recordAmount, selection);
+	}
+}
+
+int emitSelectedRecords(
+	char *batch, int recordAmount, size_t recordStride, unsigned long long selection[], int *scanning, 
+	RecordCallback callback, void *context
+)
+{
+	int matchedAmount = 0;
+	for (int i = 0; i < (recordAmount + 63) / 64 && *scanning == 1; i++)
+	{
+		unsigned long long word = selection[i];
+		while (word != 0 && *scanning == 1)
+		{
+			int index = i * 64 + __builtin_ctzll(word);
+			word &= word - 1;
+			matchedAmount++;
+			
+			if (callback != NULL)
+			{
+				*scanning = callback(context, batch + index * recordStride + sizeOfRecordBlockHeader());
+			}
+			else
+			{
+				markRecordDeleted(batch + index * recordStride, transactionManager.writeTransaction);
+			}
+		}
+	}
+	return matchedAmount;
+}
+
+int submitReadAhead(
+	ReadAheadSlot *slot, int fileDescriptor, off_t dataStart, size_t recordStride, int batchCapacity, 
+	long long int recordTotal, char *skipBlock, long long int skipBlockAmount, long long int *nextRecord
+)
+{
+	long long int recordIndex = *nextRecord;
+	while (
+		recordIndex < recordTotal && skipBlock != NULL && 
+		isRecordBlockSkipped(skipBlock, skipBlockAmount, recordIndex)
+	)
+	{
+		recordIndex = (recordIndex / __ZONE_MAP_BLOCK_RECORDS + 1) * __ZONE_MAP_BLOCK_RECORDS;
+	}
+	
+	if (recordIndex >= recordTotal)
+	{
+		*nextRecord = recordTotal;
+		return 0;
+	}
+	
+	long long int recordAmount = batchCapacity;
+	if (recordIndex + recordAmount > recordTotal)
+	{
+		recordAmount = recordTotal - recordIndex;
+	}
+	if (skipBlock != NULL)
+	{
+		long long int blockEnd = (recordIndex / __ZONE_MAP_BLOCK_RECORDS + 1) * __ZONE_MAP_BLOCK_RECORDS;
+		if (recordIndex + recordAmount > blockEnd)
+		{
+			recordAmount = blockEnd - recordIndex;
+		}
+	}
+	
+	slot->recordIndex = recordIndex;
+	slot->recordAmount = recordAmount;
+	slot->request.operation = ASYNC_READ;
+	slot->request.fileDescriptor = fileDescriptor;
+	slot->request.size = recordStride * recordAmount;
+	slot->request.offset = dataStart + recordIndex * recordStride;
+	submitAsyncRequest(&slot->request);
+	
+	*nextRecord = recordIndex + recordAmount;
+	return 1;
+}
+
+int scanRecordBatches(
+	FILE *tableFile, int recordBlockSize, Predicate *where, char *skipBlock, long long int skipBlockAmount, 
+	int markDeleted, char dirtyPage[], RecordCallback callback, void *context
+)
+{
+	size_t recordStride = recordBlockSize + sizeOfRecordBlockHeader();
+	int batchCapacity = scanBatchCapacity(recordStride);
+	
+	unsigned long long selection[(__SCAN_BATCH_RECORDS + 63) / 64];
+	char *columnVector = malloc((size_t)predicateMaxAttributeSize(where) * batchCapacity + 1);
+	
+	fflush(tableFile);
+	int fileDescriptor = fileno(tableFile);
+	off_t dataStart = ftello(tableFile);
+	Snapshot snapshot = acquireSnapshot();
+	struct stat fileStat;
+	fstat(fileDescriptor, &fileStat);
+	long long int recordTotal = fileStat.st_size > dataStart ? (fileStat.st_size - dataStart) / recordStride : 0;
+	
+	ReadAheadSlot slot[__SCAN_READ_AHEAD_DEPTH];
+	for (int i = 0; i < __SCAN_READ_AHEAD_DEPTH; i++)
+	{
+		slot[i].request.buffer = malloc(recordStride * batchCapacity);
+	}
+	
+	long long int nextRecord = 0;
+	int activeAmount = 0;
+	while (
+		activeAmount < __SCAN_READ_AHEAD_DEPTH && 
+		submitReadAhead(
+			&slot[activeAmount], fileDescriptor, dataStart, recordStride, batchCapacity, recordTotal, 
+			skipBlock, skipBlockAmount, &nextRecord
+		) == 1
+	)
+	{
+		activeAmount++;
+	}
+	flushAsyncSubmissions();
+	
+	int scanning = 1;
+	int matchedAmount = 0;
+	int head = 0;
+	
+	while (activeAmount > 0)
+	{
+		ReadAheadSlot *current = &slot[head];
+		waitAsyncRequest(&current->request);
+		activeAmount--;
+		
+		if (scanning == 1)
+		{
+			char *batch = current->request.buffer;
+			int recordAmount = current->request.result > 0 ? current->request.result / recordStride : 0;
+			
+			selectRecordBatch(batch, recordAmount, recordStride, &snapshot, where, columnVector, selection);
+			int batchMatched = emitSelectedRecords(
+				batch, recordAmount, recordStride, selection, &scanning, markDeleted == 1 ? NULL : callback, context
+			);
+			
+			if (markDeleted == 1 && batchMatched > 0)
+			{
+				submitAsyncWrite(fileDescriptor, batch, recordStride * recordAmount, current->request.offset);
+				markDirtyPages(dirtyPage, current->recordIndex, recordAmount);
+			}
+			matchedAmount += batchMatched;
+			
+			if (
+				scanning == 1 && 
+				submitReadAhead(
+					current, fileDescriptor, dataStart, recordStride, batchCapacity, recordTotal, 
+					skipBlock, skipBlockAmount, &nextRecord
+				) == 1
+			)
+			{
+				activeAmount++;
+				flushAsyncSubmissions();
+			}
+		}
+		head = (head + 1) % __SCAN_READ_AHEAD_DEPTH;
+	}
+	
+	for (int i = 0; i < __SCAN_READ_AHEAD_DEPTH; i++)
+	{
+		free(slot[i].request.buffer);
+	}
+	free(columnVector);
+	releaseSnapshot(&snapshot);
+	
+	if (markDeleted == 1 && waitAsyncWrites() == 0)
+	{
+		return -1;
+	}
+	return matchedAmount;
+}
+
+int scanIndexedRecords(
+	FILE *tableFile, off_t dataStart, int recordBlockSize, long long int slot[], long long int slotAmount, 
+	Predicate *where, int markDeleted, char dirtyPage[], RecordCallback callback, void *context
+)
+{
+	size_t recordStride = recordBlockSize + sizeOfRecordBlockHeader();
+	int batchCapacity = scanBatchCapacity(recordStride);
+	
+	char *batch = malloc(recordStride * batchCapacity);
+	long long int batchSlot[batchCapacity];
+	AsyncRequest *request = malloc(sizeof(AsyncRequest) * batchCapacity);
+	unsigned long long selection[(__SCAN_BATCH_RECORDS + 63) / 64];
+	char *columnVector = malloc((size_t)predicateMaxAttributeSize(where) * batchCapacity + 1);
+	
+	fflush(tableFile);
+	int fileDescriptor = fileno(tableFile);
+	Snapshot snapshot = acquireSnapshot();
+	int scanning = 1;
+	int matchedAmount = 0;
+	
+	for (long long int next = 0; next < slotAmount && scanning == 1;)
+	{
+		int requestAmount = 0;
+		while (next < slotAmount && requestAmount < batchCapacity)
+		{
+			request[requestAmount].operation = ASYNC_READ;
+			request[requestAmount].fileDescriptor = fileDescriptor;
+			request[requestAmount].buffer = batch + requestAmount * recordStride;
+			request[requestAmount].size = recordStride;
+			request[requestAmount].offset = dataStart + slot[next] * recordStride;
+			submitAsyncRequest(&request[requestAmount]);
+			
+			batchSlot[requestAmount++] = slot[next];
+			next++;
+		}
+		flushAsyncSubmissions();
+		
+		int recordAmount = 0;
+		for (int i = 0; i < requestAmount; i++)
+		{
+			waitAsyncRequest(&request[i]);
+			if (request[i].result == (ssize_t)recordStride)
+			{
+				if (i != recordAmount)
+				{
+					memcpy(batch + recordAmount * recordStride, batch + i * recordStride, recordStride);
+				}
+				batchSlot[recordAmount++] = batchSlot[i];
+			}
+		}
+		
+		selectRecordBatch(batch, recordAmount, recordStride, &snapshot, where, columnVector, selection);
+		int batchMatched = emitSelectedRecords(
+			batch, recordAmount, recordStride, selection, &scanning, markDeleted == 1 ? NULL : callback, context
+		);
+		
+		if (markDeleted == 1 && batchMatched > 0)
+		{
+			for (int i = 0; i < recordAmount; i++)
+			{
+				if (selection[i >> 6] & (1ULL << (i & 63)))
+				{
+					submitAsyncWrite(
+						fileDescriptor, batch + i * recordStride, sizeOfRecordBlockHeader(), 
+						dataStart + batchSlot[i] * recordStride
+					);
+					markDirtyPages(dirtyPage, batchSlot[i], 1);
+				}
+			}
+		}
+		matchedAmount += batchMatched;
+	}
+	
+	free(columnVector);
+	free(request);
+	free(batch);
+	releaseSnapshot(&snapshot);
+	
+	if (markDeleted == 1 && waitAsyncWrites() == 0)
+	{
+		return -1;
+	}
+	return matchedAmount;
+}
+
+void *parallelScanWorker(void *argument)
+{
+	ParallelScan *scan = (ParallelScan *)argument;
+	char *batch = malloc(scan->recordStride * scan->batchCapacity);
+	unsigned long long selection[(__SCAN_BATCH_RECORDS + 63) / 64];
+	char *columnVector = malloc((size_t)predicateMaxAttributeSize(scan->where) * scan->batchCapacity + 1);
+	
+	while (1)
+	{
+		pthread_mutex_lock(&scan->lock);
+		int slot = -1;
+		while (scan->stopped == 0 && scan->nextMorsel < scan->morselTotal && slot == -1)
+		{
+			for (int i = 0; i < scan->slotAmount && slot == -1; i++)
+			{
+				if (scan->slot[i].state == MORSEL_FREE)
+				{
+					slot = i;
+				}
+			}
+			if (slot == -1)
+			{
+				pthread_cond_wait(&scan->slotFree, &scan->lock);
+			}
+		}
+		if (scan->stopped == 1 || scan->nextMorsel >= scan->morselTotal)
+		{
+			pthread_mutex_unlock(&scan->lock);
+			break;
+		}
+		
+		ScanMorsel *morsel = &scan->slot[slot];
+		morsel->state = MORSEL_CLAIMED;
+		morsel->morselId = scan->nextMorsel++;
+		pthread_mutex_unlock(&scan->lock);
+		
+		long long int firstRecord = morsel->morselId * scan->batchCapacity;
+		int recordAmount = scan->batchCapacity;
+		if (firstRecord + recordAmount > scan->recordTotal)
+		{
+			recordAmount = scan->recordTotal - firstRecord;
+		}
+		
+		ssize_t readBytes = 0;
+		if (isRecordRangeSkipped(scan->skipBlock, scan->skipBlockAmount, firstRecord, recordAmount) == 0)
+		{
+			readBytes = pread(
+				scan->fileDescriptor, batch, scan->recordStride * recordAmount, 
+				scan->dataStart + firstRecord * scan->recordStride
+			);
+		}
+		recordAmount = readBytes > 0 ? readBytes / scan->recordStride : 0;
+		
+		selectRecordBatch(
+			batch, recordAmount, scan->recordStride, &scan->snapshot, scan->where, columnVector, selection
+		);
+		
+		morsel->recordAmount = 0;
+		for (int i = 0; i < (recordAmount + 63) / 64; i++)
+		{
+			unsigned long long word = selection[i];
+			while (word != 0)
+			{
+				int index = i * 64 + __builtin_ctzll(word);
+				word &= word - 1;
+				memcpy(
+					morsel->data + (size_t)morsel->recordAmount * scan->recordBlockSize, 
+					batch + index * scan->recordStride + sizeOfRecordBlockHeader(), scan->recordBlockSize
+				);
+				morsel->recordAmount += 1;
+			}
+		}
+		
+		pthread_mutex_lock(&scan->lock);
+		morsel->state = MORSEL_READY;
+		pthread_cond_broadcast(&scan->morselReady);
+		pthread_mutex_unlock(&scan->lock);
+	}
+	
+	free(columnVector);
+	free(batch);
+	return NULL;
+}
+
+void *scanPoolWorker(void *argument)
+{
+	ScanWorkerPool *pool = (ScanWorkerPool *)argument;
+	pthread_mutex_lock(&pool->lock);
+	while (1)
+	{
+		while (pool->waiting == 0)
+		{
+			pthread_cond_wait(&pool->jobReady, &pool->lock);
+		}
+		pool->waiting--;
+		ParallelScan *job = pool->job;
+		pthread_mutex_unlock(&pool->lock);
+		
+		parallelScanWorker(job);
+		
+		pthread_mutex_lock(&pool->lock);
+		pool->running--;
+		if (pool->running == 0)
+		{
+			pthread_cond_broadcast(&pool->jobDone);
+		}
+	}
+	return NULL;
+}
+
+void initScanWorkerPool()
+{
+	pthread_mutex_init(&scanWorkerPool.lock, NULL);
+	pthread_cond_init(&scanWorkerPool.jobReady, NULL);
+	pthread_cond_init(&scanWorkerPool.jobDone, NULL);
+	
+	scanWorkerPool.workerAmount = 0;
+	while (
+		scanThreadAmount > 1 && scanWorkerPool.workerAmount < scanThreadAmount && 
+		pthread_create(
+			&scanWorkerPool.worker[scanWorkerPool.workerAmount], NULL, scanPoolWorker, &scanWorkerPool
+		) == 0
+	)
+	{
+		pthread_detach(scanWorkerPool.worker[scanWorkerPool.workerAmount]);
+		scanWorkerPool.workerAmount++;
+	}
+}
+
+int claimScanWorkerPool(ParallelScan *scan, int threadAmount)
+{
+	pthread_mutex_lock(&scanWorkerPool.lock);
+	if (scanWorkerPool.busy == 1 || scanWorkerPool.workerAmount < threadAmount)
+	{
+		pthread_mutex_unlock(&scanWorkerPool.lock);
+		return 0;
+	}
+	scanWorkerPool.busy = 1;
+	scanWorkerPool.job = scan;
+	scanWorkerPool.waiting = threadAmount;
+	scanWorkerPool.running = threadAmount;
+	pthread_cond_broadcast(&scanWorkerPool.jobReady);
+	pthread_mutex_unlock(&scanWorkerPool.lock);
+	return 1;
+}
+
+void releaseScanWorkerPool()
+{
+	pthread_mutex_lock(&scanWorkerPool.lock);
+	while (scanWorkerPool.running > 0)
+	{
+		pthread_cond_wait(&scanWorkerPool.jobDone, &scanWorkerPool.lock);
+	}
+	scanWorkerPool.job = NULL;
+	scanWorkerPool.busy = 0;
+	pthread_mutex_unlock(&scanWorkerPool.lock);
+}
+
+int scanRecordsParallel(
+	int fileDescriptor, off_t dataStart, long long int recordTotal, int recordBlockSize, Predicate *where, 
+	char *skipBlock, long long int skipBlockAmount, int ordered, RecordCallback callback, void *context
+)
+{
+	ParallelScan scan;
+	memset(&scan, 0, sizeof(scan));
+	scan.fileDescriptor = fileDescriptor;
+	scan.dataStart = dataStart;
+	scan.recordTotal = recordTotal;
+	scan.recordBlockSize = recordBlockSize;
+	scan.recordStride = recordBlockSize + sizeOfRecordBlockHeader();
+	scan.batchCapacity = scanBatchCapacity(scan.recordStride);
+	scan.where = where;
+	scan.snapshot = acquireSnapshot();
+	scan.skipBlock = skipBlock;
+	scan.skipBlockAmount = skipBlockAmount;
+	scan.morselTotal = (recordTotal + scan.batchCapacity - 1) / scan.batchCapacity;
+	
+	int threadAmount = scanThreadAmount;
+	if (threadAmount > scan.morselTotal)
+	{
+		threadAmount = scan.morselTotal;
+	}
+	scan.slotAmount = threadAmount * 2;
+	scan.slot = malloc(sizeof(ScanMorsel) * scan.slotAmount);
+	for (int i = 0; i < scan.slotAmount; i++)
+	{
+		scan.slot[i].state = MORSEL_FREE;
+		scan.slot[i].data = malloc((size_t)scan.batchCapacity * recordBlockSize);
+	}
+	
+	pthread_mutex_init(&scan.lock, NULL);
+	pthread_cond_init(&scan.morselReady, NULL);
+	pthread_cond_init(&scan.slotFree, NULL);
+	
+	pthread_t worker[__SCAN_MAX_THREADS];
+	int pooled = claimScanWorkerPool(&scan, threadAmount);
+	for (int i = 0; i < threadAmount && pooled == 0; i++)
+	{
+		pthread_create(&worker[i], NULL, parallelScanWorker, &scan);
+	}
+	
+	long long int consumedMorsel = 0;
+	while (scan.stopped == 0 && consumedMorsel < scan.morselTotal)
+	{
+		pthread_mutex_lock(&scan.lock);
+		int slot = -1;
+		while (slot == -1)
+		{
+			for (int i = 0; i < scan.slotAmount && slot == -1; i++)
+			{
+				if (
+					scan.slot[i].state == MORSEL_READY && 
+					(ordered == 0 || scan.slot[i].morselId == consumedMorsel)
+				)
+				{
+					slot = i;
+				}
+			}
+			if (slot == -1)
+			{
+				pthread_cond_wait(&scan.morselReady, &scan.lock);
+			}
+		}
+		pthread_mutex_unlock(&scan.lock);
+		
+		ScanMorsel *morsel = &scan.slot[slot];
+		for (int i = 0; i < morsel->recordAmount && scan.stopped == 0; i++)
+		{
+			if (callback(context, morsel->data + (size_t)i * recordBlockSize) == 0)
+			{
+				scan.stopped = 1;
+			}
+		}
+		consumedMorsel += 1;
+		
+		pthread_mutex_lock(&scan.lock);
+		morsel->state = MORSEL_FREE;
+		pthread_cond_broadcast(&scan.slotFree);
+		pthread_mutex_unlock(&scan.lock);
+	}
+	
+	pthread_mutex_lock(&scan.lock);
+	scan.stopped = 1;
+	pthread_cond_broadcast(&scan.slotFree);
+	pthread_mutex_unlock(&scan.lock);
+	
+	if (pooled == 1)
+	{
+		releaseScanWorkerPool();
+	}
+	for (int i = 0; i < threadAmount && pooled == 0; i++)
+	{
+		pthread_join(worker[i], NULL);
+	}
+	
+	pthread_cond_destroy(&scan.slotFree);
+	pthread_cond_destroy(&scan.morselReady);
+	pthread_mutex_destroy(&scan.lock);
+	for (int i = 0; i < scan.slotAmount; i++)
+	{
+		free(scan.slot[i].data);
+	}
+	free(scan.slot);
+	releaseSnapshot(&scan.snapshot);
+	
+	return 1;
+}
+
+int collectRecordCallback(void *context, char *recordData)
+{
+	RecordCollector *collector = (RecordCollector *)context;
+	RecordBlock recordBlockData;
+	initRecordBlock(&recordBlockData, *collector->recordBlockSize);
+	memcpy(recordBlockData.data, recordData, *collector->recordBlockSize);
+	appendRecordBlockVector(collector->records, &recordBlockData);
+	return 1;
+}
+
+long long int nextCompressedPage(
+	PageDirectoryHeader *header, char *skipBlock, long long int skipBlockAmount, long long int page
+)
+{
+	while (page < header->pageAmount && isRecordBlockSkipped(skipBlock, skipBlockAmount, page * header->pageRecords))
+	{
+		page++;
+	}
+	return page;
+}
+
+void submitCompressedPageRead(AsyncRequest *request, int pageFileDescriptor, PageDirectoryEntry *entry)
+{
+	request->operation = ASYNC_READ;
+	request->fileDescriptor = pageFileDescriptor;
+	request->size = entry->compressedSize;
+	request->offset = entry->offset;
+	submitAsyncRequest(request);
+	flushAsyncSubmissions();
+}
+
+int scanCompressedPages(
+	int pageFileDescriptor, PageDirectoryHeader *header, PageDirectoryEntry entry[], Predicate *where, 
+	char *skipBlock, long long int skipBlockAmount, RecordCallback callback, void *context
+)
+{
+	size_t recordStride = header->recordStride;
+	int batchCapacity = scanBatchCapacity(recordStride);
+	size_t pageSize = recordStride * header->pageRecords;
+	
+	int compressedCapacity = 1;
+	for (long long int i = 0; i < header->pageAmount; i++)
+	{
+		if (entry[i].compressedSize > compressedCapacity)
+		{
+			compressedCapacity = entry[i].compressedSize;
+		}
+	}
+	
+	AsyncRequest request[2];
+	request[0].buffer = malloc(compressedCapacity);
+	request[1].buffer = malloc(compressedCapacity);
+	unsigned char *page = malloc(pageSize);
+	unsigned long long selection[(__SCAN_BATCH_RECORDS + 63) / 64];
+	char *columnVector = malloc((size_t)predicateMaxAttributeSize(where) * batchCapacity + 1);
+	Snapshot snapshot = acquireSnapshot();
+	
+	int scanning = 1;
+	int matchedAmount = 0;
+	int current = 0;
+	long long int pageIndex = nextCompressedPage(header, skipBlock, skipBlockAmount, 0);
+	if (pageIndex < header->pageAmount)
+	{
+		submitCompressedPageRead(&request[current], pageFileDescriptor, &entry[pageIndex]);
+	}
+	
+	while (pageIndex < header->pageAmount)
+	{
+		long long int nextPage = nextCompressedPage(header, skipBlock, skipBlockAmount, pageIndex + 1);
+		if (nextPage < header->pageAmount && scanning == 1)
+		{
+			submitCompressedPageRead(&request[1 - current], pageFileDescriptor, &entry[nextPage]);
+		}
+		waitAsyncRequest(&request[current]);
+		
+		long long int decodedSize = -1;
+		if (request[current].result == entry[pageIndex].compressedSize)
+		{
+			decodedSize = decompressPage(
+				(unsigned char *)request[current].buffer, request[current].result, page, pageSize
+			);
+		}
+		int recordAmount = decodedSize > 0 ? decodedSize / recordStride : 0;
+		
+		for (int offset = 0; offset < recordAmount && scanning == 1; offset += batchCapacity)
+		{
+			int batchAmount = recordAmount - offset < batchCapacity ? recordAmount - offset : batchCapacity;
+			char *batch = (char *)page + offset * recordStride;
+			selectRecordBatch(batch, batchAmount, recordStride, &snapshot, where, columnVector, selection);
+			matchedAmount += emitSelectedRecords(batch, batchAmount, recordStride, selection, &scanning, callback, context);
+		}
+		
+		if (scanning == 0)
+		{
+			if (nextPage < header->pageAmount)
+			{
+				waitAsyncRequest(&request[1 - current]);
+			}
+			break;
+		}
+		pageIndex = nextPage;
+		current = 1 - current;
+	}
+	
+	free(request[0].buffer);
+	free(request[1].buffer);
+	free(page);
+	free(columnVector);
+	releaseSnapshot(&snapshot);
+	
+	return matchedAmount;
+}
+
+void describeAccessPath(
+	char detail[], char table[], AccessPath path, int compressed, long long int recordTotal, long long int scannedRecords, 
+	long long int slotAmount
+)
+{
+	if (path == INDEX_SCAN)
+	{
+		snprintf(detail, 128, "index scan on %s, %lld candidate rows", table, slotAmount);
+	}
+	else if (compressed == 1)
+	{
+		snprintf(detail, 128, "compressed page scan on %s, %lld of %lld rows after zone map", table, scannedRecords, recordTotal);
+	}
+	else if (path == PARALLEL_SCAN)
+	{
+		snprintf(
+			detail, 128, "parallel scan on %s with %d threads, %lld of %lld rows after zone map", 
+			table, scanThreadAmount, scannedRecords, recordTotal
+		);
+	}
+	else
+	{
+		snprintf(detail, 128, "sequential scan on %s, %lld of %lld rows after zone map", table, scannedRecords, recordTotal);
+	}
+}
+
+int scanTableRecords(
+	char database[], char table[], Attribute attribute[], int *attributeTotal, int *recordBlockSize, 
+	Predicate *where, int neededColumn[], int ordered, RecordCallback callback, void *context
+)
+{	
+	waitAsyncWrites();
+	
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r");
+	
+	if (tableFile == NULL)
+	{
+		return 0;
+	}
+	beginQueryOperator("scan");
+	
+	char detail[128];
+	*attributeTotal = 0;
+	*recordBlockSize = 0;
+	
+	int tableData[3];
+	freadTableHeader(tableData, tableFile);
+	
+	*attributeTotal = 0;
+	AttributeBlock attributeBlock[tableData[0]];
+	AttributeBlock reader;
+	for (int i = 0; i < tableData[0]; i++)
+	{
+		fread(&reader, sizeof(reader), 1, tableFile);
+		if (reader.flag == FILLED)
+		{
+			memcpy(&(attributeBlock[*attributeTotal]), &reader, sizeof(reader));
+			memcpy(&(attribute[*attributeTotal]), &(attributeBlock[*attributeTotal].attribute), sizeof(Attribute));
+			*attributeTotal += 1;
+		}
+	}
+	*recordBlockSize = tableData[2];
+	
+	if (where != NULL && isBloomFilterExcluded(database, table, where))
+	{
+		fclose(tableFile);
+		snprintf(detail, sizeof(detail), "bloom filter excludes every row of %s", table);
+		setQueryOperatorDetail(detail);
+		endQueryOperator();
+		return 1;
+	}
+	
+	if (isColumnarTable(database, table))
+	{
+		fclose(tableFile);
+		snprintf(detail, sizeof(detail), "columnar scan on %s", table);
+		setQueryOperatorDetail(detail);
+		if (isQueryPlanOnly() == 0)
+		{
+			scanColumnarTable(
+				database, table, attribute, *attributeTotal, *recordBlockSize, neededColumn, 
+				where, 0, callback, context
+			);
+		}
+		endQueryOperator();
+		return 1;
+	}
+	
+	off_t dataStart = tableHeaderSize(tableData[0]);
+	struct stat fileStat;
+	fstat(fileno(tableFile), &fileStat);
+	
+	size_t recordStride = *recordBlockSize + sizeOfRecordBlockHeader();
+	long long int recordTotal = (fileStat.st_size - dataStart) / recordStride;
+	long long int skipBlockAmount;
+	char *skipBlock = buildZoneSkipList(database, table, where, &skipBlockAmount);
+	long long int *slot;
+	long long int slotAmount = 0;
+	long long int scannedRecords = countScannedRecords(skipBlock, skipBlockAmount, recordTotal);
+	AccessPath path = chooseAccessPath(database, table, scannedRecords, recordStride, where, 1, &slot, &slotAmount);
+	
+	int compressed = path != INDEX_SCAN && isCompressedTable(database, table);
+	PageDirectoryHeader pageHeader;
+	PageDirectoryEntry *pageEntry = NULL;
+	FILE *pageFile = NULL;
+	if (compressed == 1)
+	{
+		char pagePath[1024];
+		pageFilePath(pagePath, database, table, 0);
+		pageEntry = loadFreshPageDirectory(database, table, recordStride, recordTotal, &pageHeader);
+		pageFile = pageEntry != NULL ? fopen(pagePath, "r") : NULL;
+	}
+	
+	describeAccessPath(detail, table, path, pageFile != NULL, recordTotal, scannedRecords, slotAmount);
+	setQueryOperatorDetail(detail);
+	
+	if (isQueryPlanOnly() == 1)
+	{
+		if (path == INDEX_SCAN)
+		{
+			free(slot);
+		}
+		if (pageFile != NULL)
+		{
+			fclose(pageFile);
+		}
+	}
+	else if (path == INDEX_SCAN)
+	{
+		scanIndexedRecords(tableFile, dataStart, *recordBlockSize, slot, slotAmount, where, 0, NULL, callback, context);
+		free(slot);
+	}
+	else if (pageFile != NULL)
+	{
+		scanCompressedPages(
+			fileno(pageFile), &pageHeader, pageEntry, where, skipBlock, skipBlockAmount, callback, context
+		);
+		fclose(pageFile);
+	}
+	else if (path == PARALLEL_SCAN)
+	{
+		scanRecordsParallel(
+			fileno(tableFile), dataStart, recordTotal, *recordBlockSize, where, skipBlock, skipBlockAmount, 
+			ordered, callback, context
+		);
+	}
+	else
+	{
+		fseek(tableFile, dataStart, SEEK_SET);
+		scanRecordBatches(tableFile, *recordBlockSize, where, skipBlock, skipBlockAmount, 0, NULL, callback, context);
+	}
+	
+	free(pageEntry);
+	free(skipBlock);
+	fclose(tableFile);
+	endQueryOperator();
+	return 1;
+}
+
+int selectReadTableColumns(
+	char database[], char table[], RecordBlockVector *records, Attribute attribute[], int *attributeTotal, 
+	int *recordBlockSize, Predicate *where, int neededColumn[]
+)
+{
+	RecordCollector collector = {records, recordBlockSize};
+	return scanTableRecords(
+		database, table, attribute, attributeTotal, recordBlockSize, where, 
+		neededColumn, 1, collectRecordCallback, &collector
+	);
+}
+
+int selectReadTable(
+	char database[], char table[], RecordBlockVector *records, Attribute attribute[], int *attributeTotal, 
+	int *recordBlockSize, char *whereAttr, void *whereValue
+)
+{
+	Predicate where;
+	if (whereAttr != NULL)
+	{
+		int totalAttribute = 0;
+		Attribute tableAttribute[__MAX_ATTRIBUTE_ON_TABLE];
+		readTableAttribute(database, table, &totalAttribute, tableAttribute, NULL);
+		
+		int whereIndex = -1;
+		for (int i = 0; i < totalAttribute && whereIndex == -1; i++)
+		{
+			if (strcmp(whereAttr, tableAttribute[i].attributeName) == 0)
+			{
+				whereIndex = i;
+			}
+		}
+		if (whereIndex == -1)
+		{
+			return 0;
+		}
+		initEqualPredicate(&where, tableAttribute, whereIndex, whereValue);
+	}
+	
+	return selectReadTableColumns(
+		database, table, records, attribute, attributeTotal, recordBlockSize, whereAttr != NULL ? &where : NULL, NULL
+	);
+}
+
+int compareDouble(const void *a, const void *b)
+{
+	double x = *(const double *)a;
+	double y = *(const double *)b;
+	return (x > y) - (x < y);
+}
+
+int analyzeRecordCallback(void *context, char *recordData)
+{
+	StatsCollector *collector = (StatsCollector *)context;
+	TableStats *stats = collector->stats;
+	
+	long long int sampleSlot = stats->rowAmount;
+	if (sampleSlot >= __STATS_SAMPLE_ROWS)
+	{
+		collector->random ^= collector->random << 13;
+		collector->random ^= collector->random >> 7;
+		collector->random ^= collector->random << 17;
+		sampleSlot = collector->random % (stats->rowAmount + 1);
+	}
+	
+	for (int i = 0; i < stats->attributeAmount; i++)
+	{
+		char *value = recordData + collector->attributeOffset[i];
+		addColumnStatsValue(&stats->column[i], value);
+		if (collector->sample[i] != NULL && sampleSlot < __STATS_SAMPLE_ROWS)
+		{
+			collector->sample[i][sampleSlot] = statsNumericValue(&stats->column[i].attribute, value);
+		}
+	}
+	stats->rowAmount += 1;
+	return 1;
+}
+
+int analyzeTable(char database[], char table[])
+{
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute = 0;
+	int recordBlockSize = 0;
+	if (readTableAttribute(database, table, &totalAttribute, attribute, &recordBlockSize) == 0)
+	{
+		return 0;
+	}
+	
+	StatsCollector collector;
+	memset(&collector, 0, sizeof(collector));
+	collector.stats = newTableStats(attribute, totalAttribute);
+	collector.random = 88172645463325252ULL;
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		collector.attributeOffset[i] = attributeDataOffset(attribute, i);
+		if (isNumericAttribute(&attribute[i]))
+		{
+			collector.sample[i] = malloc(sizeof(double) * __STATS_SAMPLE_ROWS);
+		}
+	}
+	
+	int returnValue = scanTableRecords(
+		database, table, attribute, &totalAttribute, &recordBlockSize, NULL, NULL, 0, analyzeRecordCallback, &collector
+	);
+	
+	TableStats *stats = collector.stats;
+	long long int sampleAmount = stats->rowAmount < __STATS_SAMPLE_ROWS ? stats->rowAmount : __STATS_SAMPLE_ROWS;
+	for (int i = 0; i < stats->attributeAmount; i++)
+	{
+		if (collector.sample[i] != NULL && sampleAmount > 0)
+		{
+			qsort(collector.sample[i], sampleAmount, sizeof(double), compareDouble);
+			stats->column[i].bucketAmount = __STATS_HISTOGRAM_BUCKETS;
+			for (int j = 0; j <= __STATS_HISTOGRAM_BUCKETS; j++)
+			{
+				stats->column[i].bucketBound[j] = collector.sample[i][(sampleAmount - 1) * j / __STATS_HISTOGRAM_BUCKETS];
+			}
+		}
+		free(collector.sample[i]);
+	}
+	
+	if (returnValue == 1)
+	{
+		returnValue = saveTableStats(database, table, stats);
+		buildTableZoneMap(database, table);
+		rebuildTableBloomFilters(database, table);
+	}
+	free(stats);
+	return returnValue;
+}
+
+TableStats* ensureTableStats(char database[], char table[])
+{
+	TableStats *stats = loadTableStats(database, table);
+	if (stats == NULL && analyzeTable(database, table) == 1)
+	{
+		stats = loadTableStats(database, table);
+	}
+	return stats;
+}
+
+long long int limitedRecordAmount(long long int recordAmount, long long int offset, long long int limit)
+{
+	recordAmount = recordAmount > offset ? recordAmount - offset : 0;
+	return limit >= 0 && limit < recordAmount ? limit : recordAmount;
+}
+
+void initRecordLimiter(
+	RecordLimiter *limiter, RecordCallback callback, void *context, long long int offset, long long int limit
+)
+{
+	limiter->callback = callback;
+	limiter->context = context;
+	limiter->offset = offset;
+	limiter->limit = limit;
+	limiter->seen = 0;
+}
+
+int limitRecordCallback(void *context, char *recordData)
+{
+	RecordLimiter *limiter = (RecordLimiter *)context;
+	
+	if (limiter->limit >= 0 && limiter->seen >= limiter->offset + limiter->limit)
+	{
+		return 0;
+	}
+	
+	limiter->seen++;
+	if (limiter->seen > limiter->offset && limiter->callback(limiter->context, recordData) == 0)
+	{
+		return 0;
+	}
+	
+	return limiter->limit < 0 || limiter->seen < limiter->offset + limiter->limit;
+}
+
+void initRecordSorter(
+	RecordSorter *sorter, int recordSize, Attribute *keyAttribute, int keyOffset, int descending, long long int keepLimit
+)
+{
+	memset(sorter, 0, sizeof(RecordSorter));
+	sorter->recordSize = recordSize > 0 ? recordSize : 1;
+	sorter->keyAttribute = *keyAttribute;
+	sorter->keyOffset = keyOffset;
+	sorter->descending = descending;
+	sorter->sorterId = recordSorterSequence++;
+	sorter->keepLimit = -1;
+	
+	sorter->bufferCapacity = __SORT_MEMORY_BUDGET / (sorter->recordSize + sizeof(char *));
+	if (sorter->bufferCapacity < 2)
+	{
+		sorter->bufferCapacity = 2;
+	}
+	if (keepLimit >= 0 && keepLimit <= sorter->bufferCapacity)
+	{
+		sorter->keepLimit = keepLimit;
+		sorter->bufferCapacity = keepLimit > 0 ? keepLimit : 1;
+	}
+	sorter->buffer = malloc((size_t)sorter->recordSize * sorter->bufferCapacity);
+	sorter->pointer = (char **)malloc(sizeof(char *) * sorter->bufferCapacity);
+	
+	sorter->runCapacity = 4;
+	sorter->run = (int *)malloc(sizeof(int) * sorter->runCapacity);
+}
+
+void sortRunFilePath(char filePath[], RecordSorter *sorter, int runId)
+{
+	sprintf(filePath, "%s/.sort.%d.%d.%d", __DATABASE_ROOT, (int)getpid(), sorter->sorterId, runId);
+}
+
+void delRecordSorter(RecordSorter *sorter)
+{
+	char filePath[1024];
+	for (int i = 0; i < sorter->runAmount; i++)
+	{
+		sortRunFilePath(filePath, sorter, sorter->run[i]);
+		remove(filePath);
+	}
+	free(sorter->run);
+	free(sorter->pointer);
+	free(sorter->buffer);
+}
+
+int compareSortKey(RecordSorter *sorter, const char *a, const char *b)
+{
+	int compared = compareAttributeValue(&sorter->keyAttribute, a + sorter->keyOffset, b + sorter->keyOffset);
+	return sorter->descending ? -compared : compared;
+}
+
+int compareSortPointer(const void *a, const void *b, void *context)
+{
+	return compareSortKey((RecordSorter *)context, *(char * const *)a, *(char * const *)b);
+}
+
+void sortRecordSorterBuffer(RecordSorter *sorter)
+{
+	for (int i = 0; i < sorter->bufferAmount; i++)
+	{
+		sorter->pointer[i] = sorter->buffer + (size_t)i * sorter->recordSize;
+	}
+	qsort_r(sorter->pointer, sorter->bufferAmount, sizeof(char *), compareSortPointer, sorter);
+}
+
+int appendSortRun(RecordSorter *sorter, int runId)
+{
+	if (sorter->runAmount >= sorter->runCapacity)
+	{
+		sorter->runCapacity *= 2;
+		sorter->run = (int *)realloc(sorter->run, sizeof(int) * sorter->runCapacity);
+	}
+	sorter->run[sorter->runAmount++] = runId;
+	return runId;
+}
+
+int writeSortRunCallback(void *context, char *recordData)
+{
+	SortRunWriter *runWriter = (SortRunWriter *)context;
+	return fwrite(recordData, runWriter->recordSize, 1, runWriter->file) == 1;
+}
+
+int spillRecordSorterRun(RecordSorter *sorter)
+{
+	char filePath[1024];
+	int runId = sorter->nextRunId++;
+	sortRunFilePath(filePath, sorter, runId);
+	
+	FILE *runFile = fopen(filePath, "w");
+	if (runFile == NULL)
+	{
+		sorter->failed = 1;
+		return 0;
+	}
+	
+	sortRecordSorterBuffer(sorter);
+	int written = 1;
+	for (int i = 0; i < sorter->bufferAmount && written == 1; i++)
+	{
+		written = fwrite(sorter->pointer[i], sorter->recordSize, 1, runFile) == 1;
+	}
+	if (fclose(runFile) != 0 || written == 0)
+	{
+		remove(filePath);
+		sorter->failed = 1;
+		return 0;
+	}
+	
+	appendSortRun(sorter, runId);
+	sorter->bufferAmount = 0;
+	return 1;
+}
+
+void siftUpTopRecordHeap(RecordSorter *sorter, int index)
+{
+	while (index > 0)
+	{
+		int parent = (index - 1) / 2;
+		if (compareSortKey(sorter, sorter->pointer[index], sorter->pointer[parent]) <= 0)
+		{
+			return;
+		}
+		char *temp = sorter->pointer[index];
+		sorter->pointer[index] = sorter->pointer[parent];
+		sorter->pointer[parent] = temp;
+		index = parent;
+	}
+}
+
+void siftDownTopRecordHeap(RecordSorter *sorter, int index)
+{
+	while (1)
+	{
+		int largest = index;
+		int left = index * 2 + 1;
+		int right = left + 1;
+		
+		if (left < sorter->bufferAmount && compareSortKey(sorter, sorter->pointer[left], sorter->pointer[largest]) > 0)
+		{
+			largest = left;
+		}
+		if (right < sorter->bufferAmount && compareSortKey(sorter, sorter->pointer[right], sorter->pointer[largest]) > 0)
+		{
+			largest = right;
+		}
+		if (largest == index)
+		{
+			return;
+		}
+		
+		char *temp = sorter->pointer[index];
+		sorter->pointer[index] = sorter->pointer[largest];
+		sorter->pointer[largest] = temp;
+		index = largest;
+	}
+}
+
+int keepTopRecord(RecordSorter *sorter, char *recordData)
+{
+	sorter->recordAmount++;
+	
+	if (sorter->bufferAmount < sorter->keepLimit)
+	{
+		char *slot = sorter->buffer + (size_t)sorter->bufferAmount * sorter->recordSize;
+		memcpy(slot, recordData, sorter->recordSize);
+		sorter->pointer[sorter->bufferAmount] = slot;
+		sorter->bufferAmount++;
+		siftUpTopRecordHeap(sorter, sorter->bufferAmount - 1);
+	}
+	else if (sorter->bufferAmount > 0 && compareSortKey(sorter, recordData, sorter->pointer[0]) < 0)
+	{
+		memcpy(sorter->pointer[0], recordData, sorter->recordSize);
+		siftDownTopRecordHeap(sorter, 0);
+	}
+	
+	return 1;
+}
+
+int sortRecordCallback(void *context, char *recordData)
+{
+	RecordSorter *sorter = (RecordSorter *)context;
+	
+	if (sorter->keepLimit >= 0)
+	{
+		return keepTopRecord(sorter, recordData);
+	}
+	
+	if (sorter->bufferAmount >= sorter->bufferCapacity && spillRecordSorterRun(sorter) == 0)
+	{
+		return 0;
+	}
+	
+	memcpy(sorter->buffer + (size_t)sorter->bufferAmount * sorter->recordSize, recordData, sorter->recordSize);
+	sorter->bufferAmount++;
+	sorter->recordAmount++;
+	return 1;
+}
+
+void siftDownSortRunHeap(RecordSorter *sorter, SortRunCursor cursor[], int heap[], int heapSize, int index)
+{
+	while (1)
+	{
+		int smallest = index;
+		int left = index * 2 + 1;
+		int right = left + 1;
+		
+		if (left < heapSize && compareSortKey(sorter, cursor[heap[left]].record, cursor[heap[smallest]].record) < 0)
+		{
+			smallest = left;
+		}
+		if (right < heapSize && compareSortKey(sorter, cursor[heap[right]].record, cursor[heap[smallest]].record) < 0)
+		{
+			smallest = right;
+		}
+		if (smallest == index)
+		{
+			return;
+		}
+		
+		int temp = heap[index];
+		heap[index] = heap[smallest];
+		heap[smallest] = temp;
+		index = smallest;
+	}
+}
+
+int mergeSortRuns(RecordSorter *sorter, int firstRun, int runAmount, RecordCallback callback, void *context)
+{
+	char filePath[1024];
+	SortRunCursor cursor[runAmount];
+	int heap[runAmount];
+	int heapSize = 0;
+	
+	for (int i = 0; i < runAmount; i++)
+	{
+		sortRunFilePath(filePath, sorter, sorter->run[firstRun + i]);
+		cursor[i].file = fopen(filePath, "r");
+		cursor[i].record = malloc(sorter->recordSize);
+		
+		if (cursor[i].file == NULL)
+		{
+			sorter->failed = 1;
+		}
+		else if (fread(cursor[i].record, sorter->recordSize, 1, cursor[i].file) == 1)
+		{
+			heap[heapSize++] = i;
+		}
+	}
+	
+	for (int i = heapSize / 2 - 1; i >= 0; i--)
+	{
+		siftDownSortRunHeap(sorter, cursor, heap, heapSize, i);
+	}
+	
+	int merging = 1;
+	while (heapSize > 0 && merging == 1)
+	{
+		SortRunCursor *top = &cursor[heap[0]];
+		merging = callback(context, top->record);
+		
+		if (fread(top->record, sorter->recordSize, 1, top->file) != 1)
+		{
+			heap[0] = heap[--heapSize];
+		}
+		siftDownSortRunHeap(sorter, cursor, heap, heapSize, 0);
+	}
+	
+	for (int i = 0; i < runAmount; i++)
+	{
+		if (cursor[i].file != NULL)
+		{
+			fclose(cursor[i].file);
+		}
+		free(cursor[i].record);
+	}
+	
+	return merging;
+}
+
+int prepareSortedRecords(RecordSorter *sorter)
+{
+	if (sorter->failed == 1)
+	{
+		return 0;
+	}
+	if (sorter->runAmount == 0)
+	{
+		sortRecordSorterBuffer(sorter);
+		return 1;
+	}
+	
+	if (sorter->bufferAmount > 0 && spillRecordSorterRun(sorter) == 0)
+	{
+		return 0;
+	}
+	
+	char filePath[1024];
+	while (sorter->runAmount > __SORT_MERGE_FAN_IN)
+	{
+		int runId = sorter->nextRunId++;
+		sortRunFilePath(filePath, sorter, runId);
+		FILE *runFile = fopen(filePath, "w");
+		if (runFile == NULL)
+		{
+			sorter->failed = 1;
+			return 0;
+		}
+		
+		SortRunWriter runWriter = {runFile, sorter->recordSize};
+		int merged = mergeSortRuns(sorter, 0, __SORT_MERGE_FAN_IN, writeSortRunCallback, &runWriter);
+		if (fclose(runFile) != 0 || merged == 0 || sorter->failed == 1)
+		{
+			remove(filePath);
+			sorter->failed = 1;
+			return 0;
+		}
+		
+		for (int i = 0; i < __SORT_MERGE_FAN_IN; i++)
+		{
+			sortRunFilePath(filePath, sorter, sorter->run[i]);
+			remove(filePath);
+		}
+		memmove(sorter->run, sorter->run + __SORT_MERGE_FAN_IN, sizeof(int) * (sorter->runAmount - __SORT_MERGE_FAN_IN));
+		sorter->runAmount -= __SORT_MERGE_FAN_IN;
+		appendSortRun(sorter, runId);
+	}
+	return 1;
+}
+
+int emitSortedRecords(RecordSorter *sorter, RecordCallback callback, void *context)
+{
+	if (sorter->runAmount == 0)
+	{
+		for (int i = 0; i < sorter->bufferAmount; i++)
+		{
+			if (callback(context, sorter->pointer[i]) == 0)
+			{
+				break;
+			}
+		}
+		return 1;
+	}
+	
+	mergeSortRuns(sorter, 0, sorter->runAmount, callback, context);
+	return sorter->failed == 0;
+}
+
+void initResultCapture(ResultCapture *capture)
+{
+	initDynamicBlock(&capture->frame);
+	capture->overflow = 0;
+	capture->tableAmount = 0;
+	memset(capture->tableName, 0, sizeof(capture->tableName));
+}
+
+void delResultCapture(ResultCapture *capture)
+{
+	delDynamicBlock(&capture->frame);
+}
+
+void captureResultFrame(ResultCapture *capture, char message[])
+{
+	if (capture->overflow == 1)
+	{
+		return;
+	}
+	
+	unsigned short frameLength = __DATA_BUFFER;
+	while (frameLength > 0 && message[frameLength - 1] == '\0')
+	{
+		frameLength--;
+	}
+	
+	if (capture->frame.size + sizeof(frameLength) + frameLength > __RESULT_CACHE_ENTRY_MAX)
+	{
+		capture->overflow = 1;
+		return;
+	}
+	concatDynamicBlock(&capture->frame, &frameLength, sizeof(frameLength));
+	concatDynamicBlock(&capture->frame, message, frameLength);
+}
+
+char* normalizeCacheKey(char database[], char script[])
+{
+	size_t scriptLength = strlen(script);
+	size_t databaseLength = strlen(database);
+	char *key = malloc(databaseLength + scriptLength + 2);
+	memcpy(key, database, databaseLength);
+	key[databaseLength] = '\n';
+	
+	size_t keyLength = databaseLength + 1;
+	char quote = '\0';
+	for (size_t i = 0; i < scriptLength; i++)
+	{
+		char character = script[i];
+		if (quote == '\0' && (character == ' ' || character == '\t' || character == '\n' || character == '\r'))
+		{
+			if (keyLength > databaseLength + 1 && key[keyLength - 1] != ' ')
+			{
+				key[keyLength++] = ' ';
+			}
+			continue;
+		}
+		
+		if (quote == '\0' && (character == '\'' || character == '"'))
+		{
+			quote = character;
+		}
+		else if (quote == character)
+		{
+			quote = '\0';
+		}
+		key[keyLength++] = character;
+	}
+	
+	while (keyLength > databaseLength + 1 && key[keyLength - 1] == ' ')
+	{
+		keyLength--;
+	}
+	key[keyLength] = '\0';
+	return key;
+}
+
+ResultCacheEntry* findCachedResult(char key[], unsigned int hash)
+{
+	ResultCacheEntry *entry = resultCache.bucket[hash & (__RESULT_CACHE_BUCKETS - 1)];
+	while (entry != NULL)
+	{
+		if (entry->hash == hash && strcmp(entry->key, key) == 0)
+		{
+			return entry;
+		}
+		entry = entry->next;
+	}
+	return NULL;
+}
+
+void unlinkCachedResult(ResultCacheEntry *entry)
+{
+	if (entry->newer != NULL)
+	{
+		entry->newer->older = entry->older;
+	}
+	else
+	{
+		resultCache.newest = entry->older;
+	}
+	
+	if (entry->older != NULL)
+	{
+		entry->older->newer = entry->newer;
+	}
+	else
+	{
+		resultCache.oldest = entry->newer;
+	}
+	entry->newer = NULL;
+	entry->older = NULL;
+}
+
+void pushNewestCachedResult(ResultCacheEntry *entry)
+{
+	entry->older = resultCache.newest;
+	entry->newer = NULL;
+	if (resultCache.newest != NULL)
+	{
+		resultCache.newest->newer = entry;
+	}
+	resultCache.newest = entry;
+	if (resultCache.oldest == NULL)
+	{
+		resultCache.oldest = entry;
+	}
+}
+
+void removeCachedResult(ResultCacheEntry *entry)
+{
+	ResultCacheEntry **link = &resultCache.bucket[entry->hash & (__RESULT_CACHE_BUCKETS - 1)];
+	while (*link != entry)
+	{
+		link = &(*link)->next;
+	}
+	*link = entry->next;
+	
+	unlinkCachedResult(entry);
+	resultCache.memoryUsed -= sizeof(ResultCacheEntry) + strlen(entry->key) + 1 + entry->frameSize;
+	
+	free(entry->key);
+	free(entry->frame);
+	free(entry);
+}
+
+int sendCachedResult(char key[], char database[], int fileDescriptor, char message[])
+{
+	unsigned int hash = hashBytes(key, strlen(key));
+	ResultCacheEntry *entry = findCachedResult(key, hash);
+	if (entry == NULL)
+	{
+		return 0;
+	}
+	
+	for (int i = 0; i < entry->tableAmount; i++)
+	{
+		if (getTableVersion(database, entry->tableName[i]) != entry->tableVersion[i])
+		{
+			removeCachedResult(entry);
+			return 0;
+		}
+	}
+	
+	unlinkCachedResult(entry);
+	pushNewestCachedResult(entry);
+	
+	size_t position = 0;
+	while (position < entry->frameSize)
+	{
+		unsigned short frameLength;
+		memcpy(&frameLength, entry->frame + position, sizeof(frameLength));
+		position += sizeof(frameLength);
+		
+		memset(message, 0, __DATA_BUFFER);
+		memcpy(message, entry->frame + position, frameLength);
+		position += frameLength;
+		
+		sendToClient(fileDescriptor, message, __DATA_BUFFER, 0);
+	}
+	return 1;
+}
+
+void storeCachedResult(char key[], char database[], ResultCapture *capture)
+{
+	if (capture->overflow == 1 || capture->tableAmount == 0)
+	{
+		return;
+	}
+	
+	size_t keyLength = strlen(key);
+	size_t entrySize = sizeof(ResultCacheEntry) + keyLength + 1 + capture->frame.size;
+	if (entrySize > __RESULT_CACHE_MEMORY)
+	{
+		return;
+	}
+	
+	unsigned int hash = hashBytes(key, keyLength);
+	ResultCacheEntry *entry = findCachedResult(key, hash);
+	if (entry != NULL)
+	{
+		removeCachedResult(entry);
+	}
+	
+	while (resultCache.oldest != NULL && resultCache.memoryUsed + entrySize > __RESULT_CACHE_MEMORY)
+	{
+		removeCachedResult(resultCache.oldest);
+	}
+	
+	entry = calloc(1, sizeof(ResultCacheEntry));
+	entry->key = malloc(keyLength + 1);
+	memcpy(entry->key, key, keyLength + 1);
+	entry->hash = hash;
+	entry->tableAmount = capture->tableAmount;
+	for (int i = 0; i < capture->tableAmount; i++)
+	{
+		strcpy(entry->tableName[i], capture->tableName[i]);
+		entry->tableVersion[i] = findTableVersion(database, capture->tableName[i], 1)->version;
+	}
+	entry->frameSize = capture->frame.size;
+	entry->frame = malloc(capture->frame.size > 0 ? capture->frame.size : 1);
+	memcpy(entry->frame, capture->frame.block, capture->frame.size);
+	
+	int index = hash & (__RESULT_CACHE_BUCKETS - 1);
+	entry->next = resultCache.bucket[index];
+	resultCache.bucket[index] = entry;
+	pushNewestCachedResult(entry);
+	resultCache.memoryUsed += entrySize;
+}
+
+void initResultWriter(
+	ResultWriter *writer, int fileDescriptor, char message[], Attribute attribute[], int totalAttribute, 
+	int selectedAttribute[], int amountOfSelectedAttribute
+)
+{
+	writer->fileDescriptor = fileDescriptor;
+	writer->message = message;
+	writer->attribute = attribute;
+	writer->selectedAttribute = selectedAttribute;
+	writer->amountOfSelectedAttribute = amountOfSelectedAttribute;
+	writer->rowsSent = 0;
+	writer->capture = NULL;
+	
+	int offsetData = 0;
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		writer->offsetDataOfAttribute[i] = offsetData;
+		offsetData += attribute[i].size;
+	}
+}
+
+void sendResultFrame(ResultWriter *writer)
+{
+	if (writer->fileDescriptor >= 0)
+	{
+		sendToClient(writer->fileDescriptor, writer->message, __DATA_BUFFER, 0);
+	}
+	
+	QueryOperator *operator = currentQueryOperator();
+	if (operator != NULL)
+	{
+		operator->bytes += __DATA_BUFFER;
+	}
+	if (writer->capture != NULL)
+	{
+		captureResultFrame(writer->capture, writer->message);
+		memset(writer->message, 0, __DATA_BUFFER);
+	}
+}
+
+void writeResultHeader(ResultWriter *writer, int recordAmount)
+{
+	sprintf(writer->message, "Q");
+	sendResultFrame(writer);
+	
+	memcpy(writer->message, &(writer->amountOfSelectedAttribute), sizeof(writer->amountOfSelectedAttribute));
+	sendResultFrame(writer);
+	
+	for (int j = 0; j < writer->amountOfSelectedAttribute; j++)
+	{
+		sprintf(writer->message, "%s", writer->attribute[writer->selectedAttribute[j]].attributeName);
+		sendResultFrame(writer);
+	}
+	
+	memcpy(writer->message, &recordAmount, sizeof(recordAmount));
+	sendResultFrame(writer);
+}
+
+int writeResultRecord(void *context, char *recordData)
+{
+	ResultWriter *writer = (ResultWriter *)context;
+	char *message = writer->message;
+	
+	for (int k = 0; k < writer->amountOfSelectedAttribute; k++)
+	{
+		Attribute *attribute = &writer->attribute[writer->selectedAttribute[k]];
+		char *value = recordData + writer->offsetDataOfAttribute[writer->selectedAttribute[k]];
+		
+		if (attribute->type == STRING)
+		{
+			int copiedCharacter = 0;
+			int bufferFilled = 1;
+			message[0] = 'V';
+			while(copiedCharacter < attribute->size)
+			{
+				message[bufferFilled] = value[copiedCharacter];
+				bufferFilled++;
+				copiedCharacter++;
+				
+				if (bufferFilled == __DATA_BUFFER - 1 || copiedCharacter == attribute->size)
+				{
+					message[bufferFilled] = '\0';
+					sendResultFrame(writer);
+					bufferFilled = 1;
+					message[0] = 'V';
+				}
+			}
+		}
+		else if (attribute->type == INT)
+		{
+			sprintf(message, "V%d", *(int *)value); 
+			sendResultFrame(writer);
+		}
+		else if (attribute->type == LONG)
+		{
+			sprintf(message, "V%lld", *(long long int *)value); 
+			sendResultFrame(writer);
+		}
+		else if (attribute->type == DECIMAL)
+		{
+			sprintf(message, "V%lf", *(double *)value); 
+			sendResultFrame(writer);
+		}
+		else
+		{
+			message[0] = 'V';
+			memcpy(message + 1, value, attribute->size);
+			message[attribute->size + 1] = '\0';
+			sendResultFrame(writer);
+		}
+		sprintf(message, "C"); 
+		sendResultFrame(writer);
+	}
+	sprintf(message, "R"); 
+	sendResultFrame(writer);
+	
+	writer->rowsSent++;
+	return 1;
+}
+
+void initAggregateHashTable(AggregateHashTable *table, int keySize, int groupSize)
+{
+	table->capacity = 64;
+	table->size = 0;
+	table->keySize = keySize;
+	table->groupSize = groupSize;
+	table->hash = (unsigned int *)malloc(sizeof(unsigned int) * table->capacity);
+	table->group = (char **)malloc(sizeof(char *) * table->capacity);
+	memset(table->group, 0, sizeof(char *) * table->capacity);
+}
+
+void delAggregateHashTable(AggregateHashTable *table)
+{
+	for (int i = 0; i < table->capacity; i++)
+	{
+		free(table->group[i]);
+	}
+	free(table->hash);
+	free(table->group);
+}
+
+void growAggregateHashTable(AggregateHashTable *table)
+{
+	int oldCapacity = table->capacity;
+	unsigned int *oldHash = table->hash;
+	char **oldGroup = table->group;
+	
+	table->capacity *= 2;
+	table->hash = (unsigned int *)malloc(sizeof(unsigned int) * table->capacity);
+	table->group = (char **)malloc(sizeof(char *) * table->capacity);
+	memset(table->group, 0, sizeof(char *) * table->capacity);
+	
+	for (int i = 0; i < oldCapacity; i++)
+	{
+		if (oldGroup[i] != NULL)
+		{
+			int slot = oldHash[i] & (table->capacity - 1);
+			while (table->group[slot] != NULL)
+			{
+				slot = (slot + 1) & (table->capacity - 1);
+			}
+			table->hash[slot] = oldHash[i];
+			table->group[slot] = oldGroup[i];
+		}
+	}
+	
+	free(oldHash);
+	free(oldGroup);
+}
+
+char* findAggregateGroup(AggregateHashTable *table, const char *key)
+{
+	unsigned int hash = hashBytes(key, table->keySize);
+	int slot = hash & (table->capacity - 1);
+	
+	while (table->group[slot] != NULL)
+	{
+		if (table->hash[slot] == hash && memcmp(table->group[slot], key, table->keySize) == 0)
+		{
+			return table->group[slot];
+		}
+		slot = (slot + 1) & (table->capacity - 1);
+	}
+	
+	char *group = malloc(table->groupSize);
+	memset(group, 0, table->groupSize);
+	memcpy(group, key, table->keySize);
+	table->hash[slot] = hash;
+	table->group[slot] = group;
+	table->size++;
+	
+	if (table->size * 10 >= table->capacity * 7)
+	{
+		growAggregateHashTable(table);
+	}
+	
+	return group;
+}
+
+int parseSelectItem(char itemString[], SelectQuery *query, SelectItem *item)
+{
+	memset(item, 0, sizeof(SelectItem));
+	item->attributeIndex = -1;
+	
+	char *openParenthesis = strchr(itemString, '(');
+	size_t length = strlen(itemString);
+	char argument[64];
+	memset(argument, 0, sizeof(argument));
+	
+	if (openParenthesis == NULL)
+	{
+		strncpy(argument, itemString, sizeof(argument) - 1);
+	}
+	else
+	{
+		if (itemString[length - 1] != ')' || itemString + length - 1 - openParenthesis - 1 >= (long)sizeof(argument))
+		{
+			return 0;
+		}
+		strncpy(argument, openParenthesis + 1, itemString + length - 1 - openParenthesis - 1);
+		
+		*openParenthesis = '\0';
+		if (strcasecmp(itemString, "COUNT") == 0)
+		{
+			item->function = COUNT_AGGREGATE;
+		}
+		else if (strcasecmp(itemString, "SUM") == 0)
+		{
+			item->function = SUM_AGGREGATE;
+		}
+		else if (strcasecmp(itemString, "MIN") == 0)
+		{
+			item->function = MIN_AGGREGATE;
+		}
+		else if (strcasecmp(itemString, "MAX") == 0)
+		{
+			item->function = MAX_AGGREGATE;
+		}
+		else if (strcasecmp(itemString, "AVG") == 0)
+		{
+			item->function = AVG_AGGREGATE;
+		}
+		else
+		{
+			return 0;
+		}
+		*openParenthesis = '(';
+	}
+	
+	convertToLower(argument, strlen(argument));
+	
+	if (item->function == COUNT_AGGREGATE && strcmp(argument, "*") == 0)
+	{
+		strcpy(item->resultAttribute.attributeName, "count(*)");
+		item->resultAttribute.type = LONG;
+		item->resultAttribute.size = sizeof(long long int);
+		return 1;
+	}
+	
+	item->attributeIndex = findTableAttributeIndex(query->tableAttribute, query->totalAttribute, argument);
+	if (item->attributeIndex == -1)
+	{
+		return 0;
+	}
+	
+	Attribute *source = &query->tableAttribute[item->attributeIndex];
+	int numeric = source->type == INT || source->type == LONG || source->type == DECIMAL;
+	
+	item->resultAttribute = *source;
+	if (item->function != NO_AGGREGATE)
+	{
+		convertToLower(itemString, strlen(itemString));
+		snprintf(item->resultAttribute.attributeName, __MAX_ATTRIBUTE_NAME_LENGTH, "%s", itemString);
+	}
+	
+	if (item->function == COUNT_AGGREGATE)
+	{
+		item->resultAttribute.type = LONG;
+		item->resultAttribute.size = sizeof(long long int);
+	}
+	else if (item->function == SUM_AGGREGATE)
+	{
+		if (numeric == 0)
+		{
+			return 0;
+		}
+		item->resultAttribute.type = source->type == DECIMAL ? DECIMAL : LONG;
+		item->resultAttribute.size = source->type == DECIMAL ? sizeof(double) : sizeof(long long int);
+	}
+	else if (item->function == AVG_AGGREGATE)
+	{
+		if (numeric == 0)
+		{
+			return 0;
+		}
+		item->resultAttribute.type = DECIMAL;
+		item->resultAttribute.size = sizeof(double);
+	}
+	
+	return 1;
+}
+
+int aggregateRecordCallback(void *context, char *recordData)
+{
+	AggregateContext *aggregate = (AggregateContext *)context;
+	SelectQuery *query = aggregate->query;
+	
+	for (int i = 0; i < query->groupByAmount; i++)
+	{
+		memcpy(
+			aggregate->key + aggregate->keyOffset[i], recordData + aggregate->attributeOffset[query->groupBy[i]], 
+			query->tableAttribute[query->groupBy[i]].size
+		);
+	}
+	
+	char *group = findAggregateGroup(&aggregate->table, aggregate->key);
+	
+	for (int i = 0; i < query->itemAmount; i++)
+	{
+		SelectItem *item = &query->item[i];
+		if (item->function == NO_AGGREGATE)
+		{
+			continue;
+		}
+		
+		AggregateState *state = (AggregateState *)(group + aggregate->stateOffset[i]);
+		char *extremeValue = group + aggregate->stateOffset[i] + sizeof(AggregateState);
+		state->count++;
+		
+		if (item->attributeIndex == -1)
+		{
+			continue;
+		}
+		
+		Attribute *attribute = &query->tableAttribute[item->attributeIndex];
+		char *value = recordData + aggregate->attributeOffset[item->attributeIndex];
+		
+		if (item->function == SUM_AGGREGATE || item->function == AVG_AGGREGATE)
+		{
+			if (attribute->type == INT)
+			{
+				int data;
+				memcpy(&data, value, sizeof(data));
+				state->integerSum += data;
+				state->decimalSum += data;
+			}
+			else if (attribute->type == LONG)
+			{
+				long long int data;
+				memcpy(&data, value, sizeof(data));
+				state->integerSum += data;
+				state->decimalSum += data;
+			}
+			else
+			{
+				double data;
+				memcpy(&data, value, sizeof(data));
+				state->decimalSum += data;
+			}
+		}
+		else if (item->function == MIN_AGGREGATE || item->function == MAX_AGGREGATE)
+		{
+			int compared = state->hasValue ? compareAttributeValue(attribute, value, extremeValue) : 0;
+			if (
+				state->hasValue == 0 || 
+				(item->function == MIN_AGGREGATE && compared < 0) || 
+				(item->function == MAX_AGGREGATE && compared > 0)
+			)
+			{
+				memcpy(extremeValue, value, attribute->size);
+				state->hasValue = 1;
+			}
+		}
+	}
+	
+	return 1;
+}
+
+void buildAggregateResultRecord(AggregateContext *aggregate, char *group, RecordBlock *result)
+{
+	SelectQuery *query = aggregate->query;
+	int resultOffset = 0;
+	
+	for (int i = 0; i < query->itemAmount; i++)
+	{
+		SelectItem *item = &query->item[i];
+		AggregateState *state = (AggregateState *)(group + aggregate->stateOffset[i]);
+		char *target = (char *)result->data + resultOffset;
+		
+		if (item->function == NO_AGGREGATE)
+		{
+			for (int j = 0; j < query->groupByAmount; j++)
+			{
+				if (query->groupBy[j] == item->attributeIndex)
+				{
+					memcpy(target, group + aggregate->keyOffset[j], item->resultAttribute.size);
+					break;
+				}
+			}
+		}
+		else if (item->function == COUNT_AGGREGATE)
+		{
+			memcpy(target, &state->count, sizeof(state->count));
+		}
+		else if (item->function == SUM_AGGREGATE)
+		{
+			if (item->resultAttribute.type == DECIMAL)
+			{
+				memcpy(target, &state->decimalSum, sizeof(state->decimalSum));
+			}
+			else
+			{
+				memcpy(target, &state->integerSum, sizeof(state->integerSum));
+			}
+		}
+		else if (item->function == AVG_AGGREGATE)
+		{
+			double average = state->count > 0 ? state->decimalSum / state->count : 0;
+			memcpy(target, &average, sizeof(average));
+		}
+		else
+		{
+			memcpy(target, group + aggregate->stateOffset[i] + sizeof(AggregateState), item->resultAttribute.size);
+		}
+		
+		resultOffset += item->resultAttribute.size;
+	}
+}
+
+int joinKeyBytes(Attribute *attribute, const char *value, int keyDecimal, char key[])
+{
+	if (isNumericAttribute(attribute) == 1)
+	{
+		long long int integerValue = 0;
+		double decimalValue = 0;
+		
+		if (attribute->type == INT)
+		{
+			int intValue;
+			memcpy(&intValue, value, sizeof(intValue));
+			integerValue = intValue;
+			decimalValue = intValue;
+		}
+		else if (attribute->type == LONG)
+		{
+			memcpy(&integerValue, value, sizeof(integerValue));
+			decimalValue = integerValue;
+		}
+		else
+		{
+			memcpy(&decimalValue, value, sizeof(decimalValue));
+		}
+		
+		if (keyDecimal == 1)
+		{
+			if (decimalValue == 0)
+			{
+				decimalValue = 0;
+			}
+			memcpy(key, &decimalValue, sizeof(decimalValue));
+			return sizeof(decimalValue);
+		}
+		memcpy(key, &integerValue, sizeof(integerValue));
+		return sizeof(integerValue);
+	}
+	
+	int keyLength = strnlen(value, attribute->size);
+	memcpy(key, value, keyLength);
+	return keyLength;
+}
+
+void initJoinHashTable(JoinHashTable *table)
+{
+	table->bucketAmount = 1024;
+	table->bucket = calloc(table->bucketAmount, sizeof(JoinHashEntry *));
+	table->entryAmount = 0;
+	table->memoryUsed = table->bucketAmount * sizeof(JoinHashEntry *);
+}
+
+void delJoinHashTable(JoinHashTable *table)
+{
+	for (int i = 0; i < table->bucketAmount; i++)
+	{
+		JoinHashEntry *entry = table->bucket[i];
+		while (entry != NULL)
+		{
+			JoinHashEntry *next = entry->next;
+			free(entry);
+			entry = next;
+		}
+	}
+	free(table->bucket);
+	table->bucket = NULL;
+	table->bucketAmount = 0;
+	table->entryAmount = 0;
+	table->memoryUsed = 0;
+}
+
+void growJoinHashTable(JoinHashTable *table)
+{
+	int bucketAmount = table->bucketAmount * 2;
+	JoinHashEntry **bucket = calloc(bucketAmount, sizeof(JoinHashEntry *));
+	
+	for (int i = 0; i < table->bucketAmount; i++)
+	{
+		JoinHashEntry *entry = table->bucket[i];
+		while (entry != NULL)
+		{
+			JoinHashEntry *next = entry->next;
+			int index = entry->hash & (bucketAmount - 1);
+			entry->next = bucket[index];
+			bucket[index] = entry;
+			entry = next;
+		}
+	}
+	
+	free(table->bucket);
+	table->memoryUsed += (bucketAmount - table->bucketAmount) * sizeof(JoinHashEntry *);
+	table->bucket = bucket;
+	table->bucketAmount = bucketAmount;
+}
+
+void insertJoinHashEntry(JoinHashTable *table, char *record, int recordSize, unsigned int hash)
+{
+	if (table->entryAmount >= table->bucketAmount)
+	{
+		growJoinHashTable(table);
+	}
+	
+	JoinHashEntry *entry = malloc(sizeof(JoinHashEntry) + recordSize);
+	entry->hash = hash;
+	memcpy(entry->record, record, recordSize);
+	
+	int index = hash & (table->bucketAmount - 1);
+	entry->next = table->bucket[index];
+	table->bucket[index] = entry;
+	table->entryAmount += 1;
+	table->memoryUsed += sizeof(JoinHashEntry) + recordSize;
+}
+
+unsigned int joinRecordHash(HashJoin *join, JoinInput *input, char *record, char key[], int *keyLength)
+{
+	*keyLength = joinKeyBytes(&input->keyAttribute, record + input->keyOffset, join->keyDecimal, key);
+	return hashBytes(key, *keyLength);
+}
+
+void joinPartitionFilePath(char filePath[], HashJoin *join, char side, int partition)
+{
+	sprintf(filePath, "%s/.join.%d.%d.%c%d", __DATABASE_ROOT, (int)getpid(), join->joinId, side, partition);
+}
+
+int openJoinPartitions(HashJoin *join)
+{
+	char filePath[1024];
+	for (int i = 0; i < __JOIN_PARTITIONS; i++)
+	{
+		joinPartitionFilePath(filePath, join, 'b', i);
+		join->buildPartition[i] = fopen(filePath, "w+");
+		remove(filePath);
+		
+		joinPartitionFilePath(filePath, join, 'p', i);
+		join->probePartition[i] = fopen(filePath, "w+");
+		remove(filePath);
+		
+		if (join->buildPartition[i] == NULL || join->probePartition[i] == NULL)
+		{
+			return 0;
+		}
+	}
+	return 1;
+}
+
+void closeJoinPartitions(HashJoin *join)
+{
+	for (int i = 0; i < __JOIN_PARTITIONS; i++)
+	{
+		if (join->buildPartition[i] != NULL)
+		{
+			fclose(join->buildPartition[i]);
+			join->buildPartition[i] = NULL;
+		}
+		if (join->probePartition[i] != NULL)
+		{
+			fclose(join->probePartition[i]);
+			join->probePartition[i] = NULL;
+		}
+	}
+}
+
+int joinPartitionIndex(unsigned int hash)
+{
+	return (hash >> 16) % __JOIN_PARTITIONS;
+}
+
+int spillJoinHashTable(HashJoin *join)
+{
+	if (openJoinPartitions(join) == 0)
+	{
+		return 0;
+	}
+	
+	for (int i = 0; i < join->table.bucketAmount; i++)
+	{
+		for (JoinHashEntry *entry = join->table.bucket[i]; entry != NULL; entry = entry->next)
+		{
+			fwrite(entry->record, join->build.recordSize, 1, join->buildPartition[joinPartitionIndex(entry->hash)]);
+		}
+	}
+	
+	delJoinHashTable(&join->table);
+	join->partitioned = 1;
+	return 1;
+}
+
+int buildJoinCallback(void *context, char *recordData)
+{
+	HashJoin *join = (HashJoin *)context;
+	char key[join->build.keyAttribute.size + 8];
+	int keyLength;
+	unsigned int hash = joinRecordHash(join, &join->build, recordData, key, &keyLength);
+	
+	if (join->partitioned == 1)
+	{
+		fwrite(recordData, join->build.recordSize, 1, join->buildPartition[joinPartitionIndex(hash)]);
+		return 1;
+	}
+	
+	insertJoinHashEntry(&join->table, recordData, join->build.recordSize, hash);
+	if (join->table.memoryUsed > __JOIN_MEMORY_BUDGET && spillJoinHashTable(join) == 0)
+	{
+		join->failed = 1;
+		return 0;
+	}
+	return 1;
+}
+
+int emitJoinMatches(HashJoin *join, char *probeRecord, unsigned int hash, char key[], int keyLength)
+{
+	char buildKey[join->build.keyAttribute.size + 8];
+	int buildKeyLength;
+	
+	for (
+		JoinHashEntry *entry = join->table.bucket[hash & (join->table.bucketAmount - 1)]; 
+		entry != NULL; entry = entry->next
+	)
+	{
+		if (entry->hash != hash)
+		{
+			continue;
+		}
+		
+		buildKeyLength = joinKeyBytes(
+			&join->build.keyAttribute, entry->record + join->build.keyOffset, join->keyDecimal, buildKey
+		);
+		if (buildKeyLength != keyLength || memcmp(buildKey, key, keyLength) != 0)
+		{
+			continue;
+		}
+		
+		if (join->buildIsLeft == 1)
+		{
+			memcpy(join->output, entry->record, join->leftRecordSize);
+			memcpy(join->output + join->leftRecordSize, probeRecord, join->rightRecordSize);
+		}
+		else
+		{
+			memcpy(join->output, probeRecord, join->leftRecordSize);
+			memcpy(join->output + join->leftRecordSize, entry->record, join->rightRecordSize);
+		}
+		
+		if (join->residual != NULL && matchPredicateRecord(join->residual, join->output) == 0)
+		{
+			continue;
+		}
+		
+		if (join->callback(join->context, join->output) == 0)
+		{
+			join->stopped = 1;
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int probeJoinCallback(void *context, char *recordData)
+{
+	HashJoin *join = (HashJoin *)context;
+	char key[join->probe.keyAttribute.size + 8];
+	int keyLength;
+	unsigned int hash = joinRecordHash(join, &join->probe, recordData, key, &keyLength);
+	
+	if (join->partitioned == 1)
+	{
+		fwrite(recordData, join->probe.recordSize, 1, join->probePartition[joinPartitionIndex(hash)]);
+		return 1;
+	}
+	
+	return emitJoinMatches(join, recordData, hash, key, keyLength);
+}
+
+int joinPartitionPass(HashJoin *join, int partition)
+{
+	char *record = malloc(join->build.recordSize > join->probe.recordSize ? join->build.recordSize : join->probe.recordSize);
+	char key[(join->build.keyAttribute.size > join->probe.keyAttribute.size ? join->build.keyAttribute.size : join->probe.keyAttribute.size) + 8];
+	int keyLength;
+	
+	initJoinHashTable(&join->table);
+	rewind(join->buildPartition[partition]);
+	while (fread(record, join->build.recordSize, 1, join->buildPartition[partition]) == 1)
+	{
+		unsigned int hash = joinRecordHash(join, &join->build, record, key, &keyLength);
+		insertJoinHashEntry(&join->table, record, join->build.recordSize, hash);
+	}
+	
+	rewind(join->probePartition[partition]);
+	while (
+		join->table.entryAmount > 0 && 
+		fread(record, join->probe.recordSize, 1, join->probePartition[partition]) == 1
+	)
+	{
+		unsigned int hash = joinRecordHash(join, &join->probe, record, key, &keyLength);
+		if (emitJoinMatches(join, record, hash, key, keyLength) == 0)
+		{
+			break;
+		}
+	}
+	
+	delJoinHashTable(&join->table);
+	free(record);
+	return join->stopped == 0;
+}
+
+off_t estimateTableBytes(char database[], char table[])
+{
+	char filePath[1024];
+	struct stat fileStat;
+	off_t tableBytes = 0;
+	
+	if (isColumnarTable(database, table))
+	{
+		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+		int totalAttribute = 0;
+		readTableAttribute(database, table, &totalAttribute, attribute, NULL);
+		for (int i = 0; i < totalAttribute; i++)
+		{
+			if (
+				columnarFilePath(filePath, sizeof(filePath), database, table, attribute[i].attributeName) == 1 && 
+				stat(filePath, &fileStat) == 0
+			)
+			{
+				tableBytes += fileStat.st_size;
+			}
+		}
+		return tableBytes;
+	}
+	
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	if (stat(filePath, &fileStat) == 0)
+	{
+		tableBytes = fileStat.st_size;
+	}
+	return tableBytes;
+}
+
+Predicate* extractConjuncts(
+	Predicate *where, int firstAttribute, int attributeAmount, int offsetShift, int inside
+)
+{
+	if (where == NULL)
+	{
+		return NULL;
+	}
+	
+	Predicate **conjunct = where->type == AND_PREDICATE ? where->child : &where;
+	int conjunctAmount = where->type == AND_PREDICATE ? where->childAmount : 1;
+	Predicate *extracted = newPredicate(AND_PREDICATE);
+	
+	for (int i = 0; i < conjunctAmount; i++)
+	{
+		if (isPredicateWithinAttributes(conjunct[i], firstAttribute, attributeAmount) == inside)
+		{
+			appendPredicateChild(extracted, clonePredicate(conjunct[i], inside == 1 ? firstAttribute : 0, offsetShift));
+		}
+	}
+	
+	if (extracted->childAmount == 0)
+	{
+		delPredicate(extracted);
+		return NULL;
+	}
+	optimizePredicate(extracted, NULL);
+	if (extracted->childAmount == 1)
+	{
+		Predicate *single = extracted->child[0];
+		extracted->childAmount = 0;
+		delPredicate(extracted);
+		return single;
+	}
+	return extracted;
+}
+
+void initJoinInput(
+	JoinInput *input, SelectQuery *query, char tableName[], int firstAttribute, int totalAttribute, 
+	int joinIndex, int neededColumn[]
+)
+{
+	memset(input, 0, sizeof(JoinInput));
+	strcpy(input->tableName, tableName);
+	input->keyAttribute = query->tableAttribute[joinIndex];
+	input->keyOffset = attributeDataOffset(query->tableAttribute, joinIndex) - attributeDataOffset(query->tableAttribute, firstAttribute);
+	
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		input->recordSize += query->tableAttribute[firstAttribute + i].size;
+		input->neededColumn[i] = neededColumn == NULL || neededColumn[firstAttribute + i] == 1;
+	}
+	input->neededColumn[joinIndex - firstAttribute] = 1;
+	
+	input->where = extractConjuncts(
+		query->where, firstAttribute, totalAttribute, attributeDataOffset(query->tableAttribute, firstAttribute), 1
+	);
+}
+
+int scanJoinInput(AccountData *clientAccount, JoinInput *input, RecordCallback callback, HashJoin *join)
+{
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute = 0;
+	int recordBlockSize = 0;
+	
+	return scanTableRecords(
+		clientAccount->databaseName, input->tableName, attribute, &totalAttribute, &recordBlockSize, 
+		input->where, input->neededColumn, 0, callback, join
+	) == 1 && recordBlockSize == input->recordSize;
+}
+
+int executeHashJoin(
+	AccountData *clientAccount, SelectQuery *query, int neededColumn[], RecordCallback callback, void *context
+)
+{
+	HashJoin join;
+	memset(&join, 0, sizeof(join));
+	join.joinId = hashJoinSequence++;
+	join.callback = callback;
+	join.context = context;
+	join.leftRecordSize = query->leftRecordSize;
+	join.rightRecordSize = query->recordBlockSize - query->leftRecordSize;
+	
+	Attribute *leftKey = &query->tableAttribute[query->leftJoinIndex];
+	Attribute *rightKey = &query->tableAttribute[query->rightJoinIndex];
+	if (isNumericAttribute(leftKey) != isNumericAttribute(rightKey))
+	{
+		return 0;
+	}
+	join.keyDecimal = leftKey->type == DECIMAL || rightKey->type == DECIMAL;
+	
+	JoinInput left, right;
+	initJoinInput(&left, query, query->tableName, 0, query->leftAttributeAmount, query->leftJoinIndex, neededColumn);
+	initJoinInput(
+		&right, query, query->joinTableName, query->leftAttributeAmount, 
+		query->totalAttribute - query->leftAttributeAmount, query->rightJoinIndex, neededColumn
+	);
+	
+	Predicate *rightResidual = extractConjuncts(query->where, 0, query->leftAttributeAmount, 0, 0);
+	join.residual = extractConjuncts(
+		rightResidual, query->leftAttributeAmount, query->totalAttribute - query->leftAttributeAmount, 0, 0
+	);
+	delPredicate(rightResidual);
+	
+	join.buildIsLeft = 
+		estimateTableBytes(clientAccount->databaseName, query->tableName) <= 
+		estimateTableBytes(clientAccount->databaseName, query->joinTableName);
+	join.build = join.buildIsLeft == 1 ? left : right;
+	join.probe = join.buildIsLeft == 1 ? right : left;
+	
+	join.output = malloc(query->recordBlockSize);
+	initJoinHashTable(&join.table);
+	
+	int returnValue = 
+		scanJoinInput(clientAccount, &join.build, buildJoinCallback, &join) == 1 && join.failed == 0 && 
+		scanJoinInput(clientAccount, &join.probe, probeJoinCallback, &join) == 1;
+	
+	if (join.partitioned == 1)
+	{
+		for (int i = 0; i < __JOIN_PARTITIONS && returnValue == 1 && join.stopped == 0; i++)
+		{
+			joinPartitionPass(&join, i);
+		}
+		closeJoinPartitions(&join);
+	}
+	else
+	{
+		delJoinHashTable(&join.table);
+	}
+	
+	delPredicate(left.where);
+	delPredicate(right.where);
+	delPredicate(join.residual);
+	free(join.output);
+	return returnValue;
+}
+
+int scanQuerySource(
+	AccountData *clientAccount, SelectQuery *query, int neededColumn[], int ordered, RecordCallback callback, 
+	void *context
+)
+{
+	if (query->joined == 1)
+	{
+		return executeHashJoin(clientAccount, query, neededColumn, callback, context);
+	}
+	
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute = 0;
+	int recordBlockSize = 0;
+	
+	return scanTableRecords(
+		clientAccount->databaseName, query->tableName, attribute, &totalAttribute, &recordBlockSize, 
+		query->where, neededColumn, ordered, callback, context
+	);
+}
+
+int countFromTableStats(AccountData *clientAccount, SelectQuery *query, RecordBlockVector *records)
+{
+	if (query->joined == 1 || query->where != NULL || query->groupByAmount > 0)
+	{
+		return 0;
+	}
+	for (int i = 0; i < query->itemAmount; i++)
+	{
+		if (query->item[i].function != COUNT_AGGREGATE || query->item[i].attributeIndex != -1)
+		{
+			return 0;
+		}
+	}
+	
+	beginQueryOperator("count");
+	TableStats *stats = ensureTableStats(clientAccount->databaseName, query->tableName);
+	if (stats == NULL)
+	{
+		endQueryOperator();
+		return 0;
+	}
+	
+	char detail[128];
+	snprintf(detail, sizeof(detail), "row count of %s from table statistics", query->tableName);
+	setQueryOperatorDetail(detail);
+	
+	RecordBlock result;
+	initRecordBlock(&result, sizeof(long long int) * query->itemAmount);
+	for (int i = 0; i < query->itemAmount; i++)
+	{
+		memcpy((char *)result.data + sizeof(long long int) * i, &stats->rowAmount, sizeof(long long int));
+	}
+	appendRecordBlockVector(records, &result);
+	free(stats);
+	endQueryOperator();
+	return 1;
+}
+
+int executeAggregateQuery(AccountData *clientAccount, SelectQuery *query, RecordBlockVector *records)
+{
+	if (countFromTableStats(clientAccount, query, records) == 1)
+	{
+		return 1;
+	}
+	
+	AggregateContext aggregate;
+	memset(&aggregate, 0, sizeof(aggregate));
+	aggregate.query = query;
+	
+	int neededColumn[__MAX_ATTRIBUTE_ON_TABLE];
+	memset(neededColumn, 0, sizeof(neededColumn));
+	
+	int offset = 0;
+	for (int i = 0; i < query->totalAttribute; i++)
+	{
+		aggregate.attributeOffset[i] = offset;
+		offset += query->tableAttribute[i].size;
+	}
+	
+	int keySize = 0;
+	for (int i = 0; i < query->groupByAmount; i++)
+	{
+		aggregate.keyOffset[i] = keySize;
+		keySize += query->tableAttribute[query->groupBy[i]].size;
+		neededColumn[query->groupBy[i]] = 1;
+	}
+	
+	int groupSize = keySize;
+	int resultSize = 0;
+	for (int i = 0; i < query->itemAmount; i++)
+	{
+		aggregate.stateOffset[i] = groupSize;
+		groupSize += sizeof(AggregateState);
+		if (query->item[i].attributeIndex != -1)
+		{
+			groupSize += query->tableAttribute[query->item[i].attributeIndex].size;
+			neededColumn[query->item[i].attributeIndex] = 1;
+		}
+		resultSize += query->item[i].resultAttribute.size;
+	}
+	
+	initAggregateHashTable(&aggregate.table, keySize, groupSize);
+	aggregate.key = calloc(1, keySize > 0 ? keySize : 1);
+	if (query->groupByAmount == 0)
+	{
+		findAggregateGroup(&aggregate.table, aggregate.key);
+	}
+	
+	int returnValue = scanQuerySource(clientAccount, query, neededColumn, 0, aggregateRecordCallback, &aggregate);
+	
+	for (int i = 0; i < aggregate.table.capacity && returnValue == 1; i++)
+	{
+		if (aggregate.table.group[i] != NULL)
+		{
+			RecordBlock result;
+			initRecordBlock(&result, resultSize);
+			buildAggregateResultRecord(&aggregate, aggregate.table.group[i], &result);
+			appendRecordBlockVector(records, &result);
+		}
+	}
+	
+	free(aggregate.key);
+	delAggregateHashTable(&aggregate.table);
+	
+	return returnValue;
+}
+
+int qualifyAttributeName(Attribute *attribute, char tableName[])
+{
+	char qualifiedName[__MAX_ATTRIBUTE_NAME_LENGTH * 2 + 2];
+	int length = snprintf(qualifiedName, sizeof(qualifiedName), "%s.%s", tableName, attribute->attributeName);
+	if (length < 0 || (size_t)length >= sizeof(attribute->attributeName))
+	{
+		return 0;
+	}
+	memset(attribute->attributeName, 0, sizeof(attribute->attributeName));
+	memcpy(attribute->attributeName, qualifiedName, length);
+	return 1;
+}
+
+int parseJoinClause(ParsedStringQueue **queue, AccountData *clientAccount, SelectQuery *query)
+{
+	if (*queue != NULL && strcasecmp((*queue)->parsedString, "INNER") == 0)
+	{
+		popParsedStringQueue(queue);
+		if (*queue == NULL || strcasecmp((*queue)->parsedString, "JOIN") != 0)
+		{
+			return 0;
+		}
+	}
+	
+	if (*queue == NULL || strcasecmp((*queue)->parsedString, "JOIN") != 0)
+	{
+		return 1;
+	}
+	popParsedStringQueue(queue);
+	
+	if (*queue == NULL)
+	{
+		return 0;
+	}
+	strncpy(query->joinTableName, (*queue)->parsedString, sizeof(query->joinTableName) - 1);
+	convertToLower(query->joinTableName, strlen(query->joinTableName));
+	popParsedStringQueue(queue);
+	
+	Attribute rightAttribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int rightTotalAttribute = 0;
+	int rightRecordSize = 0;
+	
+	if (
+		strcmp(query->joinTableName, query->tableName) == 0 || 
+		readTableAttribute(
+			clientAccount->databaseName, query->joinTableName, &rightTotalAttribute, rightAttribute, &rightRecordSize
+		) == 0 ||
+		query->totalAttribute + rightTotalAttribute > __MAX_ATTRIBUTE_ON_TABLE
+	)
+	{
+		return 0;
+	}
+	
+	query->leftAttributeAmount = query->totalAttribute;
+	query->leftRecordSize = query->recordBlockSize;
+	for (int i = 0; i < query->leftAttributeAmount; i++)
+	{
+		if (qualifyAttributeName(&query->tableAttribute[i], query->tableName) == 0)
+		{
+			return 0;
+		}
+	}
+	for (int i = 0; i < rightTotalAttribute; i++)
+	{
+		query->tableAttribute[query->totalAttribute] = rightAttribute[i];
+		if (qualifyAttributeName(&query->tableAttribute[query->totalAttribute], query->joinTableName) == 0)
+		{
+			return 0;
+		}
+		query->totalAttribute += 1;
+	}
+	query->recordBlockSize += rightRecordSize;
+	
+	if (*queue == NULL || strcasecmp((*queue)->parsedString, "ON") != 0)
+	{
+		return 0;
+	}
+	popParsedStringQueue(queue);
+	
+	char condition[256] = "";
+	while (*queue != NULL && isSelectClauseKeyword((*queue)->parsedString) == 0)
+	{
+		if (strlen(condition) + strlen((*queue)->parsedString) >= sizeof(condition))
+		{
+			return 0;
+		}
+		strcat(condition, (*queue)->parsedString);
+		popParsedStringQueue(queue);
+	}
+	convertToLower(condition, strlen(condition));
+	
+	char *rightName = strchr(condition, '=');
+	if (rightName == NULL)
+	{
+		return 0;
+	}
+	*rightName = '\0';
+	rightName += 1;
+	
+	query->leftJoinIndex = findTableAttributeIndex(query->tableAttribute, query->totalAttribute, condition);
+	query->rightJoinIndex = findTableAttributeIndex(query->tableAttribute, query->totalAttribute, rightName);
+	
+	if (query->leftJoinIndex >= query->leftAttributeAmount && query->rightJoinIndex < query->leftAttributeAmount)
+	{
+		int swap = query->leftJoinIndex;
+		query->leftJoinIndex = query->rightJoinIndex;
+		query->rightJoinIndex = swap;
+	}
+	
+	if (
+		query->leftJoinIndex < 0 || query->leftJoinIndex >= query->leftAttributeAmount || 
+		query->rightJoinIndex < query->leftAttributeAmount
+	)
+	{
+		return 0;
+	}
+	
+	query->joined = 1;
+	return 1;
+}
+
+int parseSelectClauses(ParsedStringQueue **queue, SelectQuery *query, char database[])
+{
+	while (*queue != NULL)
+	{
+		if (strcasecmp((*queue)->parsedString, "WHERE") == 0 && query->where == NULL)
+		{
+			popParsedStringQueue(queue);
+			
+			TableStats *stats = query->joined == 0 ? loadTableStats(database, query->tableName) : NULL;
+			query->where = parseWherePredicate(queue, query->tableAttribute, query->totalAttribute, stats);
+			free(stats);
+			if (query->where == NULL)
+			{
+				return 0;
+			}
+		}
+		else if (strcasecmp((*queue)->parsedString, "GROUP") == 0 && query->groupByAmount == 0)
+		{
+			popParsedStringQueue(queue);
+			
+			if (*queue == NULL || strcasecmp((*queue)->parsedString, "BY") != 0)
+			{
+				return 0;
+			}
+			popParsedStringQueue(queue);
+			
+			while (*queue != NULL && isSelectClauseKeyword((*queue)->parsedString) == 0)
+			{
+				int index = findTableAttributeIndex(query->tableAttribute, query->totalAttribute, (*queue)->parsedString);
+				if (index == -1)
+				{
+					return 0;
+				}
+				query->groupBy[query->groupByAmount++] = index;
+				popParsedStringQueue(queue);
+			}
+			
+			if (query->groupByAmount == 0)
+			{
+				return 0;
+			}
+			query->aggregated = 1;
+		}
+		else if (strcasecmp((*queue)->parsedString, "ORDER") == 0 && query->orderByName[0] == '\0')
+		{
+			popParsedStringQueue(queue);
+			
+			if (*queue == NULL || strcasecmp((*queue)->parsedString, "BY") != 0)
+			{
+				return 0;
+			}
+			popParsedStringQueue(queue);
+			
+			if (*queue == NULL)
+			{
+				return 0;
+			}
+			strncpy(query->orderByName, (*queue)->parsedString, sizeof(query->orderByName) - 1);
+			convertToLower(query->orderByName, strlen(query->orderByName));
+			popParsedStringQueue(queue);
+			
+			if (*queue != NULL && strcasecmp((*queue)->parsedString, "DESC") == 0)
+			{
+				query->orderByDescending = 1;
+				popParsedStringQueue(queue);
+			}
+			else if (*queue != NULL && strcasecmp((*queue)->parsedString, "ASC") == 0)
+			{
+				popParsedStringQueue(queue);
+			}
+		}
+		else if (strcasecmp((*queue)->parsedString, "LIMIT") == 0 && query->limit == -1)
+		{
+			popParsedStringQueue(queue);
+			
+			if (*queue == NULL || sscanf((*queue)->parsedString, "%lld", &query->limit) != 1 || query->limit < 0)
+			{
+				return 0;
+			}
+			popParsedStringQueue(queue);
+		}
+		else if (strcasecmp((*queue)->parsedString, "OFFSET") == 0 && query->offset == 0)
+		{
+			popParsedStringQueue(queue);
+			
+			if (*queue == NULL || sscanf((*queue)->parsedString, "%lld", &query->offset) != 1 || query->offset < 0)
+			{
+				return 0;
+			}
+			popParsedStringQueue(queue);
+		}
+		else
+		{
+			return 0;
+		}
+	}
+	
+	return 1;
+}
+
+int resolveAggregateItems(SelectQuery *query, char selectedAttributeName[][64])
+{
+	for (int i = 0; i < query->itemAmount; i++)
+	{
+		if (parseSelectItem(selectedAttributeName[i], query, &query->item[i]) == 0)
+		{
+			return 0;
+		}
+		if (query->item[i].function != NO_AGGREGATE)
+		{
+			query->aggregated = 1;
+		}
+	}
+	
+	for (int i = 0; i < query->itemAmount && query->aggregated == 1; i++)
+	{
+		if (query->item[i].function == NO_AGGREGATE)
+		{
+			int grouped = 0;
+			for (int j = 0; j < query->groupByAmount; j++)
+			{
+				if (query->groupBy[j] == query->item[i].attributeIndex)
+				{
+					grouped = 1;
+				}
+			}
+			if (grouped == 0)
+			{
+				return 0;
+			}
+		}
+	}
+	
+	return 1;
+}
+
+int resolveSelectedAttribute(
+	char selectedAttributeName[][64], int *amountOfSelectedAttribute, Attribute tableAttribute[], 
+	int totalAttribute, int selectedAttribute[]
+)
+{
+	int attributeFound = 0;
+	for (int i = 0; i < *amountOfSelectedAttribute; i++)
+	{
+		if (strcmp(selectedAttributeName[i], "*") == 0)
+		{
+			for (int j = 0; j < totalAttribute; j++)
+			{
+				selectedAttribute[j] = j;
+			}
+			*amountOfSelectedAttribute = totalAttribute;
+			attributeFound = totalAttribute;
+			break;
+		}
+		selectedAttribute[i] = findTableAttributeIndex(tableAttribute, totalAttribute, selectedAttributeName[i]);
+		if (selectedAttribute[i] != -1)
+		{
+			attributeFound += 1;
+		}
+	}
+	
+	return attributeFound == *amountOfSelectedAttribute;
+}
+
+int selectFromTableScript(
+	ParsedStringQueue **queue, AccountData *clientAccount, int fileDescriptor, char message[], ResultCapture *capture
+)
+{
+	if (clientAccount->openningDatabase == 1)
+	{
+		char selectedAttributeName[__MAX_ATTRIBUTE_ON_TABLE][64];
+		int amountOfSelectedAttribute = 0;
+		int fromKeywordFound = 0;
+		
+		while(fromKeywordFound == 0 && *queue != NULL)
+		{
+			if (strcasecmp((*queue)->parsedString, "FROM") == 0)
+			{
+				fromKeywordFound = 1;
+			}
+			else if (amountOfSelectedAttribute < __MAX_ATTRIBUTE_ON_TABLE)
+			{
+				memset(selectedAttributeName[amountOfSelectedAttribute], 0, 64);
+				strncpy(selectedAttributeName[amountOfSelectedAttribute], (*queue)->parsedString, 63);
+				convertToLower(
+					selectedAttributeName[amountOfSelectedAttribute], 
+					strlen(selectedAttributeName[amountOfSelectedAttribute])
+				);
+				amountOfSelectedAttribute += 1;
+			}
+			popParsedStringQueue(queue);
+		}
+		
+		if (fromKeywordFound == 0 || *queue == NULL)
+		{
+			return 0;
+		}
+		
+		SelectQuery query;
+		memset(&query, 0, sizeof(query));
+		strncpy(query.tableName, (*queue)->parsedString, sizeof(query.tableName) - 1);
+		convertToLower(query.tableName, strlen(query.tableName));
+		query.itemAmount = amountOfSelectedAttribute;
+		query.limit = -1;
+		
+		popParsedStringQueue(queue);
+		
+		Attribute resultAttribute[__MAX_ATTRIBUTE_ON_TABLE];
+		int totalResultAttribute = 0;
+		int selectedAttribute[__MAX_ATTRIBUTE_ON_TABLE];
+		int resultRecordSize = 0;
+		int orderByIndex = -1;
+		int returnValue = 0;
+		long long int keepLimit = -1;
+		
+		RecordBlockVector records;
+		initRecordBlockVector(&records);
+		RecordSorter sorter;
+		int sorting = 0;
+		
+		if (
+			readTableAttribute(
+				clientAccount->databaseName, query.tableName, &query.totalAttribute, 
+				query.tableAttribute, &query.recordBlockSize
+			) == 1 &&
+			parseJoinClause(queue, clientAccount, &query) == 1 &&
+			parseSelectClauses(queue, &query, clientAccount->databaseName) == 1
+		)
+		{
+			if (query.limit >= 0)
+			{
+				keepLimit = query.offset + query.limit;
+			}
+			
+			int selectAll = 0;
+			for (int i = 0; i < query.itemAmount; i++)
+			{
+				if (strcmp(selectedAttributeName[i], "*") == 0)
+				{
+					selectAll = 1;
+				}
+			}
+			
+			if (selectAll == 0 && resolveAggregateItems(&query, selectedAttributeName) == 1 && query.aggregated == 1)
+			{
+				for (int i = 0; i < query.itemAmount; i++)
+				{
+					resultAttribute[i] = query.item[i].resultAttribute;
+					selectedAttribute[i] = i;
+					resultRecordSize += resultAttribute[i].size;
+				}
+				totalResultAttribute = query.itemAmount;
+				amountOfSelectedAttribute = query.itemAmount;
+				
+				orderByIndex = findTableAttributeIndex(resultAttribute, totalResultAttribute, query.orderByName);
+				if (query.orderByName[0] == '\0' || orderByIndex != -1)
+				{
+					returnValue = executeAggregateQuery(clientAccount, &query, &records);
+				}
+			}
+			else if (
+				query.aggregated == 0 && 
+				resolveSelectedAttribute(
+					selectedAttributeName, &amountOfSelectedAttribute, query.tableAttribute, 
+					query.totalAttribute, selectedAttribute
+				) == 1
+			)
+			{
+				memcpy(resultAttribute, query.tableAttribute, sizeof(Attribute) * query.totalAttribute);
+				totalResultAttribute = query.totalAttribute;
+				resultRecordSize = query.recordBlockSize;
+				
+				int neededColumn[__MAX_ATTRIBUTE_ON_TABLE];
+				memset(neededColumn, 0, sizeof(neededColumn));
+				for (int i = 0; i < amountOfSelectedAttribute; i++)
+				{
+					neededColumn[selectedAttribute[i]] = 1;
+				}
+				
+				orderByIndex = findTableAttributeIndex(resultAttribute, totalResultAttribute, query.orderByName);
+				if (orderByIndex != -1)
+				{
+					neededColumn[orderByIndex] = 1;
+					
+					initRecordSorter(
+						&sorter, resultRecordSize, &resultAttribute[orderByIndex], 
+						attributeDataOffset(resultAttribute, orderByIndex), query.orderByDescending, keepLimit
+					);
+					sorting = 1;
+					
+					returnValue = scanQuerySource(clientAccount, &query, neededColumn, 0, sortRecordCallback, &sorter);
+				}
+				else if (query.orderByName[0] == '\0')
+				{
+					RecordCollector collector = {&records, &resultRecordSize};
+					RecordLimiter limiter;
+					initRecordLimiter(&limiter, collectRecordCallback, &collector, 0, keepLimit);
+					
+					returnValue = scanQuerySource(clientAccount, &query, neededColumn, 1, limitRecordCallback, &limiter);
+				}
+			}
+		}
+		
+		if (returnValue == 1 && orderByIndex != -1)
+		{
+			if (sorting == 0)
+			{
+				initRecordSorter(
+					&sorter, resultRecordSize, &resultAttribute[orderByIndex], 
+					attributeDataOffset(resultAttribute, orderByIndex), query.orderByDescending, keepLimit
+				);
+				sorting = 1;
+				
+				for (int i = 0; i < records.size; i++)
+				{
+					sortRecordCallback(&sorter, records.record[i].data);
+				}
+			}
+			returnValue = prepareSortedRecords(&sorter);
+		}
+		
+		if (returnValue == 1)
+		{
+			beginQueryOperator("send");
+			
+			ResultWriter writer;
+			initResultWriter(
+				&writer, fileDescriptor, message, resultAttribute, totalResultAttribute, 
+				selectedAttribute, amountOfSelectedAttribute
+			);
+			if (capture != NULL)
+			{
+				writer.capture = capture;
+				memset(message, 0, __DATA_BUFFER);
+				
+				strcpy(capture->tableName[capture->tableAmount++], query.tableName);
+				if (query.joined == 1)
+				{
+					strcpy(capture->tableName[capture->tableAmount++], query.joinTableName);
+				}
+			}
+			RecordLimiter limiter;
+			initRecordLimiter(&limiter, writeResultRecord, &writer, query.offset, query.limit);
+			
+			if (orderByIndex != -1)
+			{
+				writeResultHeader(&writer, limitedRecordAmount(sorter.recordAmount, query.offset, query.limit));
+				returnValue = emitSortedRecords(&sorter, limitRecordCallback, &limiter);
+			}
+			else
+			{
+				writeResultHeader(&writer, limitedRecordAmount(records.size, query.offset, query.limit));
+				for (int i = 0; i < records.size; i++)
+				{
+					if (limitRecordCallback(&limiter, records.record[i].data) == 0)
+					{
+						break;
+					}
+				}
+			}
+			
+			QueryOperator *operator = currentQueryOperator();
+			if (operator != NULL)
+			{
+				operator->rowsIn = orderByIndex != -1 ? sorter.recordAmount : records.size;
+				operator->rowsOut = writer.rowsSent;
+				snprintf(
+					operator->detail, sizeof(operator->detail), "%s%s", 
+					orderByIndex != -1 ? "sort by " : "", orderByIndex != -1 ? resultAttribute[orderByIndex].attributeName : ""
+				);
+			}
+			endQueryOperator();
+		}
+		
+		if (sorting == 1)
+		{
+			delRecordSorter(&sorter);
+		}
+		delRecordBlockVector(&records);
+		delPredicate(query.where);
+		
+		return returnValue;
+	}
+	return 0;
+}
+
+
 void readTableDataBlock(char database[], char table[], int tableData[])
 {	
 	char filePath[1024];
-	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r");
+	
+	if (tableFile == NULL)
+	{
+		return;
+	}
+	
+	freadTableHeader(tableData, tableFile);
+	fclose(tableFile);
+}
+
+int createNewAccount(ParsedStringQueue **queue)
+{
+	char username[64];
+	memset(username, 0, sizeof(username));
+	strcpy(username, (*queue)->parsedString);
+	
+	RecordBlockVector recordBlockVector;
+	initRecordBlockVector(&recordBlockVector);
+	
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int attributeTotal = 0;
+	int recordBlockSize = 0;
+	
+	char usernameString[64];
+	memset(usernameString, 0, 64);
+	strcpy(usernameString, "username");
+	
+	selectReadTable("admin", "account", &recordBlockVector, attribute, &attributeTotal, &recordBlockSize, usernameString, username);
+	
+	if (recordBlockVector.size != 0)
+	{
+		delRecordBlockVector(&recordBlockVector);
+		return 0;
+	}
+	delRecordBlockVector(&recordBlockVector);
+	
+	popParsedStringQueue(queue);
+	
+	if (*queue == NULL || strcasecmp((*queue)->parsedString, "IDENTIFIED" ) != 0)
+	{
+		return 0;
+	}
+	
+	popParsedStringQueue(queue);
+	
+	if (*queue == NULL || strcasecmp((*queue)->parsedString, "BY" ) != 0)
+	{
+		return 0;
+	}
+	
+	popParsedStringQueue(queue);
+	
+	if (*queue == NULL)
+	{
+		return 0;
+	}
+	
+	char password[64];
+	memset(password, 0, sizeof(password));
+	strcpy(password, (*queue)->parsedString);
+	
+	RecordBlock recordBlockNewAccount;
+	initRecordBlock(&recordBlockNewAccount, recordBlockSize);
+	
+	int tableData[3];
+	readTableDataBlock("admin", "account", tableData);
+	tableData[1] += 1;
+	
+	memcpy(recordBlockNewAccount.data, &tableData[1], sizeof(int));
+	memcpy(recordBlockNewAccount.data + sizeof(int), username, sizeof(username)); 
+	memcpy(recordBlockNewAccount.data + sizeof(int) + sizeof(username), password, sizeof(password));
+	
+	insertIntoDatabaseTable("admin", "account", &recordBlockNewAccount);
+	
+	delRecordBlock(&recordBlockNewAccount);
+	return 1;
+}
+
+int createDatabaseScript(ParsedStringQueue **queue, int userID)
+{
+	if (*queue != NULL)
+	{
+		char databaseName[64];
+		memset(databaseName, 0, sizeof(databaseName));
+		strcpy(databaseName, (*queue)->parsedString);
+		convertToLower(databaseName, strlen(databaseName));
+		
+		if (isStringAlphaNumeric(databaseName) == 1)
+		{
+			RecordBlockVector recordBlockVector;
+			initRecordBlockVector(&recordBlockVector);
+			Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+			int attributeTotal = 0;
+			int recordBlockSize = 0;
+			
+			selectReadTable(
+				"admin", "database", &recordBlockVector, attribute, 
+				&attributeTotal, &recordBlockSize, "name", databaseName
+			);
+			
+			if (recordBlockVector.size == 0)
+			{
+				int tableData[3];
+				readTableDataBlock("admin", "database", tableData);
+				int databaseID = tableData[1] + 1;
+				
+				RecordBlock recordBlockForNewDatabase;
+				initRecordBlock(&recordBlockForNewDatabase, recordBlockSize);
+				memcpy(recordBlockForNewDatabase.data, &databaseID, sizeof(int));
+				memcpy(recordBlockForNewDatabase.data + sizeof(int), databaseName, sizeof(databaseName));
+				insertIntoDatabaseTable("admin", "database", &recordBlockForNewDatabase);
+				
+				delRecordBlock(&recordBlockForNewDatabase);
+				
+				readTableDataBlock("admin", "database_permission", tableData);
+				initRecordBlock(&recordBlockForNewDatabase, tableData[2]);
+				memcpy(recordBlockForNewDatabase.data, &userID, sizeof(userID));
+				memcpy(recordBlockForNewDatabase.data + sizeof(userID), &databaseID, sizeof(databaseID));
+				insertIntoDatabaseTable("admin", "database_permission", &recordBlockForNewDatabase);
+				
+				createDatabase(databaseName);
+				
+				delRecordBlock(&recordBlockForNewDatabase);
+				return 1;
+			}
+			
+			delRecordBlockVector(&recordBlockVector);		
+		}
+	}
+	
+	return 0;
+}
+
+int grantPermissionUserOnDatabase(ParsedStringQueue **queue)
+{
+	if (*queue == NULL)
+	{
+		return 0;
+	}
+	
+	char databaseName[64];
+	memset(databaseName, 0, sizeof(databaseName));
+	strcpy(databaseName, (*queue)->parsedString);
+	convertToLower(databaseName, strlen(databaseName));
+	
+	RecordBlockVector recordBlockVector;
+	initRecordBlockVector(&recordBlockVector);
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int attributeTotal = 0;
+	int recordBlockSize = 0;
+		
+	selectReadTable("admin", "database", &recordBlockVector, attribute, &attributeTotal, &recordBlockSize, "name", databaseName);
+	
+	popParsedStringQueue(queue);
+	if (*queue == NULL || strcasecmp((*queue)->parsedString, "INTO") != 0 || recordBlockVector.size != 1)
+	{
+		return 0;
+	}
+	popParsedStringQueue(queue);
+	
+	int databaseID = -1;
+	memcpy(&databaseID, recordBlockVector.record[0].data, sizeof(databaseID));
+	delRecordBlockVector(&recordBlockVector);
+	
+	if (*queue == NULL)
+	{
+		return 0;
+	}
+	
+	char username[64];
+	memset(username, 0, sizeof(username));
+	strcpy(username, (*queue)->parsedString);
+	
+	initRecordBlockVector(&recordBlockVector);
+	attributeTotal = 0;
+	recordBlockSize = 0;
+	selectReadTable("admin", "account", &recordBlockVector, attribute, &attributeTotal, &recordBlockSize, "username", username);
+	
+	if (recordBlockVector.size == 1)
+	{
+		int accountID = 0;
+		memcpy(&accountID, recordBlockVector.record[0].data, sizeof(accountID));
+		
+		RecordBlock newRecordPermission;
+		int recordData[2] = {accountID, databaseID};
+		initRecordBlock(&newRecordPermission, sizeof(recordData));
+		memcpy(newRecordPermission.data, recordData, sizeof(recordData));
+		
+		insertIntoDatabaseTable("admin", "database_permission", &newRecordPermission);
+		
+		delRecordBlock(&newRecordPermission);
+	}
+	else
+	{
+		delRecordBlockVector(&recordBlockVector);
+		return 0;
+	}
+	
+	delRecordBlockVector(&recordBlockVector);
+	
+	return 1;
+}
+
+int useDatabaseScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	clientAccount->openningDatabase = 0;
+
+	if (*queue != NULL) 
+	{
+		char databaseName[64];
+		memset(databaseName, 0, sizeof(databaseName));
+		strcpy(databaseName, (*queue)->parsedString);
+		convertToLower(databaseName, strlen(databaseName));
+		
+		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+		RecordBlockVector recordBlockVector;
+		initRecordBlockVector(&recordBlockVector);
+		int attributeTotal = 0;
+		int recordBlockSize = 0;
+		selectReadTable("admin", "database", &recordBlockVector, attribute, &attributeTotal, &recordBlockSize, "name", databaseName);
+
+		if (recordBlockVector.size == 1)
+		{
+			if (clientAccount->id == 0)
+			{
+				clientAccount->openningDatabase = 1;
+				memcpy(clientAccount->databaseName, databaseName, sizeof(databaseName));
+			}
+			else
+			{
+				int databaseID = 0;
+				memcpy(&databaseID, recordBlockVector.record[0].data, sizeof(databaseID));
+				delRecordBlockVector(&recordBlockVector);
+				
+				initRecordBlockVector(&recordBlockVector);
+				attributeTotal = 0;
+				recordBlockSize = 0;
+				selectReadTable(
+					"admin", "database_permission", &recordBlockVector, 
+					attribute, &attributeTotal, &recordBlockSize, "accountid", &clientAccount->id
+				);
+				
+				int pointerOffsetForDatabaseID = 0;
+				for (int i = 0; i < attributeTotal; i++)
+				{
+					if (strcmp(attribute[i].attributeName, "databaseid") == 0)
+					{
+						break;
+					}
+					pointerOffsetForDatabaseID += attribute[i].size;
+				}
+				for (int i = 0; i < recordBlockVector.size; i++)
+				{
+					if (memcmp(recordBlockVector.record[i].data + pointerOffsetForDatabaseID, &databaseID, attribute[1].size) == 0)
+					{
+						clientAccount->openningDatabase = 1;
+						memcpy(clientAccount->databaseName, databaseName, sizeof(databaseName));
+						break;
+					}
+				}
+			}
+		}
+
+		delRecordBlockVector(&recordBlockVector);
+	}
+	
+	if (clientAccount->openningDatabase == 1)
+	{
+		return 1;
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+int parseTableOptions(ParsedStringQueue **queue, TableOptions *options)
+{
+	memset(options, 0, sizeof(TableOptions));
+	options->storage = ROW_STORAGE;
+	
+	if (*queue == NULL)
+	{
+		return 1;
+	}
+	if (strcasecmp((*queue)->parsedString, "WITH") != 0)
+	{
+		return 0;
+	}
+	popParsedStringQueue(queue);
+	
+	int parsedOption = 0;
+	while (*queue != NULL)
+	{
+		char *savePointer = NULL;
+		char *option = strtok_r((*queue)->parsedString, " ,", &savePointer);
+		while (option != NULL)
+		{
+			char *value = strchr(option, '=');
+			if (value == NULL)
+			{
+				return 0;
+			}
+			*value = '\0';
+			value++;
+			
+			if (strcasecmp(option, "storage") == 0 && strcasecmp(value, "columnar") == 0)
+			{
+				options->storage = COLUMNAR_STORAGE;
+			}
+			else if (strcasecmp(option, "storage") == 0 && strcasecmp(value, "row") == 0)
+			{
+				options->storage = ROW_STORAGE;
+			}
+			else if (strcasecmp(option, "compression") == 0 && strcasecmp(value, "page") == 0)
+			{
+				options->compressed = 1;
+			}
+			else if (strcasecmp(option, "compression") == 0 && strcasecmp(value, "none") == 0)
+			{
+				options->compressed = 0;
+			}
+			else
+			{
+				return 0;
+			}
+			parsedOption++;
+			option = strtok_r(NULL, " ,", &savePointer);
+		}
+		popParsedStringQueue(queue);
+	}
+	
+	return parsedOption > 0;
+}
+
+int createTableScript(ParsedStringQueue **queue, AccountData *clientAccountData)
+{
+	if (*queue == NULL || clientAccountData->openningDatabase != 1)
+	{
+		return 0;
+	}
+	char tableName[64];
+	strcpy(tableName, (*queue)->parsedString);
+	convertToLower(tableName, strlen(tableName));
+	
+	if (isStringAlphaNumeric(tableName) == 1)
+	{
+		popParsedStringQueue(queue);
+		
+		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+		int attributeAmount = 0;
+		if (*queue != NULL && parseAttribute(attribute, &attributeAmount, (*queue)->parsedString) == 1)
+		{
+			popParsedStringQueue(queue);
+			
+			TableOptions options;
+			if (parseTableOptions(queue, &options) == 0 || (options.compressed == 1 && options.storage == COLUMNAR_STORAGE))
+			{
+				return 0;
+			}
+			
+			int created;
+			if (options.storage == COLUMNAR_STORAGE)
+			{
+				created = createColumnarTable(clientAccountData->databaseName, tableName, attributeAmount, attribute);
+			}
+			else
+			{
+				created = createTable(clientAccountData->databaseName, tableName, attributeAmount, attribute);
+			}
+			
+			if (created == 1)
+			{
+				resetTableStats(clientAccountData->databaseName, tableName);
+				buildTableZoneMap(clientAccountData->databaseName, tableName);
+				if (options.compressed == 1)
+				{
+					buildTableCompressedPages(clientAccountData->databaseName, tableName);
+				}
+				bumpTableVersion(clientAccountData->databaseName, tableName);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+int deleteFromColumnarTable(char database[], char table[], Predicate *where)
+{
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute = 0;
+	int recordBlockSize = 0;
+	char filePath[1024];
+	
+	if (readTableAttribute(database, table, &totalAttribute, attribute, &recordBlockSize) == 0)
+	{
+		return -1;
+	}
+	
+	int neededColumn[totalAttribute];
+	memset(neededColumn, 0, sizeof(neededColumn));
+	
+	if (where == NULL)
+	{
+		FILE *columnFile[totalAttribute + 1];
+		int openedAmount = 0;
+		for (; openedAmount <= totalAttribute; openedAmount++)
+		{
+			int pathResult = columnarFilePath(
+				filePath, sizeof(filePath), database, table, 
+				openedAmount < totalAttribute ? attribute[openedAmount].attributeName : NULL
+			);
+			columnFile[openedAmount] = pathResult == 1 ? fopen(filePath, "a") : NULL;
+			if (columnFile[openedAmount] == NULL)
+			{
+				break;
+			}
+		}
+		
+		int deleted = -1;
+		if (openedAmount > totalAttribute)
+		{
+			deleted = scanColumnarTable(
+				database, table, attribute, totalAttribute, recordBlockSize, 
+				neededColumn, NULL, 0, NULL, NULL
+			);
+		}
+		for (int i = 0; i < openedAmount; i++)
+		{
+			if (deleted >= 0 && ftruncate(fileno(columnFile[i]), 0) != 0)
+			{
+				deleted = -1;
+			}
+			fclose(columnFile[i]);
+		}
+		return deleted;
+	}
+	
+	return scanColumnarTable(
+		database, table, attribute, totalAttribute, recordBlockSize, 
+		neededColumn, where, 1, NULL, NULL
+	);
+}
+
+int deleteFromRowTable(char database[], char table[], Predicate *where)
+{	
+	waitAsyncWrites();
+	
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r+");
+	
+	if (tableFile == NULL)
+	{
+		return -1;
+	}
+	
+	int tableData[3];
+	freadTableHeader(tableData, tableFile);
+	
+	AttributeBlock attributesBlock[tableData[0]];
+	fread(attributesBlock, sizeof(attributesBlock[0]), tableData[0], tableFile);
+	
+	int deleted = 0;
+	char detail[128];
+	
+	if (where == NULL && transactionManager.writeDepth <= 1 && oldestActiveSnapshot() == transactionManager.lastCommitted)
+	{
+		fclose(tableFile);
+		snprintf(detail, sizeof(detail), "truncate %s", table);
+		setQueryOperatorDetail(detail);
+		if (isQueryPlanOnly() == 1)
+		{
+			return 0;
+		}
+		
+		tableFile = fopen(filePath, "w");
+		
+		fwriteTableHeader(tableData, tableFile);
+		fwrite(attributesBlock, sizeof(attributesBlock[0]), tableData[0], tableFile);
+		fclose(tableFile);
+		
+		rebuildTableIndexes(database, table);
+		buildTableZoneMap(database, table);
+		rebuildTableBloomFilters(database, table);
+		if (isCompressedTable(database, table))
+		{
+			buildTableCompressedPages(database, table);
+		}
+		return deleted;
+	}
+	
+	off_t dataStart = ftello(tableFile);
+	struct stat fileStat;
+	fstat(fileno(tableFile), &fileStat);
+	
+	size_t recordStride = tableData[2] + sizeOfRecordBlockHeader();
+	long long int recordTotal = (fileStat.st_size - dataStart) / recordStride;
+	long long int skipBlockAmount;
+	char *skipBlock = buildZoneSkipList(database, table, where, &skipBlockAmount);
+	long long int *slot;
+	long long int slotAmount = 0;
+	long long int scannedRecords = countScannedRecords(skipBlock, skipBlockAmount, recordTotal);
+	AccessPath path = chooseAccessPath(database, table, scannedRecords, recordStride, where, 0, &slot, &slotAmount);
+	describeAccessPath(detail, table, path, 0, recordTotal, scannedRecords, slotAmount);
+	setQueryOperatorDetail(detail);
+	
+	if (isQueryPlanOnly() == 1)
+	{
+		if (path == INDEX_SCAN)
+		{
+			free(slot);
+		}
+	}
+	else
+	{
+		long long int pageAmount = (recordTotal + __ZONE_MAP_BLOCK_RECORDS - 1) / __ZONE_MAP_BLOCK_RECORDS;
+		char *dirtyPage = NULL;
+		if (isCompressedTable(database, table))
+		{
+			beginCompressedPageWrite(database, table);
+			dirtyPage = calloc(pageAmount + 1, sizeof(char));
+		}
+		
+		if (path == INDEX_SCAN)
+		{
+			deleted = scanIndexedRecords(tableFile, dataStart, tableData[2], slot, slotAmount, where, 1, dirtyPage, NULL, NULL);
+			free(slot);
+		}
+		else
+		{
+			deleted = scanRecordBatches(tableFile, tableData[2], where, skipBlock, skipBlockAmount, 1, dirtyPage, NULL, NULL);
+		}
+		
+		if (dirtyPage != NULL && deleted >= 0)
+		{
+			refreshCompressedPages(database, table, fileno(tableFile), dataStart, recordStride, dirtyPage, pageAmount);
+		}
+		free(dirtyPage);
+	}
+	
+	free(skipBlock);
+	fclose(tableFile);
+	
+	return deleted;
+}
+
+int deleteTableRecords(char database[], char table[], Predicate *where)
+{
+	beginQueryOperator("delete");
+	if (isQueryPlanOnly() == 0 && beginWriteTransaction() == 0)
+	{
+		endQueryOperator();
+		return -1;
+	}
+	
+	int deleted;
+	char detail[128];
+	if (where != NULL && isBloomFilterExcluded(database, table, where))
+	{
+		snprintf(detail, sizeof(detail), "bloom filter excludes every row of %s", table);
+		setQueryOperatorDetail(detail);
+		deleted = 0;
+	}
+	else if (isColumnarTable(database, table))
+	{
+		snprintf(detail, sizeof(detail), "columnar delete on %s", table);
+		setQueryOperatorDetail(detail);
+		deleted = isQueryPlanOnly() == 1 ? 0 : deleteFromColumnarTable(database, table, where);
+	}
+	else
+	{
+		deleted = deleteFromRowTable(database, table, where);
+	}
+	
+	if (isQueryPlanOnly() == 1)
+	{
+		endQueryOperator();
+		return 0;
+	}
+	
+	if (deleted >= 0 && where == NULL)
+	{
+		resetTableStats(database, table);
+		bumpTableVersion(database, table);
+	}
+	else if (deleted > 0)
+	{
+		recordTableDelete(database, table, deleted);
+		bumpTableVersion(database, table);
+	}
+	
+	if (endWriteTransaction(deleted >= 0, 0) == 0)
+	{
+		deleted = -1;
+	}
+	endQueryOperator();
+	return deleted;
+}
+
+int deleteFromDatabaseTable(char database[], char table[], char *whereAttr, void *whereValue)
+{
+	if (whereAttr == NULL)
+	{
+		return deleteTableRecords(database, table, NULL);
+	}
+	
+	int totalAttribute = 0;
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	if (readTableAttribute(database, table, &totalAttribute, attribute, NULL) == 0)
+	{
+		return -1;
+	}
+	
+	for (int i = 0; i < totalAttribute; i++)
+	{
+		if (strcmp(attribute[i].attributeName, whereAttr) == 0)
+		{
+			Predicate where;
+			initEqualPredicate(&where, attribute, i, whereValue);
+			return deleteTableRecords(database, table, &where);
+		}
+	}
+	return 0;
+}
+
+int deleteFromTableScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (clientAccount->openningDatabase == 1 && *queue != NULL)
+	{
+		char tableName[64];
+		memcpy(tableName, (*queue)->parsedString, sizeof(tableName));
+		convertToLower(tableName, strlen(tableName));
+	
+		popParsedStringQueue(queue);
+		
+		int returnValue = -1;
+		
+		int totalAttribute = 0;
+		int recordBlockSize = 0;
+		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+		
+		if (
+			readTableAttribute(
+				clientAccount->databaseName, tableName, &totalAttribute, attribute, &recordBlockSize
+			) == 1
+		)
+		{
+			if (*queue != NULL)
+			{
+				if (strcasecmp((*queue)->parsedString, "WHERE") == 0)
+				{
+					popParsedStringQueue(queue);
+					
+					if (*queue == NULL)
+					{
+						return -1;
+					}
+					
+					TableStats *stats = loadTableStats(clientAccount->databaseName, tableName);
+					Predicate *where = parseWherePredicate(queue, attribute, totalAttribute, stats);
+					free(stats);
+					
+					if (where != NULL && clientAccount->transaction != NULL)
+					{
+						WriteSetEntry *entry = appendWriteSetEntry(
+							clientAccount->transaction, WRITE_DELETE, clientAccount->databaseName, tableName, recordBlockSize
+						);
+						if (entry == NULL)
+						{
+							delPredicate(where);
+							return -1;
+						}
+						entry->where = where;
+						returnValue = 0;
+					}
+					else if (where != NULL)
+					{
+						returnValue = deleteTableRecords(clientAccount->databaseName, tableName, where);
+						delPredicate(where);
+					}
+					else
+					{
+						returnValue = 0;
+					}
+				}
+			}
+			else if (clientAccount->transaction != NULL)
+			{
+				if (
+					appendWriteSetEntry(
+						clientAccount->transaction, WRITE_DELETE, clientAccount->databaseName, tableName, recordBlockSize
+					) == NULL
+				)
+				{
+					return -1;
+				}
+				return 0;
+			}
+			else
+			{
+				return deleteFromDatabaseTable(clientAccount->databaseName, tableName, NULL, NULL);
+			}
+		}
+
+		return returnValue;
+	}
+	return -1;
+}
+
+int createIndexScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (clientAccount->openningDatabase == 0)
+	{
+		return 0;
+	}
+	
+	if (*queue != NULL && strcasecmp((*queue)->parsedString, "ON") != 0)
+	{
+		popParsedStringQueue(queue);
+	}
+	
+	if (*queue == NULL || strcasecmp((*queue)->parsedString, "ON") != 0)
+	{
+		return 0;
+	}
+	popParsedStringQueue(queue);
+	
+	if (*queue == NULL || (*queue)->next == NULL)
+	{
+		return 0;
+	}
+	
+	char tableName[64];
+	memset(tableName, 0, sizeof(tableName));
+	strncpy(tableName, (*queue)->parsedString, sizeof(tableName) - 1);
+	convertToLower(tableName, strlen(tableName));
+	popParsedStringQueue(queue);
+	
+	char columnName[__MAX_ATTRIBUTE_NAME_LENGTH];
+	memset(columnName, 0, sizeof(columnName));
+	strncpy(columnName, (*queue)->parsedString, sizeof(columnName) - 1);
+	convertToLower(columnName, strlen(columnName));
+	popParsedStringQueue(queue);
+	
+	return buildTableIndex(clientAccount->databaseName, tableName, columnName);
+}
+
+int createBloomFilterScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (clientAccount->openningDatabase == 0)
+	{
+		return 0;
+	}
+	
+	if (*queue != NULL && strcasecmp((*queue)->parsedString, "ON") != 0)
+	{
+		popParsedStringQueue(queue);
+	}
+	
+	if (*queue == NULL || strcasecmp((*queue)->parsedString, "ON") != 0)
+	{
+		return 0;
+	}
+	popParsedStringQueue(queue);
+	
+	if (*queue == NULL || (*queue)->next == NULL)
+	{
+		return 0;
+	}
+	
+	char tableName[64];
+	memset(tableName, 0, sizeof(tableName));
+	strncpy(tableName, (*queue)->parsedString, sizeof(tableName) - 1);
+	convertToLower(tableName, strlen(tableName));
+	popParsedStringQueue(queue);
+	
+	char columnName[__MAX_ATTRIBUTE_NAME_LENGTH];
+	memset(columnName, 0, sizeof(columnName));
+	strncpy(columnName, (*queue)->parsedString, sizeof(columnName) - 1);
+	convertToLower(columnName, strlen(columnName));
+	popParsedStringQueue(queue);
+	
+	double falsePositiveRate = __BLOOM_FALSE_POSITIVE_RATE;
+	if (*queue != NULL)
+	{
+		if (strcasecmp((*queue)->parsedString, "WITH") != 0 || (*queue)->next == NULL)
+		{
+			return 0;
+		}
+		popParsedStringQueue(queue);
+		
+		if (strncasecmp((*queue)->parsedString, "fpp=", 4) != 0 || sscanf((*queue)->parsedString + 4, "%lf", &falsePositiveRate) != 1)
+		{
+			return 0;
+		}
+		popParsedStringQueue(queue);
+	}
+	
+	return buildTableBloomFilter(clientAccount->databaseName, tableName, columnName, falsePositiveRate);
+}
+
+int analyzeTableScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (clientAccount->openningDatabase == 0)
+	{
+		return 0;
+	}
+	
+	if (*queue != NULL && strcasecmp((*queue)->parsedString, "TABLE") == 0)
+	{
+		popParsedStringQueue(queue);
+	}
+	
+	if (*queue == NULL)
+	{
+		return 0;
+	}
+	
+	char tableName[64];
+	memset(tableName, 0, sizeof(tableName));
+	strncpy(tableName, (*queue)->parsedString, sizeof(tableName) - 1);
+	convertToLower(tableName, strlen(tableName));
+	popParsedStringQueue(queue);
+	
+	return analyzeTable(clientAccount->databaseName, tableName);
+}
+
+long long int vacuumTable(char database[], char table[])
+{
+	if (isColumnarTable(database, table))
+	{
+		return 0;
+	}
+	
+	waitAsyncWrites();
+	
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r+");
+	
+	if (tableFile == NULL)
+	{
+		return -1;
+	}
+	
+	int tableData[3];
+	freadTableHeader(tableData, tableFile);
+	fseeko(tableFile, tableData[0] * sizeof(AttributeBlock), SEEK_CUR);
+	
+	off_t dataStart = ftello(tableFile);
+	size_t recordStride = tableData[2] + sizeOfRecordBlockHeader();
+	long long int horizon = oldestActiveSnapshot();
+	
+	char *batch = malloc(recordStride * __SCAN_BATCH_RECORDS);
+	long long int reclaimed = 0;
+	long long int recordIndex = 0;
+	long long int liveEnd = 0;
+	off_t batchPosition = dataStart;
+	size_t recordAmount;
+	
+	while ((recordAmount = fread(batch, recordStride, __SCAN_BATCH_RECORDS, tableFile)) > 0)
+	{
+		int changed = 0;
+		for (size_t i = 0; i < recordAmount; i++)
+		{
+			char *record = batch + i * recordStride;
+			BLOCKFLAG flag;
+			memcpy(&flag, record, sizeof(flag));
+			
+			if (flag == FILLED && isRecordReclaimable(record, horizon))
+			{
+				flag = EMPTY;
+				memcpy(record, &flag, sizeof(flag));
+				reclaimed++;
+				changed = 1;
+			}
+			
+			if (flag == FILLED)
+			{
+				liveEnd = recordIndex + i + 1;
+			}
+		}
+		
+		if (changed == 1)
+		{
+			fseeko(tableFile, batchPosition, SEEK_SET);
+			fwrite(batch, recordStride, recordAmount, tableFile);
+			fseeko(tableFile, batchPosition + recordStride * recordAmount, SEEK_SET);
+		}
+		batchPosition += recordStride * recordAmount;
+		recordIndex += recordAmount;
+	}
+	free(batch);
+	
+	fflush(tableFile);
+	ftruncate(fileno(tableFile), dataStart + liveEnd * recordStride);
+	fclose(tableFile);
+	
+	rebuildTableIndexes(database, table);
+	buildTableZoneMap(database, table);
+	rebuildTableBloomFilters(database, table);
+	analyzeTable(database, table);
+	if (isCompressedTable(database, table))
+	{
+		buildTableCompressedPages(database, table);
+	}
+	
+	return reclaimed;
+}
+
+long long int vacuumTableScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (clientAccount->openningDatabase == 0)
+	{
+		return -1;
+	}
+	
+	if (*queue != NULL && strcasecmp((*queue)->parsedString, "TABLE") == 0)
+	{
+		popParsedStringQueue(queue);
+	}
+	
+	if (*queue == NULL)
+	{
+		return -1;
+	}
+	
+	char tableName[64];
+	memset(tableName, 0, sizeof(tableName));
+	strncpy(tableName, (*queue)->parsedString, sizeof(tableName) - 1);
+	convertToLower(tableName, strlen(tableName));
+	popParsedStringQueue(queue);
+	
+	return vacuumTable(clientAccount->databaseName, tableName);
+}
+
+int compressTableScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (clientAccount->openningDatabase == 0)
+	{
+		return 0;
+	}
+	
+	if (*queue != NULL && strcasecmp((*queue)->parsedString, "TABLE") == 0)
+	{
+		popParsedStringQueue(queue);
+	}
+	
+	if (*queue == NULL)
+	{
+		return 0;
+	}
+	
+	char tableName[64];
+	memset(tableName, 0, sizeof(tableName));
+	strncpy(tableName, (*queue)->parsedString, sizeof(tableName) - 1);
+	convertToLower(tableName, strlen(tableName));
+	popParsedStringQueue(queue);
+	
+	return buildTableCompressedPages(clientAccount->databaseName, tableName);
+}
+
+int dropDatabaseScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (clientAccount->openningDatabase == 1 && strcasecmp(clientAccount->databaseName, (*queue)->parsedString) == 0)
+	{
+		char databaseName[64];
+		memset(databaseName, 0, sizeof(databaseName));
+		strcpy(databaseName, (*queue)->parsedString);
+		convertToLower(databaseName, strlen(databaseName));
+		
+		char filePath[1024];
+		sprintf(filePath, "%s/%s", __DATABASE_ROOT, databaseName); 
+		
+		DIR *databaseDirectory = opendir(filePath);
+		if (databaseDirectory != NULL)
+		{
+			rmdir(filePath);
+			
+			Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+			RecordBlockVector records;
+			int attributeTotal = 0;
+			int recordBlockSize = 0;
+			initRecordBlockVector(&records);
+			selectReadTable(
+				"admin", "database", &records, attribute, &attributeTotal, 
+				&recordBlockSize , "name", databaseName
+			);
+			
+			int result = 0;
+			
+			if (records.size == 1)
+			{
+				int databaseID = 0;
+				memcpy(&databaseID, records.record[0].data, sizeof(databaseID));
+				
+				result = 1;
+				
+				deleteFromDatabaseTable("admin", "database", "name", databaseName);
+				deleteFromDatabaseTable("admin", "database_permission", "databaseid", &databaseID);
+				bumpDatabaseVersions(databaseName);
+				
+				clientAccount->openningDatabase = 0;
+			}
+			
+			delRecordBlockVector(&records);
+			
+			return result;
+		}
+		else
+		{
+			return 0;
+		}
+	}
+	else
+	{
+		return 0;
+	}
+}
+
+void removeTableSidecarFiles(char database[], char table[])
+{
+	char directoryPath[1024];
+	char filePath[2048];
+	sprintf(directoryPath, "%s/%s", __DATABASE_ROOT, database);
+	
+	DIR *databaseDirectory = opendir(directoryPath);
+	if (databaseDirectory == NULL)
+	{
+		return;
+	}
+	
+	size_t tableNameLength = strlen(table);
+	struct dirent *entry;
+	while ((entry = readdir(databaseDirectory)) != NULL)
+	{
+		if (strncmp(entry->d_name, table, tableNameLength) == 0 && entry->d_name[tableNameLength] == '.')
+		{
+			sprintf(filePath, "%s/%s", directoryPath, entry->d_name);
+			remove(filePath);
+		}
+	}
+	closedir(databaseDirectory);
+}
+
+int dropTableScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (clientAccount->openningDatabase == 1)
+	{
+		convertToLower((*queue)->parsedString, strlen((*queue)->parsedString));
+		waitAsyncWrites();
+		
+		char filePath[1024];
+		sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, clientAccount->databaseName, (*queue)->parsedString);
+		int result = remove(filePath);
+		if (result == 0)
+		{
+			removeTableSidecarFiles(clientAccount->databaseName, (*queue)->parsedString);
+			bumpTableVersion(clientAccount->databaseName, (*queue)->parsedString);
+		}
+		return result;
+	}
+	
+	return -1;
+}
+
+int dropColumnScript(ParsedStringQueue **queue,  AccountData *clientAccount)
+{
+	if (*queue == NULL || clientAccount->openningDatabase == 0)
+	{
+		return 0;
+	}
+	
+	char columnName[__MAX_ATTRIBUTE_NAME_LENGTH];
+	memset(columnName, 0, sizeof(columnName));
+	strcpy(columnName, (*queue)->parsedString);
+	convertToLower(columnName, strlen(columnName));
+	
+	popParsedStringQueue(queue);
+	
+	if (*queue == NULL || strcasecmp((*queue)->parsedString, "FROM") != 0)
+	{
+		return 0;
+	}
+	
+	popParsedStringQueue(queue);
+		
+	if (*queue == NULL)
+	{
+		return 0;
+	}
+	
+	char tableName[64];
+	strcpy(tableName, (*queue)->parsedString);
+	convertToLower(tableName, strlen(tableName));
+
+	char filePath[1024];
+	char filePathForTemp[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, clientAccount->databaseName, tableName);
+	strcpy(filePathForTemp, filePath);
+	strcat(filePathForTemp, " temp");
+	waitAsyncWrites();
+	FILE *tableFile = fopen(filePath, "r");
+	
+	if (tableFile != NULL)
+	{
+		int tableData[3];
+		freadTableHeader(tableData, tableFile);
+		
+		AttributeBlock attributesBlock[tableData[0]];
+		fread(attributesBlock, sizeof(attributesBlock[0]), tableData[0], tableFile);
+		
+		int deletedAttributeIndex = -1;
+		int deletedAttributeDataOffset = 0;
+		int newSize = 0;
+		
+		for (int i = 0; i < tableData[0]; i++)
+		{
+			if (strcmp(attributesBlock[i].attribute.attributeName, columnName) == 0)
+			{
+				deletedAttributeIndex = i;
+				deletedAttributeDataOffset = newSize;
+			}
+			else
+			{
+				newSize += attributesBlock[i].attribute.size;
+			}
+		}
+		
+		int returnValue = 0;
+		
+		if (deletedAttributeIndex != -1)
+		{
+			FILE *newFile = fopen(filePathForTemp, "w");
+			int newTableData[3] = {tableData[0] - 1, tableData[1], newSize};
+			fwriteTableHeader(newTableData, newFile);
+			
+			if (deletedAttributeIndex != 0)
+			{
+				fwrite(attributesBlock, sizeof(attributesBlock[0]), deletedAttributeIndex, newFile);
+			}
+			if (deletedAttributeIndex != tableData[0] - 1)
+			{
+				fwrite(
+					&attributesBlock[deletedAttributeIndex + 1], sizeof(attributesBlock[0]), 
+					tableData[0] - 1 - deletedAttributeIndex, newFile
+				);
+			}
+			
+			RecordBlock readFromOldFile;
+			RecordBlock writeToNewFile;
+			initRecordBlock(&readFromOldFile, tableData[2]);
+			initRecordBlock(&writeToNewFile, newSize);
+			
+			int postDeletedAttributeOffsetForWriteToNewFile = deletedAttributeDataOffset + attributesBlock[deletedAttributeIndex].attribute.size;
+			int postDeletedAttributeSizeForWriteToNewFile = tableData[2] - postDeletedAttributeOffsetForWriteToNewFile; 
+			
+			long long int horizon = oldestActiveSnapshot();
+			
+			while(freadRecordBlock(&readFromOldFile, tableFile) == 1)
+			{
+				if (
+					readFromOldFile.flag == FILLED && 
+					isVersionReclaimable(readFromOldFile.createdTransaction, readFromOldFile.deletedTransaction, horizon) == 0
+				)
+				{
+					writeToNewFile.createdTransaction = readFromOldFile.createdTransaction;
+					writeToNewFile.deletedTransaction = readFromOldFile.deletedTransaction;
+					
+					if (deletedAttributeIndex != 0)
+					{
+						memcpy(writeToNewFile.data, readFromOldFile.data, deletedAttributeDataOffset);
+					}
+					if (deletedAttributeIndex != tableData[0] - 1)
+					{
+						memcpy(
+							writeToNewFile.data + deletedAttributeDataOffset, 
+							readFromOldFile.data + postDeletedAttributeOffsetForWriteToNewFile, 
+							postDeletedAttributeSizeForWriteToNewFile
+						);
+					}
+					
+					fwriteRecordBlock(&writeToNewFile, newFile);
+				}
+			}
+			
+			delRecordBlock(&readFromOldFile);
+			delRecordBlock(&writeToNewFile);
+			
+			fclose(newFile);
+			
+			remove(filePath);
+			rename(filePathForTemp, filePath);
+			
+			if (isColumnarTable(clientAccount->databaseName, tableName))
+			{
+				if (
+					columnarFilePath(
+						filePathForTemp, sizeof(filePathForTemp), clientAccount->databaseName, tableName, columnName
+					) == 1
+				)
+				{
+					remove(filePathForTemp);
+				}
+			}
+			
+			if (
+				indexFilePath(
+					filePathForTemp, sizeof(filePathForTemp), clientAccount->databaseName, tableName, columnName
+				) == 1
+			)
+			{
+				remove(filePathForTemp);
+			}
+			bloomFilterPath(filePathForTemp, clientAccount->databaseName, tableName, columnName);
+			remove(filePathForTemp);
+			rebuildTableIndexes(clientAccount->databaseName, tableName);
+			buildTableZoneMap(clientAccount->databaseName, tableName);
+			rebuildTableBloomFilters(clientAccount->databaseName, tableName);
+			analyzeTable(clientAccount->databaseName, tableName);
+			if (isCompressedTable(clientAccount->databaseName, tableName))
+			{
+				buildTableCompressedPages(clientAccount->databaseName, tableName);
+			}
+			bumpTableVersion(clientAccount->databaseName, tableName);
+		}
+		
+		fclose(tableFile);
+		return 1;
+	}	
+	return 0;
+}
+
+int updateTable(char database[], char table[], char setAttr[], void *setValue, Predicate *where)
+{
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r");
+	
+	if (tableFile != NULL)
+	{
+		fclose(tableFile);
+		
+		int returnValue = -1;
+		
+		int totalAttribute = 0;
+		int recordBlockSize = 0;
+		Attribute tableAttribute[__MAX_ATTRIBUTE_ON_TABLE];
+
+		RecordBlockVector effectedBlockRecords;
+		initRecordBlockVector(&effectedBlockRecords);
+				
+		if (
+			selectReadTableColumns(
+				database, table, &effectedBlockRecords, tableAttribute, &totalAttribute, 
+				&recordBlockSize, where, NULL
+			) == 1
+		)
+		{
+			int setAttributeIndex = -1;
+			int setAttributeOffset = 0;
+			
+			for (int i = 0; i < totalAttribute && setAttributeIndex == -1; i++)
+			{
+				if (strcasecmp(setAttr, tableAttribute[i].attributeName) == 0)
+				{
+					setAttributeIndex = i;
+				}
+				else
+				{
+					setAttributeOffset += tableAttribute[i].size;
+				}
+			}
+			
+			if (setAttributeIndex != -1 && isQueryPlanOnly() == 1)
+			{
+				deleteTableRecords(database, table, where);
+				returnValue = 0;
+			}
+			else if (setAttributeIndex != -1 && beginWriteTransaction() != 0)
+			{
+				int failed = deleteTableRecords(database, table, where) == -1;
+				
+				beginQueryOperator("insert");
+				for (int i = 0; i < effectedBlockRecords.size && failed == 0; i++)
+				{
+					memcpy(
+						getRecordBlockVector(&effectedBlockRecords)[i].data + setAttributeOffset, 
+						setValue, tableAttribute[setAttributeIndex].size
+					);
+					failed = insertIntoDatabaseTable(database, table, &(getRecordBlockVector(&effectedBlockRecords)[i])) != 1;
+				}
+				
+				QueryOperator *operator = currentQueryOperator();
+				if (operator != NULL)
+				{
+					operator->rowsIn = effectedBlockRecords.size;
+					operator->rowsOut = effectedBlockRecords.size;
+					operator->bytes = (long long int)effectedBlockRecords.size * recordBlockSize;
+					snprintf(operator->detail, sizeof(operator->detail), "write updated rows into %s", table);
+				}
+				endQueryOperator();
+				failed = endWriteTransaction(failed == 0, 0) == 0;
+				returnValue = failed == 0 ? effectedBlockRecords.size : -1;
+			}
+		}
+		
+		delRecordBlockVector(&effectedBlockRecords);
+		
+		return returnValue;
+	}
+	return -1;
+}
+
+int isWriteSetEntryValid(WriteSetEntry *entry)
+{
+	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
+	int totalAttribute = 0;
+	int recordBlockSize = 0;
+	return 
+		readTableAttribute(entry->database, entry->table, &totalAttribute, attribute, &recordBlockSize) == 1 && 
+		recordBlockSize == entry->recordBlockSize && isColumnarTable(entry->database, entry->table) == 0;
+}
+
+int isSameWriteSetTable(WriteSetEntry *entry, WriteSetEntry *other)
+{
+	return strcmp(entry->database, other->database) == 0 && strcmp(entry->table, other->table) == 0;
+}
+
+int syncTableFile(char database[], char table[])
+{
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
+	FILE *tableFile = fopen(filePath, "r");
+	if (tableFile == NULL)
+	{
+		return 0;
+	}
+	
+	int synced = fsync(fileno(tableFile)) == 0;
+	fclose(tableFile);
+	return synced;
+}
+
+int commitTransaction(Transaction *transaction)
+{
+	for (WriteSetEntry *entry = transaction->head; entry != NULL; entry = entry->next)
+	{
+		if (isWriteSetEntryValid(entry) == 0)
+		{
+			return 0;
+		}
+	}
+	
+	if (beginWriteTransaction() == 0)
+	{
+		return 0;
+	}
+	
+	int result = 1;
+	WriteSetEntry *entry = transaction->head;
+	while (entry != NULL && result == 1)
+	{
+		if (entry->operation == WRITE_INSERT)
+		{
+			int amount = 0;
+			WriteSetEntry *run = entry;
+			while (run != NULL && run->operation == WRITE_INSERT && isSameWriteSetTable(run, entry))
+			{
+				amount++;
+				run = run->next;
+			}
+			
+			WriteSetEntry *first = entry;
+			RecordBlock **records = malloc(sizeof(RecordBlock *) * amount);
+			for (int i = 0; i < amount; i++, entry = entry->next)
+			{
+				records[i] = &entry->record;
+			}
+			if (insertRecordsIntoDatabaseTable(first->database, first->table, records, amount) < amount)
+			{
+				result = 0;
+			}
+			free(records);
+			continue;
+		}
+		else if (entry->operation == WRITE_DELETE)
+		{
+			if (deleteTableRecords(entry->database, entry->table, entry->where) == -1)
+			{
+				result = 0;
+			}
+		}
+		else if (updateTable(entry->database, entry->table, entry->setAttribute, entry->setValue, entry->where) == -1)
+		{
+			result = 0;
+		}
+		entry = entry->next;
+	}
+	
+	if (waitAsyncWrites() == 0)
+	{
+		result = 0;
+	}
+	
+	for (WriteSetEntry *entry = transaction->head; entry != NULL && result == 1; entry = entry->next)
+	{
+		WriteSetEntry *first = transaction->head;
+		while (isSameWriteSetTable(first, entry) == 0)
+		{
+			first = first->next;
+		}
+		if (first == entry && syncTableFile(entry->database, entry->table) == 0)
+		{
+			result = 0;
+		}
+	}
+	return endWriteTransaction(result, 1);
+}
+
+int beginTransactionScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (*queue != NULL && (strcasecmp((*queue)->parsedString, "TRANSACTION") == 0 || strcasecmp((*queue)->parsedString, "WORK") == 0))
+	{
+		popParsedStringQueue(queue);
+	}
+	
+	if (clientAccount->transaction != NULL || *queue != NULL)
+	{
+		return 0;
+	}
+	
+	clientAccount->transaction = calloc(1, sizeof(Transaction));
+	return 1;
+}
+
+int commitTransactionScript(AccountData *clientAccount)
+{
+	if (clientAccount->transaction == NULL)
+	{
+		return 0;
+	}
+	
+	int result = commitTransaction(clientAccount->transaction);
+	delTransaction(clientAccount->transaction);
+	clientAccount->transaction = NULL;
+	return result;
+}
+
+int rollbackTransactionScript(AccountData *clientAccount)
+{
+	if (clientAccount->transaction == NULL)
+	{
+		return 0;
+	}
+	
+	delTransaction(clientAccount->transaction);
+	clientAccount->transaction = NULL;
+	return 1;
+}
+
+int updateTableScript(ParsedStringQueue **queue, AccountData *clientAccount)
+{
+	if (*queue != NULL && clientAccount->openningDatabase == 1)
+	{
+		char tableName[64];
+		strcpy(tableName, (*queue)->parsedString);
+		convertToLower(tableName, strlen(tableName));
+				
+		popParsedStringQueue(queue);
+		
+		int returnValue = -1;
+		
+		if (*queue != NULL && strcasecmp((*queue)->parsedString, "SET") == 0)
+		{
+			popParsedStringQueue(queue);
+			
+			char setAttribute[64];
+			int totalAttribute = 0;
+			int recordBlockSize = 0;
+			Attribute tableAttribute[__MAX_ATTRIBUTE_ON_TABLE];
+			void *setValue = NULL;
+			if (
+				*queue != NULL &&
+				readTableAttribute(clientAccount->databaseName, tableName, &totalAttribute, tableAttribute, &recordBlockSize) == 1 &&
+				parseAttributeAndGetValueFromString(setAttribute, tableAttribute, totalAttribute, &setValue, (*queue)->parsedString) == 1
+			)
+			{
+				popParsedStringQueue(queue);
+				
+				if (*queue != NULL && strcasecmp((*queue)->parsedString, "WHERE") == 0)
+				{
+					popParsedStringQueue(queue);
+					
+					TableStats *stats = loadTableStats(clientAccount->databaseName, tableName);
+					Predicate *where = parseWherePredicate(queue, tableAttribute, totalAttribute, stats);
+					free(stats);
+					
+					if (where != NULL && clientAccount->transaction != NULL)
+					{
+						WriteSetEntry *entry = appendWriteSetEntry(
+							clientAccount->transaction, WRITE_UPDATE, clientAccount->databaseName, tableName, recordBlockSize
+						);
+						if (entry == NULL)
+						{
+							delPredicate(where);
+						}
+						else
+						{
+							entry->where = where;
+							strcpy(entry->setAttribute, setAttribute);
+							entry->setValue = setValue;
+							setValue = NULL;
+							returnValue = 0;
+						}
+					}
+					else if (where != NULL)
+					{
+						returnValue = updateTable(clientAccount->databaseName, tableName, setAttribute, setValue, where);
+						delPredicate(where);
+					}
+				} 
+				else if (*queue == NULL && clientAccount->transaction != NULL)
+				{
+					WriteSetEntry *entry = appendWriteSetEntry(
+						clientAccount->transaction, WRITE_UPDATE, clientAccount->databaseName, tableName, recordBlockSize
+					);
+					if (entry != NULL)
+					{
+						strcpy(entry->setAttribute, setAttribute);
+						entry->setValue = setValue;
+						setValue = NULL;
+						returnValue = 0;
+					}
+				}
+				else if (*queue == NULL)
+				{
+					returnValue = updateTable(clientAccount->databaseName, tableName, setAttribute, setValue, NULL);
+				}
+				
+				
+				free(setValue);
+			}
+			
+		}
+		
+		return returnValue;
+	}
+	return -1;
+}
+
+void writeExplainResult(QueryProfile *profile, int fileDescriptor, char message[], long long int totalElapsed)
+{
+	const char *attributeName[8] = {"operator", "detail", "rows_in", "rows_out", "skipped", "bytes", "allocs", "time_us"};
+	int attributeAmount = profile->analyze == 1 ? 8 : 2;
+	Attribute attribute[8];
+	int selectedAttribute[8];
+	int recordSize = 0;
+	
+	memset(attribute, 0, sizeof(attribute));
+	for (int i = 0; i < attributeAmount; i++)
+	{
+		strcpy(attribute[i].attributeName, attributeName[i]);
+		attribute[i].type = i < 2 ? STRING : LONG;
+		attribute[i].size = i == 0 ? sizeof(profile->operator[0].name) : i == 1 ? sizeof(profile->operator[0].detail) : sizeof(long long int);
+		selectedAttribute[i] = i;
+		recordSize += attribute[i].size;
+	}
+	
+	int rowAmount = 0;
+	for (int i = 0; i < profile->operatorAmount; i++)
+	{
+		if (profile->analyze == 1 || profile->operator[i].detail[0] != '\0')
+		{
+			rowAmount++;
+		}
+	}
+	
+	ResultWriter writer;
+	initResultWriter(&writer, fileDescriptor, message, attribute, attributeAmount, selectedAttribute, attributeAmount);
+	writeResultHeader(&writer, profile->analyze == 1 ? rowAmount + 1 : rowAmount);
+	
+	char record[recordSize];
+	for (int i = 0; i <= profile->operatorAmount; i++)
+	{
+		QueryOperator total;
+		QueryOperator *operator = &profile->operator[i];
+		if (i == profile->operatorAmount)
+		{
+			if (profile->analyze == 0)
+			{
+				break;
+			}
+			memset(&total, 0, sizeof(total));
+			strcpy(total.name, "total");
+			total.elapsed = totalElapsed;
+			operator = &total;
+		}
+		else if (profile->analyze == 0 && operator->detail[0] == '\0')
+		{
+			continue;
+		}
+		
+		long long int value[6] = {
+			operator->rowsIn, operator->rowsOut, operator->skipped, operator->bytes, operator->allocations, operator->elapsed
+		};
+		memcpy(record, operator->name, sizeof(operator->name));
+		memcpy(record + sizeof(operator->name), operator->detail, sizeof(operator->detail));
+		if (profile->analyze == 1)
+		{
+			memcpy(record + sizeof(operator->name) + sizeof(operator->detail), value, sizeof(value));
+		}
+		writeResultRecord(&writer, record);
+	}
+}
+
+int explainScript(
+	ParsedStringQueue **queue, AccountData *clientAccount, int fileDescriptor, char message[], struct timespec *started
+)
+{
+	QueryProfile *profile = calloc(1, sizeof(QueryProfile));
+	profile->current = -1;
+	
+	if (*queue != NULL && strcasecmp((*queue)->parsedString, "ANALYZE") == 0)
+	{
+		profile->analyze = 1;
+		popParsedStringQueue(queue);
+	}
+	
+	if (
+		*queue == NULL || 
+		(profile->analyze == 1 && clientAccount->transaction != NULL && strcasecmp((*queue)->parsedString, "SELECT") != 0)
+	)
+	{
+		free(profile);
+		return 0;
+	}
+	
+	AccountData explainAccount = *clientAccount;
+	explainAccount.transaction = NULL;
+	int succeeded = 0;
+	
+	QueryProfile *statementProfile = activeQueryProfile;
+	activeQueryProfile = profile;
+	beginQueryOperatorAt("parse", started);
+	
+	if (strcasecmp((*queue)->parsedString, "SELECT") == 0)
+	{
+		popParsedStringQueue(queue);
+		succeeded = *queue != NULL && selectFromTableScript(queue, &explainAccount, -1, message, NULL) == 1;
+	}
+	else if (strcasecmp((*queue)->parsedString, "DELETE") == 0)
+	{
+		popParsedStringQueue(queue);
+		if (*queue != NULL && strcasecmp((*queue)->parsedString, "FROM") == 0)
+		{
+			popParsedStringQueue(queue);
+			succeeded = deleteFromTableScript(queue, &explainAccount) >= 0;
+		}
+	}
+	else if (strcasecmp((*queue)->parsedString, "UPDATE") == 0)
+	{
+		popParsedStringQueue(queue);
+		succeeded = updateTableScript(queue, &explainAccount) >= 0;
+	}
+	
+	endQueryOperator();
+	activeQueryProfile = statementProfile;
+	if (statementProfile != NULL)
+	{
+		memcpy(statementProfile->operator, profile->operator, sizeof(profile->operator));
+		statementProfile->operatorAmount = profile->operatorAmount;
+		statementProfile->current = -1;
+	}
+	
+	if (succeeded == 1)
+	{
+		struct timespec finished;
+		clock_gettime(CLOCK_MONOTONIC, &finished);
+		writeExplainResult(
+			profile, fileDescriptor, message, 
+			(finished.tv_sec - started->tv_sec) * 1000000LL + (finished.tv_nsec - started->tv_nsec) / 1000
+		);
+	}
+	free(profile);
+	return succeeded;
+}
+
+DumpChunk* newDumpChunk()
+{
+	DumpChunk *chunk = malloc(sizeof(DumpChunk));
+	initDynamicBlock(&chunk->data);
+	chunk->next = NULL;
+	return chunk;
+}
+
+void delDumpChunk(DumpChunk *chunk)
+{
+	delDynamicBlock(&chunk->data);
+	free(chunk);
+}
+
+void pushDumpChunk(DumpWriter *writer, int last)
+{
+	DatabaseDump *dump = writer->dump;
+	DumpTable *table = writer->table;
+	
+	pthread_mutex_lock(&dump->lock);
+	while (table->chunkAmount >= __DUMP_QUEUE_CHUNKS)
+	{
+		pthread_cond_wait(&dump->chunkTaken, &dump->lock);
+	}
+	if (writer->chunk->data.size > 0)
+	{
+		if (table->tail != NULL)
+		{
+			table->tail->next = writer->chunk;
+		}
+		else
+		{
+			table->head = writer->chunk;
+		}
+		table->tail = writer->chunk;
+		table->chunkAmount++;
+	}
+	else
+	{
+		delDumpChunk(writer->chunk);
+	}
+	table->finished = last;
+	pthread_cond_broadcast(&dump->chunkReady);
+	pthread_mutex_unlock(&dump->lock);
+	
+	writer->chunk = last == 1 ? NULL : newDumpChunk();
+}
+
+void appendDumpText(DynamicBlock *block, const char *text)
+{
+	concatDynamicBlock(block, text, strlen(text));
+}
+
+void flushDumpStatement(DumpWriter *writer)
+{
+	if (writer->statementRows == 0)
+	{
+		return;
+	}
+	
+	appendDumpText(&writer->chunk->data, "INSERT INTO ");
+	appendDumpText(&writer->chunk->data, writer->table->table);
+	appendDumpText(&writer->chunk->data, " ");
+	concatDynamicBlock(&writer->chunk->data, writer->statement.block, writer->statement.size);
+	appendDumpText(&writer->chunk->data, ";\n");
+	
+	writer->statement.size = 0;
+	writer->statementRows = 0;
+	
+	if (writer->chunk->data.size >= __DUMP_CHUNK_SIZE)
+	{
+		pushDumpChunk(writer, 0);
+	}
+}
+
+void appendDumpValue(DynamicBlock *block, Attribute *attribute, const char *value)
+{
+	char text[64];
+	if (attribute->type == INT)
+	{
+		int data;
+		memcpy(&data, value, sizeof(data));
+		sprintf(text, "%d", data);
+		appendDumpText(block, text);
+	}
+	else if (attribute->type == LONG)
+	{
+		long long int data;
+		memcpy(&data, value, sizeof(data));
+		sprintf(text, "%lld", data);
+		appendDumpText(block, text);
+	}
+	else if (attribute->type == DECIMAL)
+	{
+		double data;
+		memcpy(&data, value, sizeof(data));
+		sprintf(text, "%.17g", data);
+		appendDumpText(block, text);
+	}
+	else
+	{
+		size_t length = strnlen(value, attribute->size);
+		appendDumpText(block, "'");
+		for (const char *quote; (quote = memchr(value, '\'', length)) != NULL; )
+		{
+			concatDynamicBlock(block, value, quote - value + 1);
+			appendDumpText(block, "'");
+			length -= quote - value + 1;
+			value = quote + 1;
+		}
+		concatDynamicBlock(block, value, length);
+		appendDumpText(block, "'");
+	}
+}
+
+int dumpRecordCallback(void *context, char *recordData)
+{
+	DumpWriter *writer = (DumpWriter *)context;
+	
+	writer->row.size = 0;
+	appendDumpText(&writer->row, "(");
+	int offset = 0;
+	for (int i = 0; i < writer->attributeTotal; i++)
+	{
+		if (i > 0)
+		{
+			appendDumpText(&writer->row, ", ");
+		}
+		appendDumpValue(&writer->row, &writer->attribute[i], recordData + offset);
+		offset += writer->attribute[i].size;
+	}
+	appendDumpText(&writer->row, ")");
+	
+	size_t statementPrefix = strlen("INSERT INTO ") + strlen(writer->table->table) + strlen(" ;\n");
+	if (statementPrefix + writer->row.size >= __DATA_BUFFER)
+	{
+		pthread_mutex_lock(&writer->dump->lock);
+		if (writer->dump->failed == 0)
+		{
+			writer->dump->failed = 1;
+			strcpy(writer->dump->failedTable, writer->table->table);
+		}
+		pthread_mutex_unlock(&writer->dump->lock);
+		return 0;
+	}
+	
+	if (
+		writer->statementRows > 0 && 
+		statementPrefix + writer->statement.size + strlen(", ") + writer->row.size >= __DATA_BUFFER
+	)
+	{
+		flushDumpStatement(writer);
+	}
+	
+	if (writer->statementRows > 0)
+	{
+		appendDumpText(&writer->statement, ", ");
+	}
+	concatDynamicBlock(&writer->statement, writer->row.block, writer->row.size);
+	writer->statementRows++;
+	return 1;
+}
+
+void dumpCreateTable(DumpWriter *writer, int columnar, int compressed)
+{
+	DynamicBlock *block = &writer->chunk->data;
+	appendDumpText(block, "CREATE TABLE ");
+	appendDumpText(block, writer->table->table);
+	appendDumpText(block, " (");
+	
+	char text[64];
+	for (int i = 0; i < writer->attributeTotal; i++)
+	{
+		Attribute *attribute = &writer->attribute[i];
+		if (i > 0)
+		{
+			appendDumpText(block, ", ");
+		}
+		appendDumpText(block, attribute->attributeName);
+		
+		if (attribute->type == INT)
+		{
+			appendDumpText(block, " INT");
+		}
+		else if (attribute->type == LONG)
+		{
+			appendDumpText(block, " LONG");
+		}
+		else if (attribute->type == DECIMAL)
+		{
+			appendDumpText(block, " DECIMAL");
+		}
+		else if (attribute->type == TIME)
+		{
+			appendDumpText(block, " TIME");
+		}
+		else if (attribute->type == DATE)
+		{
+			appendDumpText(block, " DATE");
+		}
+		else if (attribute->type == DATETIME)
+		{
+			appendDumpText(block, " DATETIME");
+		}
+		else
+		{
+			sprintf(text, " STRING(%d)", attribute->size);
+			appendDumpText(block, text);
+		}
+	}
+	appendDumpText(block, ")");
+	
+	if (columnar == 1)
+	{
+		appendDumpText(block, " WITH storage=columnar");
+	}
+	else if (compressed == 1)
+	{
+		appendDumpText(block, " WITH compression=page");
+	}
+	appendDumpText(block, ";\n");
+}
+
+void dumpRowTable(DumpWriter *writer)
+{
+	char filePath[1024];
+	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, writer->dump->database, writer->table->table);
 	FILE *tableFile = fopen(filePath, "r");
-	
 	if (tableFile == NULL)
 	{
 		return;
 	}
+	int fileDescriptor = fileno(tableFile);
+	
+	int tableData[3];
+	pread(fileDescriptor, tableData, sizeof(tableData), sizeOfTableFormat());
+	off_t dataStart = tableHeaderSize(tableData[0]);
+	size_t recordStride = tableData[2] + sizeOfRecordBlockHeader();
+	int batchCapacity = scanBatchCapacity(recordStride);
+	
+	char *batch = malloc(recordStride * batchCapacity);
+	unsigned long long selection[(__SCAN_BATCH_RECORDS + 63) / 64];
+	int scanning = 1;
+	
+	ssize_t readBytes;
+	off_t position = dataStart;
+	while ((readBytes = pread(fileDescriptor, batch, recordStride * batchCapacity, position)) > 0)
+	{
+		int recordAmount = readBytes / recordStride;
+		if (recordAmount == 0)
+		{
+			break;
+		}
+		recordScanStats(recordAmount, recordAmount * recordStride);
+		buildVisibleSelection(batch, recordAmount, recordStride, &writer->dump->snapshot, selection);
+		emitSelectedRecords(batch, recordAmount, recordStride, selection, &scanning, dumpRecordCallback, writer);
+		position += (off_t)recordAmount * recordStride;
+	}
+	
+	free(batch);
+	fclose(tableFile);
+}
+
+void *dumpTableWorker(void *argument)
+{
+	DatabaseDump *dump = (DatabaseDump *)argument;
+	DumpWriter writer;
+	writer.dump = dump;
+	initDynamicBlock(&writer.row);
+	initDynamicBlock(&writer.statement);
+	
+	while (1)
+	{
+		pthread_mutex_lock(&dump->lock);
+		int tableIndex = dump->nextTable < dump->tableAmount ? dump->nextTable++ : -1;
+		int failed = dump->failed;
+		pthread_mutex_unlock(&dump->lock);
+		
+		if (tableIndex == -1)
+		{
+			break;
+		}
+		
+		writer.table = &dump->table[tableIndex];
+		writer.chunk = newDumpChunk();
+		writer.statement.size = 0;
+		writer.statementRows = 0;
+		writer.attributeTotal = 0;
+		
+		int recordBlockSize = 0;
+		if (
+			failed == 0 && 
+			readTableAttribute(
+				dump->database, writer.table->table, &writer.attributeTotal, writer.attribute, &recordBlockSize
+			) == 1
+		)
+		{
+			int columnar = isColumnarTable(dump->database, writer.table->table);
+			dumpCreateTable(&writer, columnar, isCompressedTable(dump->database, writer.table->table));
+			
+			if (columnar == 1)
+			{
+				scanColumnarTable(
+					dump->database, writer.table->table, writer.attribute, writer.attributeTotal, recordBlockSize, 
+					NULL, NULL, 0, dumpRecordCallback, &writer
+				);
+			}
+			else
+			{
+				dumpRowTable(&writer);
+			}
+			flushDumpStatement(&writer);
+		}
+		pushDumpChunk(&writer, 1);
+	}
+	
+	delDynamicBlock(&writer.row);
+	delDynamicBlock(&writer.statement);
+	return NULL;
+}
+
+int compareDumpTable(const void *a, const void *b)
+{
+	return strcmp(((DumpTable *)a)->table, ((DumpTable *)b)->table);
+}
+
+int listDumpTables(DatabaseDump *dump)
+{
+	char directoryPath[1024];
+	sprintf(directoryPath, "%s/%s", __DATABASE_ROOT, dump->database);
+	DIR *databaseDirectory = opendir(directoryPath);
+	if (databaseDirectory == NULL)
+	{
+		return 0;
+	}
+	
+	int capacity = 8;
+	dump->table = calloc(capacity, sizeof(DumpTable));
+	dump->tableAmount = 0;
+	
+	struct dirent *entry;
+	while ((entry = readdir(databaseDirectory)) != NULL)
+	{
+		if (strchr(entry->d_name, '.') != NULL || strchr(entry->d_name, ' ') != NULL || strlen(entry->d_name) >= 64)
+		{
+			continue;
+		}
+		if (dump->tableAmount == capacity)
+		{
+			capacity *= 2;
+			dump->table = realloc(dump->table, sizeof(DumpTable) * capacity);
+		}
+		memset(&dump->table[dump->tableAmount], 0, sizeof(DumpTable));
+		strcpy(dump->table[dump->tableAmount].table, entry->d_name);
+		dump->tableAmount++;
+	}
+	closedir(databaseDirectory);
 	
-	fread(tableData, sizeof(int), 3, tableFile);
-	fclose(tableFile);
+	qsort(dump->table, dump->tableAmount, sizeof(DumpTable), compareDumpTable);
+	return 1;
 }
 
-int createNewAccount(ParsedStringQueue **queue)
+int sendDumpBytes(int fileDescriptor, const char *data, size_t size)
 {
-	char username[64];
-	memset(username, 0, sizeof(username));
-	strcpy(username, (*queue)->parsedString);
+	while (size > 0)
+	{
+		ssize_t sent = sendToClient(fileDescriptor, data, size, MSG_NOSIGNAL);
+		if (sent <= 0)
+		{
+			return 0;
+		}
+		data += sent;
+		size -= sent;
+	}
+	return 1;
+}
+
+int dumpDatabaseScript(ParsedStringQueue **queue, AccountData *clientAccount, int fileDescriptor, char message[])
+{
+	AccountData dumpAccount = *clientAccount;
+	if (useDatabaseScript(queue, &dumpAccount) == 0)
+	{
+		return 0;
+	}
 	
-	RecordBlockVector recordBlockVector;
-	initRecordBlockVector(&recordBlockVector);
+	DatabaseDump dump;
+	memset(&dump, 0, sizeof(dump));
+	strcpy(dump.database, dumpAccount.databaseName);
+	if (listDumpTables(&dump) == 0)
+	{
+		return 0;
+	}
 	
-	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
-	int attributeTotal = 0;
-	int recordBlockSize = 0;
+	waitAsyncWrites();
+	dump.snapshot = acquireSnapshot();
+	pthread_mutex_init(&dump.lock, NULL);
+	pthread_cond_init(&dump.chunkReady, NULL);
+	pthread_cond_init(&dump.chunkTaken, NULL);
 	
-	char usernameString[64];
-	memset(usernameString, 0, 64);
-	strcpy(usernameString, "username");
+	int threadAmount = dump.tableAmount < __DUMP_THREADS ? dump.tableAmount : __DUMP_THREADS;
+	pthread_t thread[__DUMP_THREADS];
+	for (int i = 0; i < threadAmount; i++)
+	{
+		pthread_create(&thread[i], NULL, dumpTableWorker, &dump);
+	}
 	
-	selectReadTable("admin", "account", &recordBlockVector, attribute, &attributeTotal, &recordBlockSize, usernameString, username);
+	int connected = 1;
+	for (int i = 0; i < dump.tableAmount; i++)
+	{
+		DumpTable *table = &dump.table[i];
+		while (1)
+		{
+			pthread_mutex_lock(&dump.lock);
+			while (table->head == NULL && table->finished == 0)
+			{
+				pthread_cond_wait(&dump.chunkReady, &dump.lock);
+			}
+			DumpChunk *chunk = table->head;
+			if (chunk != NULL)
+			{
+				table->head = chunk->next;
+				if (table->head == NULL)
+				{
+					table->tail = NULL;
+				}
+				table->chunkAmount--;
+				pthread_cond_broadcast(&dump.chunkTaken);
+			}
+			int failed = dump.failed;
+			pthread_mutex_unlock(&dump.lock);
+			
+			if (chunk == NULL)
+			{
+				break;
+			}
+			
+			if (connected == 1 && failed == 0)
+			{
+				long long int chunkSize = chunk->data.size;
+				memset(message, 0, __DATA_BUFFER);
+				message[0] = 'K';
+				memcpy(message + 1, &chunkSize, sizeof(chunkSize));
+				connected = 
+					sendDumpBytes(fileDescriptor, message, __DATA_BUFFER) && 
+					sendDumpBytes(fileDescriptor, chunk->data.block, chunk->data.size);
+			}
+			delDumpChunk(chunk);
+		}
+	}
 	
-	if (recordBlockVector.size != 0)
+	for (int i = 0; i < threadAmount; i++)
 	{
-		delRecordBlockVector(&recordBlockVector);
-		return 0;
+		pthread_join(thread[i], NULL);
 	}
-	delRecordBlockVector(&recordBlockVector);
 	
-	popParsedStringQueue(queue);
+	int result = 1;
+	if (dump.failed == 1)
+	{
+		snprintf(
+			message, __DATA_BUFFER, "MGagal dump database, satu baris tabel %s tidak muat dalam %d byte", 
+			dump.failedTable, __DATA_BUFFER
+		);
+		result = -1;
+	}
 	
-	if (*queue == NULL || strcasecmp((*queue)->parsedString, "IDENTIFIED" ) != 0)
+	releaseSnapshot(&dump.snapshot);
+	pthread_mutex_destroy(&dump.lock);
+	pthread_cond_destroy(&dump.chunkReady);
+	pthread_cond_destroy(&dump.chunkTaken);
+	free(dump.table);
+	return result;
+}
+
+long long int copyFileContents(char sourcePath[], char targetPath[])
+{
+	FILE *sourceFile = fopen(sourcePath, "r");
+	if (sourceFile == NULL)
 	{
-		return 0;
+		return -1;
+	}
+	FILE *targetFile = fopen(targetPath, "w");
+	if (targetFile == NULL)
+	{
+		fclose(sourceFile);
+		return -1;
 	}
 	
-	popParsedStringQueue(queue);
+	int sourceDescriptor = fileno(sourceFile);
+	int targetDescriptor = fileno(targetFile);
+	struct stat fileStat;
+	fstat(sourceDescriptor, &fileStat);
 	
-	if (*queue == NULL || strcasecmp((*queue)->parsedString, "BY" ) != 0)
+	long long int copied = 0;
+	while (copied < fileStat.st_size)
 	{
-		return 0;
+		ssize_t result = copy_file_range(sourceDescriptor, NULL, targetDescriptor, NULL, fileStat.st_size - copied, 0);
+		if (result <= 0)
+		{
+			break;
+		}
+		copied += result;
+	}
+	
+	if (copied < fileStat.st_size)
+	{
+		char buffer[65536];
+		ssize_t readBytes;
+		lseek(sourceDescriptor, copied, SEEK_SET);
+		lseek(targetDescriptor, copied, SEEK_SET);
+		while ((readBytes = read(sourceDescriptor, buffer, sizeof(buffer))) > 0)
+		{
+			if (write(targetDescriptor, buffer, readBytes) != readBytes)
+			{
+				copied = -1;
+				break;
+			}
+			copied += readBytes;
+		}
+	}
+	
+	if (copied >= 0 && fsync(targetDescriptor) != 0)
+	{
+		copied = -1;
+	}
+	fclose(sourceFile);
+	fclose(targetFile);
+	return copied;
+}
+
+long long int copyDatabaseTree(char sourceRoot[], char targetRoot[], int *fileAmount)
+{
+	DIR *sourceDirectory = opendir(sourceRoot);
+	if (sourceDirectory == NULL || (mkdir(targetRoot, S_IRWXU | S_IRWXG | S_IROTH | S_IXOTH) != 0 && errno != EEXIST))
+	{
+		if (sourceDirectory != NULL)
+		{
+			closedir(sourceDirectory);
+		}
+		return -1;
 	}
 	
+	char sourcePath[2048];
+	char targetPath[2048];
+	long long int copiedBytes = 0;
+	struct dirent *entry;
+	while ((entry = readdir(sourceDirectory)) != NULL && copiedBytes >= 0)
+	{
+		if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0 || strstr(entry->d_name, " temp") != NULL)
+		{
+			continue;
+		}
+		sprintf(sourcePath, "%s/%s", sourceRoot, entry->d_name);
+		sprintf(targetPath, "%s/%s", targetRoot, entry->d_name);
+		
+		struct stat fileStat;
+		if (stat(sourcePath, &fileStat) != 0)
+		{
+			continue;
+		}
+		
+		long long int result;
+		if (S_ISDIR(fileStat.st_mode))
+		{
+			result = copyDatabaseTree(sourcePath, targetPath, fileAmount);
+		}
+		else
+		{
+			result = copyFileContents(sourcePath, targetPath);
+			*fileAmount += 1;
+		}
+		copiedBytes = result >= 0 ? copiedBytes + result : -1;
+	}
+	closedir(sourceDirectory);
+	return copiedBytes;
+}
+
+void parseBackupPath(char path[], char parsedString[], size_t size)
+{
+	memset(path, 0, size);
+	size_t length = strlen(parsedString);
+	if (length >= 2 && parsedString[0] == '\'' && parsedString[length - 1] == '\'')
+	{
+		strncpy(path, parsedString + 1, length - 2 < size - 1 ? length - 2 : size - 1);
+	}
+	else
+	{
+		strncpy(path, parsedString, size - 1);
+	}
+}
+
+long long int backupScript(ParsedStringQueue **queue, AccountData *clientAccount, int *fileAmount)
+{
+	if (clientAccount->id != 0 || *queue == NULL || strcasecmp((*queue)->parsedString, "TO") != 0)
+	{
+		return -1;
+	}
 	popParsedStringQueue(queue);
 	
 	if (*queue == NULL)
 	{
-		return 0;
+		return -1;
 	}
 	
-	char password[64];
-	memset(password, 0, sizeof(password));
-	strcpy(password, (*queue)->parsedString);
+	char backupPath[1024];
+	parseBackupPath(backupPath, (*queue)->parsedString, sizeof(backupPath));
+	popParsedStringQueue(queue);
 	
-	RecordBlock recordBlockNewAccount;
-	initRecordBlock(&recordBlockNewAccount, recordBlockSize);
+	if (strlen(backupPath) == 0 || access(backupPath, F_OK) == 0)
+	{
+		return -1;
+	}
 	
-	int tableData[3];
-	readTableDataBlock("admin", "account", tableData);
-	tableData[1] += 1;
+	waitAsyncWrites();
+	*fileAmount = 0;
+	return copyDatabaseTree(__DATABASE_ROOT, backupPath, fileAmount);
+}
+
+void removeDatabaseTree(char root[])
+{
+	DIR *directory = opendir(root);
+	if (directory == NULL)
+	{
+		remove(root);
+		return;
+	}
 	
-	memcpy(recordBlockNewAccount.data, &tableData[1], sizeof(int));
-	memcpy(recordBlockNewAccount.data + sizeof(int), username, sizeof(username)); 
-	memcpy(recordBlockNewAccount.data + sizeof(int) + sizeof(username), password, sizeof(password));
+	char filePath[2048];
+	struct dirent *entry;
+	while ((entry = readdir(directory)) != NULL)
+	{
+		if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0)
+		{
+			continue;
+		}
+		sprintf(filePath, "%s/%s", root, entry->d_name);
+		
+		struct stat fileStat;
+		if (lstat(filePath, &fileStat) == 0 && S_ISDIR(fileStat.st_mode))
+		{
+			removeDatabaseTree(filePath);
+		}
+		else
+		{
+			remove(filePath);
+		}
+	}
+	closedir(directory);
+	rmdir(root);
+}
+
+int isDatabaseBackup(char backupPath[])
+{
+	char checkPath[2048];
+	int length = snprintf(checkPath, sizeof(checkPath), "%s/admin/account", backupPath);
+	return length >= 0 && (size_t)length < sizeof(checkPath) && access(checkPath, R_OK) == 0;
+}
+
+int restoreDatabaseRoot(char backupPath[])
+{
+	if (isDatabaseBackup(backupPath) == 0)
+	{
+		return 0;
+	}
 	
-	insertIntoDatabaseTable("admin", "account", &recordBlockNewAccount);
+	char restorePath[1024];
+	char previousPath[1024];
+	sprintf(restorePath, "%s.restore", __DATABASE_ROOT);
+	sprintf(previousPath, "%s.pre-restore.%ld", __DATABASE_ROOT, (long int)time(NULL));
 	
-	delRecordBlock(&recordBlockNewAccount);
+	int fileAmount = 0;
+	removeDatabaseTree(restorePath);
+	if (copyDatabaseTree(backupPath, restorePath, &fileAmount) < 0)
+	{
+		removeDatabaseTree(restorePath);
+		return 0;
+	}
+	
+	int previousExists = access(__DATABASE_ROOT, F_OK) == 0;
+	if (previousExists == 1 && rename(__DATABASE_ROOT, previousPath) != 0)
+	{
+		removeDatabaseTree(restorePath);
+		return 0;
+	}
+	if (rename(restorePath, __DATABASE_ROOT) != 0)
+	{
+		if (previousExists == 1)
+		{
+			rename(previousPath, __DATABASE_ROOT);
+		}
+		removeDatabaseTree(restorePath);
+		return 0;
+	}
 	return 1;
 }
 
-int createDatabaseScript(ParsedStringQueue **queue, int userID)
+StatementType classifyStatement(char statement[])
 {
-	if (*queue != NULL)
+	char keyword[16];
+	int length = 0;
+	while (*statement == ' ')
 	{
-		char databaseName[64];
-		memset(databaseName, 0, sizeof(databaseName));
-		strcpy(databaseName, (*queue)->parsedString);
-		convertToLower(databaseName, strlen(databaseName));
-		
-		if (isStringAlphaNumeric(databaseName) == 1)
-		{
-			RecordBlockVector recordBlockVector;
-			initRecordBlockVector(&recordBlockVector);
-			Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
-			int attributeTotal = 0;
-			int recordBlockSize = 0;
-			
-			selectReadTable(
-				"admin", "database", &recordBlockVector, attribute, 
-				&attributeTotal, &recordBlockSize, "name", databaseName
-			);
-			
-			if (recordBlockVector.size == 0)
-			{
-				int tableData[3];
-				readTableDataBlock("admin", "database", tableData);
-				int databaseID = tableData[1] + 1;
-				
-				RecordBlock recordBlockForNewDatabase;
-				initRecordBlock(&recordBlockForNewDatabase, recordBlockSize);
-				memcpy(recordBlockForNewDatabase.data, &databaseID, sizeof(int));
-				memcpy(recordBlockForNewDatabase.data + sizeof(int), databaseName, sizeof(databaseName));
-				insertIntoDatabaseTable("admin", "database", &recordBlockForNewDatabase);
-				
-				delRecordBlock(&recordBlockForNewDatabase);
-				
-				readTableDataBlock("admin", "database_permission", tableData);
-				initRecordBlock(&recordBlockForNewDatabase, tableData[2]);
-				memcpy(recordBlockForNewDatabase.data, &userID, sizeof(userID));
-				memcpy(recordBlockForNewDatabase.data + sizeof(userID), &databaseID, sizeof(databaseID));
-				insertIntoDatabaseTable("admin", "database_permission", &recordBlockForNewDatabase);
-				
-				createDatabase(databaseName);
-				
-				delRecordBlock(&recordBlockForNewDatabase);
-				return 1;
-			}
-			
-			delRecordBlockVector(&recordBlockVector);		
-		}
+		statement++;
+	}
+	while (length < 15 && isalpha((unsigned char)statement[length]))
+	{
+		keyword[length] = statement[length];
+		length++;
 	}
+	keyword[length] = '\0';
 	
-	return 0;
+	if (strcasecmp(keyword, "SELECT") == 0)
+	{
+		return STATEMENT_SELECT;
+	}
+	else if (strcasecmp(keyword, "INSERT") == 0)
+	{
+		return STATEMENT_INSERT;
+	}
+	else if (strcasecmp(keyword, "UPDATE") == 0)
+	{
+		return STATEMENT_UPDATE;
+	}
+	else if (strcasecmp(keyword, "DELETE") == 0)
+	{
+		return STATEMENT_DELETE;
+	}
+	else if (strcasecmp(keyword, "CREATE") == 0)
+	{
+		return STATEMENT_CREATE;
+	}
+	else if (strcasecmp(keyword, "DROP") == 0)
+	{
+		return STATEMENT_DROP;
+	}
+	else if (strcasecmp(keyword, "USE") == 0)
+	{
+		return STATEMENT_USE;
+	}
+	else if (strcasecmp(keyword, "GRANT") == 0)
+	{
+		return STATEMENT_GRANT;
+	}
+	else if (strcasecmp(keyword, "BEGIN") == 0 || strcasecmp(keyword, "COMMIT") == 0 || strcasecmp(keyword, "ROLLBACK") == 0)
+	{
+		return STATEMENT_TRANSACTION;
+	}
+	else if (
+		strcasecmp(keyword, "ANALYZE") == 0 || strcasecmp(keyword, "VACUUM") == 0 || strcasecmp(keyword, "COMPRESS") == 0 || 
+		strcasecmp(keyword, "BACKUP") == 0 || strcasecmp(keyword, "DUMP") == 0
+	)
+	{
+		return STATEMENT_MAINTENANCE;
+	}
+	else if (strcasecmp(keyword, "SHOW") == 0)
+	{
+		return STATEMENT_SHOW;
+	}
+	return STATEMENT_OTHER;
 }
 
-int grantPermissionUserOnDatabase(ParsedStringQueue **queue)
+int appendStatsRow(char name[][64], long long int value[], int rowAmount, const char *metric, long long int metricValue)
+{
+	snprintf(name[rowAmount], 64, "%s", metric);
+	value[rowAmount] = metricValue;
+	return rowAmount + 1;
+}
+
+int appendLatencyStatsRows(
+	char name[][64], long long int value[], int rowAmount, const char *type, unsigned long long int histogram[], 
+	unsigned long long int amount, unsigned long long int failed, unsigned long long int latencyMax
+)
+{
+	char metric[64];
+	sprintf(metric, "%s_count", type);
+	rowAmount = appendStatsRow(name, value, rowAmount, metric, amount);
+	sprintf(metric, "%s_failed", type);
+	rowAmount = appendStatsRow(name, value, rowAmount, metric, failed);
+	sprintf(metric, "%s_p50_us", type);
+	rowAmount = appendStatsRow(name, value, rowAmount, metric, latencyPercentile(histogram, amount, latencyMax, 0.5));
+	sprintf(metric, "%s_p99_us", type);
+	rowAmount = appendStatsRow(name, value, rowAmount, metric, latencyPercentile(histogram, amount, latencyMax, 0.99));
+	sprintf(metric, "%s_p999_us", type);
+	rowAmount = appendStatsRow(name, value, rowAmount, metric, latencyPercentile(histogram, amount, latencyMax, 0.999));
+	sprintf(metric, "%s_max_us", type);
+	return appendStatsRow(name, value, rowAmount, metric, latencyMax);
+}
+
+int showStatsScript(ParsedStringQueue **queue, int fileDescriptor, char message[])
 {
-	if (*queue == NULL)
+	if (*queue == NULL || strcasecmp((*queue)->parsedString, "STATS") != 0)
 	{
 		return 0;
 	}
+	popParsedStringQueue(queue);
 	
-	char databaseName[64];
-	memset(databaseName, 0, sizeof(databaseName));
-	strcpy(databaseName, (*queue)->parsedString);
-	convertToLower(databaseName, strlen(databaseName));
-	
-	RecordBlockVector recordBlockVector;
-	initRecordBlockVector(&recordBlockVector);
-	Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
-	int attributeTotal = 0;
-	int recordBlockSize = 0;
-		
-	selectReadTable("admin", "database", &recordBlockVector, attribute, &attributeTotal, &recordBlockSize, "name", databaseName);
+	ThreadStats *total = malloc(sizeof(ThreadStats));
+	unsigned long long int *allLatency = calloc(__LATENCY_HISTOGRAM_BUCKETS, sizeof(unsigned long long int));
+	int rowCapacity = 16 + (STATEMENT_TYPE_AMOUNT + 1) * 6;
+	char (*name)[64] = malloc(sizeof(*name) * rowCapacity);
+	long long int *value = malloc(sizeof(long long int) * rowCapacity);
+	collectServerStats(total);
 	
-	popParsedStringQueue(queue);
-	if (*queue == NULL || strcasecmp((*queue)->parsedString, "INTO") != 0 || recordBlockVector.size != 1)
+	unsigned long long int allAmount = 0;
+	unsigned long long int allFailed = 0;
+	unsigned long long int allMax = 0;
+	for (int type = 0; type < STATEMENT_TYPE_AMOUNT; type++)
 	{
-		return 0;
+		allAmount += total->statement[type];
+		allFailed += total->failed[type];
+		allMax = total->latencyMax[type] > allMax ? total->latencyMax[type] : allMax;
+		for (int bucket = 0; bucket < __LATENCY_HISTOGRAM_BUCKETS; bucket++)
+		{
+			allLatency[bucket] += total->latency[type][bucket];
+		}
 	}
-	popParsedStringQueue(queue);
-	
-	int databaseID = -1;
-	memcpy(&databaseID, recordBlockVector.record[0].data, sizeof(databaseID));
-	delRecordBlockVector(&recordBlockVector);
 	
-	if (*queue == NULL)
+	unsigned long long int cacheLookup = total->resultCacheHit + total->resultCacheMiss;
+	int rowAmount = 0;
+	rowAmount = appendStatsRow(name, value, rowAmount, "connections_active", total->connectionOpened - total->connectionClosed);
+	rowAmount = appendStatsRow(name, value, rowAmount, "connections_total", total->connectionOpened);
+	rowAmount = appendStatsRow(name, value, rowAmount, "bytes_sent", total->bytesSent);
+	rowAmount = appendStatsRow(name, value, rowAmount, "rows_scanned", total->rowsScanned);
+	rowAmount = appendStatsRow(name, value, rowAmount, "bytes_scanned", total->bytesScanned);
+	rowAmount = appendStatsRow(name, value, rowAmount, "result_cache_hits", total->resultCacheHit);
+	rowAmount = appendStatsRow(name, value, rowAmount, "result_cache_misses", total->resultCacheMiss);
+	rowAmount = appendStatsRow(
+		name, value, rowAmount, "result_cache_hit_percent", cacheLookup > 0 ? total->resultCacheHit * 100 / cacheLookup : 0
+	);
+	rowAmount = appendLatencyStatsRows(name, value, rowAmount, "all", allLatency, allAmount, allFailed, allMax);
+	for (int type = 0; type < STATEMENT_TYPE_AMOUNT; type++)
 	{
-		return 0;
+		if (total->statement[type] > 0)
+		{
+			rowAmount = appendLatencyStatsRows(
+				name, value, rowAmount, statementTypeName[type], total->latency[type], total->statement[type], 
+				total->failed[type], total->latencyMax[type]
+			);
+		}
 	}
 	
-	char username[64];
-	memset(username, 0, sizeof(username));
-	strcpy(username, (*queue)->parsedString);
+	Attribute attribute[2];
+	memset(attribute, 0, sizeof(attribute));
+	strcpy(attribute[0].attributeName, "metric");
+	attribute[0].type = STRING;
+	attribute[0].size = 64;
+	strcpy(attribute[1].attributeName, "value");
+	attribute[1].type = LONG;
+	attribute[1].size = sizeof(long long int);
+	int selectedAttribute[2] = {0, 1};
 	
-	initRecordBlockVector(&recordBlockVector);
-	attributeTotal = 0;
-	recordBlockSize = 0;
-	selectReadTable("admin", "account", &recordBlockVector, attribute, &attributeTotal, &recordBlockSize, "username", username);
+	ResultWriter writer;
+	initResultWriter(&writer, fileDescriptor, message, attribute, 2, selectedAttribute, 2);
+	writeResultHeader(&writer, rowAmount);
 	
-	if (recordBlockVector.size == 1)
-	{
-		int accountID = 0;
-		memcpy(&accountID, recordBlockVector.record[0].data, sizeof(accountID));
-		
-		RecordBlock newRecordPermission;
-		int recordData[2] = {accountID, databaseID};
-		initRecordBlock(&newRecordPermission, sizeof(recordData));
-		memcpy(newRecordPermission.data, recordData, sizeof(recordData));
-		
-		insertIntoDatabaseTable("admin", "database_permission", &newRecordPermission);
-		
-		delRecordBlock(&newRecordPermission);
-	}
-	else
+	char record[64 + sizeof(long long int)];
+	for (int i = 0; i < rowAmount; i++)
 	{
-		delRecordBlockVector(&recordBlockVector);
-		return 0;
+		memset(record, 0, sizeof(record));
+		strcpy(record, name[i]);
+		memcpy(record + 64, &value[i], sizeof(long long int));
+		writeResultRecord(&writer, record);
 	}
 	
-	delRecordBlockVector(&recordBlockVector);
-	
+	free(value);
+	free(name);
+	free(allLatency);
+	free(total);
 	return 1;
 }
 
-int useDatabaseScript(ParsedStringQueue **queue, AccountData *clientAccount)
+void writeStatsPrometheus(FILE *file, ThreadStats *total)
 {
-	clientAccount->openningDatabase = 0;
-
-	if (*queue != NULL) 
+	fprintf(file, "# TYPE %sconnections_active gauge\n", __STATS_METRIC_PREFIX);
+	fprintf(file, "%sconnections_active %llu\n", __STATS_METRIC_PREFIX, total->connectionOpened - total->connectionClosed);
+	fprintf(file, "# TYPE %sconnections_total counter\n", __STATS_METRIC_PREFIX);
+	fprintf(file, "%sconnections_total %llu\n", __STATS_METRIC_PREFIX, total->connectionOpened);
+	fprintf(file, "# TYPE %sbytes_sent_total counter\n", __STATS_METRIC_PREFIX);
+	fprintf(file, "%sbytes_sent_total %llu\n", __STATS_METRIC_PREFIX, total->bytesSent);
+	fprintf(file, "# TYPE %srows_scanned_total counter\n", __STATS_METRIC_PREFIX);
+	fprintf(file, "%srows_scanned_total %llu\n", __STATS_METRIC_PREFIX, total->rowsScanned);
+	fprintf(file, "# TYPE %sbytes_scanned_total counter\n", __STATS_METRIC_PREFIX);
+	fprintf(file, "%sbytes_scanned_total %llu\n", __STATS_METRIC_PREFIX, total->bytesScanned);
+	fprintf(file, "# TYPE %sresult_cache_lookups_total counter\n", __STATS_METRIC_PREFIX);
+	fprintf(file, "%sresult_cache_lookups_total{result=\"hit\"} %llu\n", __STATS_METRIC_PREFIX, total->resultCacheHit);
+	fprintf(file, "%sresult_cache_lookups_total{result=\"miss\"} %llu\n", __STATS_METRIC_PREFIX, total->resultCacheMiss);
+	
+	fprintf(file, "# TYPE %sstatements_failed_total counter\n", __STATS_METRIC_PREFIX);
+	for (int type = 0; type < STATEMENT_TYPE_AMOUNT; type++)
 	{
-		char databaseName[64];
-		memset(databaseName, 0, sizeof(databaseName));
-		strcpy(databaseName, (*queue)->parsedString);
-		convertToLower(databaseName, strlen(databaseName));
-		
-		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
-		RecordBlockVector recordBlockVector;
-		initRecordBlockVector(&recordBlockVector);
-		int attributeTotal = 0;
-		int recordBlockSize = 0;
-		selectReadTable("admin", "database", &recordBlockVector, attribute, &attributeTotal, &recordBlockSize, "name", databaseName);
-
-		if (recordBlockVector.size == 1)
+		fprintf(file, "%sstatements_failed_total{type=\"%s\"} %llu\n", __STATS_METRIC_PREFIX, statementTypeName[type], total->failed[type]);
+	}
+	
+	double quantile[3] = {0.5, 0.99, 0.999};
+	fprintf(file, "# TYPE %sstatement_duration_seconds summary\n", __STATS_METRIC_PREFIX);
+	for (int type = 0; type < STATEMENT_TYPE_AMOUNT; type++)
+	{
+		for (int i = 0; i < 3; i++)
 		{
-			if (clientAccount->id == 0)
-			{
-				clientAccount->openningDatabase = 1;
-				memcpy(clientAccount->databaseName, databaseName, sizeof(databaseName));
-			}
-			else
-			{
-				int databaseID = 0;
-				memcpy(&databaseID, recordBlockVector.record[0].data, sizeof(databaseID));
-				delRecordBlockVector(&recordBlockVector);
-				
-				initRecordBlockVector(&recordBlockVector);
-				attributeTotal = 0;
-				recordBlockSize = 0;
-				selectReadTable(
-					"admin", "database_permission", &recordBlockVector, 
-					attribute, &attributeTotal, &recordBlockSize, "accountid", &clientAccount->id
-				);
-				
-				int pointerOffsetForDatabaseID = 0;
-				for (int i = 0; i < attributeTotal; i++)
-				{
-					if (strcmp(attribute[i].attributeName, "databaseid") == 0)
-					{
-						break;
-					}
-					pointerOffsetForDatabaseID += attribute[i].size;
-				}
-				for (int i = 0; i < recordBlockVector.size; i++)
-				{
-					if (memcmp(recordBlockVector.record[i].data + pointerOffsetForDatabaseID, &databaseID, attribute[1].size) == 0)
-					{
-						clientAccount->openningDatabase = 1;
-						memcpy(clientAccount->databaseName, databaseName, sizeof(databaseName));
-						break;
-					}
-				}
-			}
+			fprintf(file, "%sstatement_duration_seconds{type=\"%s\",quantile=\"%g\"} %.6f\n", 
+				__STATS_METRIC_PREFIX, statementTypeName[type], quantile[i], 
+				latencyPercentile(total->latency[type], total->statement[type], total->latencyMax[type], quantile[i]) / 1000000.0
+			);
 		}
-
-		delRecordBlockVector(&recordBlockVector);
+		fprintf(file, "%sstatement_duration_seconds_sum{type=\"%s\"} %.6f\n", 
+			__STATS_METRIC_PREFIX, statementTypeName[type], total->latencySum[type] / 1000000.0
+		);
+		fprintf(file, "%sstatement_duration_seconds_count{type=\"%s\"} %llu\n", 
+			__STATS_METRIC_PREFIX, statementTypeName[type], total->statement[type]
+		);
 	}
+}
+
+int dumpStatsFile(char path[])
+{
+	char tempPath[1024];
+	strcpy(tempPath, path);
+	strcat(tempPath, " temp");
 	
-	if (clientAccount->openningDatabase == 1)
+	FILE *file = fopen(tempPath, "w");
+	if (file == NULL)
 	{
-		return 1;
+		return 0;
 	}
-	else
+	
+	ThreadStats *total = malloc(sizeof(ThreadStats));
+	collectServerStats(total);
+	writeStatsPrometheus(file, total);
+	free(total);
+	
+	if (fclose(file) != 0)
 	{
+		remove(tempPath);
 		return 0;
 	}
+	return rename(tempPath, path) == 0;
 }
 
-int createTableScript(ParsedStringQueue **queue, AccountData *clientAccountData)
+void *statsDumpWriter(void *argument)
 {
-	if (*queue == NULL || clientAccountData->openningDatabase != 1)
+	(void)argument;
+	while (1)
 	{
-		return 0;
+		sleep(statsRegistry.dumpInterval);
+		dumpStatsFile(__STATS_DUMP_PATH);
 	}
-	char tableName[64];
-	strcpy(tableName, (*queue)->parsedString);
-	convertToLower(tableName, strlen(tableName));
-	
-	if (isStringAlphaNumeric(tableName) == 1)
+	return NULL;
+}
+
+void initStatsDump(int interval)
+{
+	statsRegistry.dumpInterval = interval;
+	if (interval > 0 && pthread_create(&statsRegistry.dumpWriter, NULL, statsDumpWriter, NULL) == 0)
 	{
-		popParsedStringQueue(queue);
-		
-		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
-		int attributeAmount = 0;
-		if (*queue != NULL && parseAttribute(attribute, &attributeAmount, (*queue)->parsedString) == 1)
-		{
-			if (createTable(clientAccountData->databaseName, tableName, attributeAmount, attribute) == 1)
-			{
-				return 1;
-			}
-		}
+		pthread_detach(statsRegistry.dumpWriter);
 	}
-	return 0;
 }
 
-int deleteFromDatabaseTable(char database[], char table[], char *whereAttr, void *whereValue)
-{	
-	char filePath[1024];
-	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
-	FILE *tableFile = fopen(filePath, "r+");
-	
-	if (tableFile == NULL)
+void copyIntoAuditLog(unsigned long long int position, const char *data, size_t size)
+{
+	size_t offset = position & (__AUDIT_LOG_BUFFER - 1);
+	size_t first = __AUDIT_LOG_BUFFER - offset < size ? __AUDIT_LOG_BUFFER - offset : size;
+	memcpy(auditLog.ring + offset, data, first);
+	memcpy(auditLog.ring, data + first, size - first);
+}
+
+void copyFromAuditLog(unsigned long long int position, char *data, size_t size)
+{
+	size_t offset = position & (__AUDIT_LOG_BUFFER - 1);
+	size_t first = __AUDIT_LOG_BUFFER - offset < size ? __AUDIT_LOG_BUFFER - offset : size;
+	memcpy(data, auditLog.ring + offset, first);
+	memcpy(data + first, auditLog.ring, size - first);
+}
+
+int redactAuditStatement(char statement[], int statementLength, size_t size)
+{
+	char *identified = strcasestr(statement, "IDENTIFIED BY");
+	if (identified == NULL)
 	{
-		return -1;
+		return statementLength;
 	}
 	
-	int tableData[3];
-	fread(tableData, sizeof(tableData[0]), 3, tableFile);
-	
-	AttributeBlock attributesBlock[tableData[0]];
-	fread(attributesBlock, sizeof(attributesBlock[0]), tableData[0], tableFile);
-	
-	int deleted = 0;
-	
-	if (whereAttr == NULL)
+	size_t keptLength = identified - statement + strlen("IDENTIFIED BY");
+	size_t maskLength = strlen(" ***");
+	if (keptLength + maskLength >= size)
 	{
-		fclose(tableFile);
-		
-		tableFile = fopen(filePath, "w");
-		
-		fwrite(tableData, sizeof(tableData[0]), 3, tableFile);
-		fwrite(attributesBlock, sizeof(attributesBlock[0]), tableData[0], tableFile);
+		maskLength = size - 1 - keptLength;
 	}
-	else
+	memcpy(statement + keptLength, " ***", maskLength);
+	statement[keptLength + maskLength] = '\0';
+	return keptLength + maskLength;
+}
+
+void initAuditLogEntry(AuditLogEntry *entry, LogEntryKind kind, AccountData *account, int session, int succeeded, long long int elapsed)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_REALTIME, &now);
+	
+	entry->kind = kind;
+	entry->session = session;
+	entry->account = account->id;
+	entry->succeeded = succeeded;
+	entry->second = now.tv_sec;
+	entry->nanosecond = now.tv_nsec;
+	entry->elapsed = elapsed;
+	memset(entry->database, 0, sizeof(entry->database));
+	if (account->openningDatabase == 1)
 	{
-		int offset = 0;
-		int attributeIndex = -1;
-		
-		for (int i = 0; i < tableData[0]; i++)
-		{
-			if (strcmp(attributesBlock[i].attribute.attributeName, whereAttr) == 0)
-			{
-				attributeIndex = i;
-				break;
-			}
-			offset += attributesBlock[i].attribute.size;
-		}
-		
-		if (attributeIndex != -1)
-		{
-			RecordBlock reader, empty;
-			initRecordBlock(&reader, tableData[2]);
-			initRecordBlock(&empty, tableData[2]);
-			
-			empty.flag = EMPTY;
-			
-			size_t recordBlockMemorySize = sizeOfRecordBlock(&reader);
-			
-			while(freadRecordBlock(&reader, tableFile) == 1)
-			{
-				if (memcmp(reader.data + offset, whereValue, attributesBlock[attributeIndex].attribute.size) == 0)  
-				{
-					fseek(tableFile, -recordBlockMemorySize, SEEK_CUR); 
-					fwriteRecordBlock(&empty, tableFile);
-					
-					deleted++;
-				}
-			}
-			
-			delRecordBlock(&reader);
-			delRecordBlock(&empty);
-		}
+		strcpy(entry->database, account->databaseName);
 	}
-	
-	fclose(tableFile);
-	
-	return deleted;
 }
 
-int deleteFromTableScript(ParsedStringQueue **queue, AccountData *clientAccount)
+void pushAuditLogEntry(AuditLogEntry *entry, const char *payload, int payloadLength)
 {
-	if (clientAccount->openningDatabase == 1 && *queue != NULL)
+	entry->size = sizeof(AuditLogEntry) + payloadLength;
+	
+	unsigned long long int head = auditLog.head;
+	unsigned long long int tail = __atomic_load_n(&auditLog.tail, __ATOMIC_ACQUIRE);
+	if (__AUDIT_LOG_BUFFER - (head - tail) < (unsigned long long int)entry->size)
 	{
-		char tableName[64];
-		memcpy(tableName, (*queue)->parsedString, sizeof(tableName));
-		convertToLower(tableName, strlen(tableName));
+		__atomic_add_fetch(&auditLog.dropped, 1, __ATOMIC_RELAXED);
+		return;
+	}
 	
-		popParsedStringQueue(queue);
-		
-		int returnValue = -1;
-		
-		int totalAttribute = 0;
-		int recordBlockSize = 0;
-		Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
-		
-		if (
-			readTableAttribute(
-				clientAccount->databaseName, tableName, &totalAttribute, attribute, &recordBlockSize
-			) == 1
-		)
-		{
-			if (*queue != NULL)
-			{
-				if (strcasecmp((*queue)->parsedString, "WHERE") == 0)
-				{
-					popParsedStringQueue(queue);
-					
-					if (*queue == NULL)
-					{
-						return -1;
-					}
-					
-					char whereAttribute[64];
-					void *deletedValue = NULL;
-					
-					if (parseAttributeAndGetValueFromString(whereAttribute, attribute, totalAttribute, &deletedValue, (*queue)->parsedString) == 1)
-					{
-						
-						returnValue = deleteFromDatabaseTable(
-							clientAccount->databaseName, tableName,
-							whereAttribute, deletedValue
-						);
-						
-						free(deletedValue);
-					}
-					else
-					{
-						returnValue = 0;
-					}
-				}
-			}
-			else
-			{
-				return deleteFromDatabaseTable(clientAccount->databaseName, tableName, NULL, NULL);
-			}
-		}
+	copyIntoAuditLog(head, (char *)entry, sizeof(AuditLogEntry));
+	copyIntoAuditLog(head + sizeof(AuditLogEntry), payload, payloadLength);
+	__atomic_store_n(&auditLog.head, head + entry->size, __ATOMIC_RELEASE);
+}
 
-		return returnValue;
+void appendAuditLog(AccountData *account, int session, char statement[], int statementLength, int succeeded, long long int elapsed)
+{
+	if (auditLog.ring == NULL)
+	{
+		return;
 	}
-	return -1;
+	
+	AuditLogEntry entry;
+	initAuditLogEntry(&entry, AUDIT_LOG_ENTRY, account, session, succeeded, elapsed);
+	pushAuditLogEntry(&entry, statement, statementLength);
 }
 
-int dropDatabaseScript(ParsedStringQueue **queue, AccountData *clientAccount)
+int isSlowQueryLogEnabled()
 {
-	if (clientAccount->openningDatabase == 1 && strcasecmp(clientAccount->databaseName, (*queue)->parsedString) == 0)
+	return auditLog.ring != NULL && (auditLog.slowQueryMicroseconds > 0 || auditLog.slowQueryRows > 0);
+}
+
+void appendSlowQueryLog(
+	AccountData *account, int session, char statement[], int statementLength, int succeeded, long long int elapsed, 
+	QueryProfile *profile
+)
+{
+	long long int rowsScanned = 0;
+	long long int rowsReturned = 0;
+	for (int i = 0; i < profile->operatorAmount; i++)
 	{
-		char databaseName[64];
-		memset(databaseName, 0, sizeof(databaseName));
-		strcpy(databaseName, (*queue)->parsedString);
-		convertToLower(databaseName, strlen(databaseName));
-		
-		char filePath[1024];
-		sprintf(filePath, "%s/%s", __DATABASE_ROOT, databaseName); 
-		
-		DIR *databaseDirectory = opendir(filePath);
-		if (databaseDirectory != NULL)
-		{
-			rmdir(filePath);
-			
-			Attribute attribute[__MAX_ATTRIBUTE_ON_TABLE];
-			RecordBlockVector records;
-			int attributeTotal = 0;
-			int recordBlockSize = 0;
-			initRecordBlockVector(&records);
-			selectReadTable(
-				"admin", "database", &records, attribute, &attributeTotal, 
-				&recordBlockSize , "name", databaseName
-			);
-			
-			int result = 0;
-			
-			if (records.size == 1)
-			{
-				int databaseID = 0;
-				memcpy(&databaseID, records.record[0].data, sizeof(databaseID));
-				
-				result = 1;
-				
-				deleteFromDatabaseTable("admin", "database", "name", databaseName);
-				deleteFromDatabaseTable("admin", "database_permission", "databaseid", &databaseID);
-				
-				clientAccount->openningDatabase = 0;
-			}
-			
-			delRecordBlockVector(&records);
-			
-			return result;
-		}
-		else
+		if (strcmp(profile->operator[i].name, "scan") == 0 || strcmp(profile->operator[i].name, "delete") == 0)
 		{
-			return 0;
+			rowsScanned += profile->operator[i].rowsIn;
 		}
+		rowsReturned = profile->operator[i].rowsOut;
 	}
-	else
+	
+	if (
+		(auditLog.slowQueryMicroseconds <= 0 || elapsed < auditLog.slowQueryMicroseconds) && 
+		(auditLog.slowQueryRows <= 0 || rowsScanned < auditLog.slowQueryRows)
+	)
 	{
-		return 0;
+		return;
+	}
+	
+	AuditLogEntry entry;
+	initAuditLogEntry(&entry, SLOW_QUERY_ENTRY, account, session, succeeded, elapsed);
+	
+	time_t second = entry.second;
+	struct tm localTime;
+	localtime_r(&second, &localTime);
+	
+	char text[__DATA_BUFFER * 4];
+	int textLength = sprintf(text, "%04d-%02d-%02d %02d:%02d:%02d.%06ld user=%s session=%d database=%s status=%s elapsed_us=%lld rows_scanned=%lld rows_returned=%lld statement=",
+		localTime.tm_year + 1900,
+		localTime.tm_mon + 1,
+		localTime.tm_mday,
+		localTime.tm_hour,
+		localTime.tm_min,
+		localTime.tm_sec,
+		entry.nanosecond / 1000,
+		account->username[0] != 0 ? account->username : "-",
+		session,
+		entry.database[0] != 0 ? entry.database : "-",
+		succeeded == 1 ? "ok" : "failed",
+		elapsed,
+		rowsScanned,
+		rowsReturned
+	);
+	for (int i = 0; i < statementLength; i++)
+	{
+		text[textLength++] = statement[i] == '\n' || statement[i] == '\r' ? ' ' : statement[i];
+	}
+	text[textLength++] = '\n';
+	
+	for (int i = 0; i < profile->operatorAmount; i++)
+	{
+		QueryOperator *operator = &profile->operator[i];
+		textLength += sprintf(text + textLength, "    %s time_us=%lld rows_in=%lld rows_out=%lld skipped=%lld bytes=%lld allocs=%lld%s%s\n",
+			operator->name,
+			operator->elapsed,
+			operator->rowsIn,
+			operator->rowsOut,
+			operator->skipped,
+			operator->bytes,
+			operator->allocations,
+			operator->detail[0] != '\0' ? " plan=" : "",
+			operator->detail
+		);
 	}
+	pushAuditLogEntry(&entry, text, textLength);
 }
 
-int dropTableScript(ParsedStringQueue **queue, AccountData *clientAccount)
+void openLogFile(LogFile *log)
 {
-	if (clientAccount->openningDatabase == 1)
+	log->file = fopen(log->path, "a");
+	log->fileSize = 0;
+	if (log->file != NULL)
 	{
-		convertToLower((*queue)->parsedString, strlen((*queue)->parsedString));
-		
-		char filePath[1024];
-		sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, clientAccount->databaseName, (*queue)->parsedString);
-		return remove(filePath);
+		fseek(log->file, 0, SEEK_END);
+		log->fileSize = ftell(log->file);
 	}
-	
-	return -1;
 }
 
-int dropColumnScript(ParsedStringQueue **queue,  AccountData *clientAccount)
+void rotateLogFile(LogFile *log)
 {
-	if (*queue == NULL || clientAccount->openningDatabase == 0)
+	if (log->file != NULL)
 	{
-		return 0;
+		fclose(log->file);
 	}
 	
-	char columnName[__MAX_ATTRIBUTE_NAME_LENGTH];
-	memset(columnName, 0, sizeof(columnName));
-	strcpy(columnName, (*queue)->parsedString);
-	convertToLower(columnName, strlen(columnName));
-	
-	popParsedStringQueue(queue);
+	char sourcePath[1024];
+	char targetPath[1024];
+	for (int i = __AUDIT_LOG_FILES - 1; i >= 1; i--)
+	{
+		sprintf(sourcePath, "%s.%d", log->path, i);
+		sprintf(targetPath, "%s.%d", log->path, i + 1);
+		rename(sourcePath, targetPath);
+	}
+	sprintf(targetPath, "%s.1", log->path);
+	rename(log->path, targetPath);
 	
-	if (*queue == NULL || strcasecmp((*queue)->parsedString, "FROM") != 0)
+	openLogFile(log);
+}
+
+void flushLogFile(LogFile *log)
+{
+	if (log->writeSize == 0)
 	{
-		return 0;
+		return;
 	}
 	
-	popParsedStringQueue(queue);
-		
-	if (*queue == NULL)
+	if (log->file == NULL)
 	{
-		return 0;
+		openLogFile(log);
+	}
+	else if (log->fileSize > 0 && log->fileSize + (long long int)log->writeSize > __AUDIT_LOG_MAX_BYTES)
+	{
+		rotateLogFile(log);
 	}
 	
-	char tableName[64];
-	strcpy(tableName, (*queue)->parsedString);
-	convertToLower(tableName, strlen(tableName));
+	if (log->file != NULL)
+	{
+		fwrite(log->writeBuffer, 1, log->writeSize, log->file);
+		fflush(log->file);
+		log->fileSize += log->writeSize;
+	}
+	log->writeSize = 0;
+}
 
-	char filePath[1024];
-	char filePathForTemp[1024];
-	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, clientAccount->databaseName, tableName);
-	strcpy(filePathForTemp, filePath);
-	strcat(filePathForTemp, " temp");
-	FILE *tableFile = fopen(filePath, "r");
-	
-	if (tableFile != NULL)
+char *reserveLogFile(LogFile *log, size_t size)
+{
+	if (__AUDIT_LOG_WRITE_BUFFER - log->writeSize < size)
 	{
-		int tableData[3];
-		fread(tableData, sizeof(tableData[0]), 3, tableFile);
-		
-		AttributeBlock attributesBlock[tableData[0]];
-		fread(attributesBlock, sizeof(attributesBlock[0]), tableData[0], tableFile);
-		
-		int deletedAttributeIndex = -1;
-		int deletedAttributeDataOffset = 0;
-		int newSize = 0;
-		
-		for (int i = 0; i < tableData[0]; i++)
-		{
-			if (strcmp(attributesBlock[i].attribute.attributeName, columnName) == 0)
-			{
-				deletedAttributeIndex = i;
-				deletedAttributeDataOffset = newSize;
-			}
-			else
-			{
-				newSize += attributesBlock[i].attribute.size;
-			}
-		}
-		
-		int returnValue = 0;
-		
-		if (deletedAttributeIndex != -1)
-		{
-			FILE *newFile = fopen(filePathForTemp, "w");
-			int newTableData[3] = {tableData[0] - 1, tableData[1], newSize};
-			fwrite(newTableData, sizeof(int), 3, newFile);
-			
-			if (deletedAttributeIndex != 0)
-			{
-				fwrite(attributesBlock, sizeof(attributesBlock[0]), deletedAttributeIndex, newFile);
-			}
-			if (deletedAttributeIndex != tableData[0] - 1)
-			{
-				fwrite(
-					&attributesBlock[deletedAttributeIndex + 1], sizeof(attributesBlock[0]), 
-					tableData[0] - 1 - deletedAttributeIndex, newFile
-				);
-			}
-			
-			RecordBlock readFromOldFile;
-			RecordBlock writeToNewFile;
-			initRecordBlock(&readFromOldFile, tableData[2]);
-			initRecordBlock(&writeToNewFile, newSize);
-			
-			int postDeletedAttributeOffsetForWriteToNewFile = deletedAttributeDataOffset + attributesBlock[deletedAttributeIndex].attribute.size;
-			int postDeletedAttributeSizeForWriteToNewFile = tableData[2] - postDeletedAttributeOffsetForWriteToNewFile; 
-			
-			while(freadRecordBlock(&readFromOldFile, tableFile) == 1)
-			{
-				if (readFromOldFile.flag == FILLED)
-				{
-					if (deletedAttributeIndex != 0)
-					{
-						memcpy(writeToNewFile.data, readFromOldFile.data, deletedAttributeDataOffset);
-					}
-					if (deletedAttributeIndex != tableData[0] - 1)
-					{
-						memcpy(
-							writeToNewFile.data + deletedAttributeDataOffset, 
-							readFromOldFile.data + postDeletedAttributeOffsetForWriteToNewFile, 
-							postDeletedAttributeSizeForWriteToNewFile
-						);
-					}
-					
-					fwriteRecordBlock(&writeToNewFile, newFile);
-				}
-			}
-			
-			delRecordBlock(&readFromOldFile);
-			delRecordBlock(&writeToNewFile);
-			
-			fclose(newFile);
-			
-			remove(filePath);
-			rename(filePathForTemp, filePath);
-		}
-		
-		fclose(tableFile);
-		return 1;
-	}	
-	return 0;
+		flushLogFile(log);
+	}
+	return log->writeBuffer + log->writeSize;
 }
 
-int updateTable(char database[], char table[], char setAttr[], void *setValue, char whereAttr[], void *whereValue)
+void formatAuditLogEntry(AuditLogEntry *entry, unsigned long long int payloadPosition)
 {
-	char filePath[1024];
-	sprintf(filePath, "%s/%s/%s", __DATABASE_ROOT, database, table);
-	FILE *tableFile = fopen(filePath, "r");
+	int payloadLength = entry->size - sizeof(AuditLogEntry);
+	if (entry->kind == SLOW_QUERY_ENTRY)
+	{
+		copyFromAuditLog(payloadPosition, reserveLogFile(&auditLog.slowQuery, payloadLength), payloadLength);
+		auditLog.slowQuery.writeSize += payloadLength;
+		return;
+	}
 	
-	if (tableFile != NULL)
+	time_t second = entry->second;
+	struct tm localTime;
+	localtime_r(&second, &localTime);
+	
+	char *line = reserveLogFile(&auditLog.audit, (size_t)payloadLength + 512);
+	int lineLength = sprintf(line, "%04d-%02d-%02d %02d:%02d:%02d.%06ld session=%d account=%d database=%s status=%s elapsed_us=%lld statement=",
+		localTime.tm_year + 1900,
+		localTime.tm_mon + 1,
+		localTime.tm_mday,
+		localTime.tm_hour,
+		localTime.tm_min,
+		localTime.tm_sec,
+		entry->nanosecond / 1000,
+		entry->session,
+		entry->account,
+		entry->database[0] != 0 ? entry->database : "-",
+		entry->succeeded == 1 ? "ok" : "failed",
+		entry->elapsed
+	);
+	
+	copyFromAuditLog(payloadPosition, line + lineLength, payloadLength);
+	for (int i = 0; i < payloadLength; i++)
 	{
-		fclose(tableFile);
-		
-		int returnValue = -1;
-		
-		int totalAttribute = 0;
-		int recordBlockSize = 0;
-		Attribute tableAttribute[__MAX_ATTRIBUTE_ON_TABLE];
-
-		RecordBlockVector effectedBlockRecords;
-		initRecordBlockVector(&effectedBlockRecords);
-				
-		if (
-			selectReadTable(
-				database, table, &effectedBlockRecords, tableAttribute, &totalAttribute, 
-				&recordBlockSize, whereAttr, whereValue
-			) == 1
-		)
+		if (line[lineLength + i] == '\n' || line[lineLength + i] == '\r')
 		{
-			int setAttributeIndex = -1;
-			int setAttributeOffset = 0;
-			
-			for (int i = 0; i < totalAttribute && setAttributeIndex == -1; i++)
-			{
-				if (strcasecmp(setAttr, tableAttribute[i].attributeName) == 0)
-				{
-					setAttributeIndex = i;
-				}
-				else
-				{
-					setAttributeOffset += tableAttribute[i].size;
-				}
-			}
-			
-			if (setAttributeIndex != -1)
-			{
-				deleteFromDatabaseTable(database, table, whereAttr, whereValue);
-				
-				for (int i = 0; i < effectedBlockRecords.size; i++)
-				{
-					memcpy(
-						getRecordBlockVector(&effectedBlockRecords)[i].data + setAttributeOffset, 
-						setValue, tableAttribute[setAttributeIndex].size
-					);
-					insertIntoDatabaseTable(database, table, &(getRecordBlockVector(&effectedBlockRecords)[i]));
-				}
-				returnValue = effectedBlockRecords.size;
-			}
+			line[lineLength + i] = ' ';
 		}
-		
-		delRecordBlockVector(&effectedBlockRecords);
-		
-		return returnValue;
 	}
-	return -1;
+	lineLength += payloadLength;
+	line[lineLength++] = '\n';
+	auditLog.audit.writeSize += lineLength;
+}
+
+unsigned long long int drainAuditLog()
+{
+	unsigned long long int tail = auditLog.tail;
+	unsigned long long int head = __atomic_load_n(&auditLog.head, __ATOMIC_ACQUIRE);
+	unsigned long long int drained = head - tail;
+	
+	while (tail != head)
+	{
+		AuditLogEntry entry;
+		copyFromAuditLog(tail, (char *)&entry, sizeof(entry));
+		formatAuditLogEntry(&entry, tail + sizeof(entry));
+		tail += entry.size;
+	}
+	__atomic_store_n(&auditLog.tail, tail, __ATOMIC_RELEASE);
+	
+	unsigned long long int dropped = __atomic_exchange_n(&auditLog.dropped, 0, __ATOMIC_RELAXED);
+	if (dropped > 0)
+	{
+		char *line = reserveLogFile(&auditLog.audit, 128);
+		auditLog.audit.writeSize += sprintf(line, "audit log buffer full, %llu entries dropped\n", dropped);
+	}
+	
+	flushLogFile(&auditLog.audit);
+	flushLogFile(&auditLog.slowQuery);
+	return drained;
 }
 
-int updateTableScript(ParsedStringQueue **queue, AccountData *clientAccount)
+void *auditLogWriter(void *argument)
 {
-	if (*queue != NULL && clientAccount->openningDatabase == 1)
+	(void)argument;
+	struct timespec interval;
+	interval.tv_sec = __AUDIT_LOG_FLUSH_MSEC / 1000;
+	interval.tv_nsec = (__AUDIT_LOG_FLUSH_MSEC % 1000) * 1000000L;
+	
+	while (1)
 	{
-		char tableName[64];
-		strcpy(tableName, (*queue)->parsedString);
-		convertToLower(tableName, strlen(tableName));
-				
-		popParsedStringQueue(queue);
-		
-		int returnValue = -1;
-		
-		if (*queue != NULL && strcasecmp((*queue)->parsedString, "SET") == 0)
+		if (drainAuditLog() < __AUDIT_LOG_BUFFER / 4)
 		{
-			popParsedStringQueue(queue);
-			
-			char setAttribute[64];
-			int totalAttribute = 0;
-			int recordBlockSize = 0;
-			Attribute tableAttribute[__MAX_ATTRIBUTE_ON_TABLE];
-			void *setValue = NULL;
-			if (
-				*queue != NULL &&
-				readTableAttribute(clientAccount->databaseName, tableName, &totalAttribute, tableAttribute, &recordBlockSize) == 1 &&
-				parseAttributeAndGetValueFromString(setAttribute, tableAttribute, totalAttribute, &setValue, (*queue)->parsedString) == 1
-			)
-			{
-				popParsedStringQueue(queue);
-				
-				if (*queue != NULL && strcasecmp((*queue)->parsedString, "WHERE") == 0)
-				{
-					popParsedStringQueue(queue);
-					
-					char whereAttribute[64];
-					void *whereValue = NULL;
-					
-					if (
-						*queue != NULL &&
-						parseAttributeAndGetValueFromString(whereAttribute, tableAttribute, totalAttribute, &whereValue, (*queue)->parsedString) == 1
-					)
-					{
-						returnValue = updateTable(clientAccount->databaseName, tableName, setAttribute, setValue, whereAttribute, whereValue);
-						free(whereValue);
-					}
-				} 
-				else if (*queue == NULL)
-				{
-					returnValue = updateTable(clientAccount->databaseName, tableName, setAttribute, setValue, NULL, NULL);
-				}
-				
-				
-				free(setValue);
-			}
-			
+			nanosleep(&interval, NULL);
 		}
-		
-		return returnValue;
 	}
-	return -1;
+	return NULL;
+}
+
+void initAuditLog(long long int slowQueryMilliseconds, long long int slowQueryRows)
+{
+	auditLog.ring = malloc(__AUDIT_LOG_BUFFER);
+	auditLog.head = 0;
+	auditLog.tail = 0;
+	auditLog.dropped = 0;
+	auditLog.slowQueryMicroseconds = slowQueryMilliseconds * 1000;
+	auditLog.slowQueryRows = slowQueryRows;
+	
+	auditLog.audit.path = __AUDIT_LOG_PATH;
+	auditLog.audit.writeBuffer = malloc(__AUDIT_LOG_WRITE_BUFFER);
+	auditLog.audit.writeSize = 0;
+	openLogFile(&auditLog.audit);
+	
+	auditLog.slowQuery.path = __SLOW_QUERY_LOG_PATH;
+	auditLog.slowQuery.writeBuffer = malloc(__AUDIT_LOG_WRITE_BUFFER);
+	auditLog.slowQuery.writeSize = 0;
+	auditLog.slowQuery.file = NULL;
+	
+	if (
+		auditLog.ring == NULL || auditLog.audit.writeBuffer == NULL || auditLog.slowQuery.writeBuffer == NULL || 
+		pthread_create(&auditLog.writer, NULL, auditLogWriter, NULL) != 0
+	)
+	{
+		free(auditLog.ring);
+		free(auditLog.audit.writeBuffer);
+		free(auditLog.slowQuery.writeBuffer);
+		auditLog.ring = NULL;
+		auditLog.audit.writeBuffer = NULL;
+		auditLog.slowQuery.writeBuffer = NULL;
+		return;
+	}
+	pthread_detach(auditLog.writer);
 }
 
 int main(int argc, char **argv) 
@@ -1878,7 +12459,7 @@ int main(int argc, char **argv)
 	int epollFileDescriptor = epoll_create(__MAX_CONNECTIONS + 1);
 	serverFileDescriptor = createTCPServerSocket(); 
 
-	AccountData clientAccountData[__MAX_CONNECTIONS];
+	AccountData clientAccountData[__MAX_SESSIONS];
 	memset(clientAccountData, 0, sizeof(clientAccountData));
 
 	if (serverFileDescriptor == -1) 
@@ -1889,13 +12470,69 @@ int main(int argc, char **argv)
 	setupEpollConnection(epollFileDescriptor, serverFileDescriptor, &epollEventNewConnection);
 
 	char message[__DATA_BUFFER];
+	char statement[__DATA_BUFFER];
+	int statementLength = 0;
+	struct timespec statementStart;
+	long long int statementElapsed = 0;
+	int statementSucceeded = 0;
+	int statsInterval = 0;
+	long long int slowQueryMilliseconds = 0;
+	long long int slowQueryRows = 0;
+	QueryProfile *statementProfile = malloc(sizeof(QueryProfile));
+	char restoreFrom[PATH_MAX];
+	memset(restoreFrom, 0, sizeof(restoreFrom));
 	
-	createDatabaseRoot();
+	for (int i = 1; i + 1 < argc; i += 2)
+	{
+		if (strcmp(argv[i], "--restore") == 0 && (realpath(argv[i + 1], restoreFrom) == NULL || isDatabaseBackup(restoreFrom) == 0))
+		{
+			fprintf(stderr, "Failed to restore from %s\n", argv[i + 1]);
+			return -1;
+		}
+		else if (strcmp(argv[i], "--stats-interval") == 0)
+		{
+			statsInterval = atoi(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--slow-query-ms") == 0)
+		{
+			slowQueryMilliseconds = atoll(argv[i + 1]);
+		}
+		else if (strcmp(argv[i], "--slow-query-rows") == 0)
+		{
+			slowQueryRows = atoll(argv[i + 1]);
+		}
+	}
+	
+	initServerStats();
+	initFilterKernel();
+	initScanThreadAmount();
 
 	char rootPath[1000];
 	struct passwd *pw = getpwuid(getuid());
 	strcpy(rootPath, pw->pw_dir);
 
+	umask(0);
+	if ((chdir(rootPath)) < 0) {
+		exit(EXIT_FAILURE);
+	}
+	if (strlen(restoreFrom) > 0 && restoreDatabaseRoot(restoreFrom) == 0)
+	{
+		fprintf(stderr, "Failed to restore from %s\n", restoreFrom);
+		exit(EXIT_FAILURE);
+	}
+	int versionedTableAmount = migrateDatabaseRoot();
+	if (versionedTableAmount < 0)
+	{
+		fprintf(stderr, "Failed to migrate %s, the server was not started\n", __DATABASE_ROOT);
+		exit(EXIT_FAILURE);
+	}
+	createDatabaseRoot();
+	if (initTransactionManager(versionedTableAmount) == 0)
+	{
+		fprintf(stderr, "Failed to load the transaction state, the server was not started\n");
+		exit(EXIT_FAILURE);
+	}
+
 	pid_t pid, sid;
   pid = fork();
   if (pid < 0) {
@@ -1904,18 +12541,21 @@ int main(int argc, char **argv)
   if (pid > 0) {
     exit(EXIT_SUCCESS);
   }
-  umask(0);
   sid = setsid();
   if (sid < 0) {
     exit(EXIT_FAILURE);
   }
-  if ((chdir(rootPath)) < 0) {
-    exit(EXIT_FAILURE);
-  }
   close(STDIN_FILENO);
   close(STDOUT_FILENO);
   close(STDERR_FILENO);
 	
+	ensureTableBloomFilter("admin", "account", "username");
+	ensureTableBloomFilter("admin", "database", "name");
+	initAsyncIo();
+	initScanWorkerPool();
+	initAuditLog(slowQueryMilliseconds, slowQueryRows);
+	initStatsDump(statsInterval);
+	
 	while (1) 
 	{
 		epollEventCounter = epoll_wait(epollFileDescriptor, clientsList, __MAX_CONNECTIONS, __SERVER_TIME_OUT_MSEC);
@@ -1926,8 +12566,14 @@ int main(int argc, char **argv)
 			{ 
 				newConnectionFileDescriptor = accept(serverFileDescriptor, (struct sockaddr*)&newConnectionAddr, &addrlen);
 
-				if (newConnectionFileDescriptor >= 0) 
+				if (newConnectionFileDescriptor >= __MAX_SESSIONS)
 				{
+					close(newConnectionFileDescriptor);
+				}
+				else if (newConnectionFileDescriptor >= 0) 
+				{
+					memset(&clientAccountData[newConnectionFileDescriptor], 0, sizeof(AccountData));
+					recordConnection(1);
 					setupEpollConnection(epollFileDescriptor, newConnectionFileDescriptor, &epollEventNewConnection);
 				}
 				else 
@@ -1937,12 +12583,21 @@ int main(int argc, char **argv)
 			}
 			else if (clientsList[i].events & EPOLLIN && clientsList[i].data.fd >= 0) 
 			{
-				if (recv(clientsList[i].data.fd, message, __DATA_BUFFER, 0) == 0)
+				if (recv(clientsList[i].data.fd, message, __DATA_BUFFER, MSG_WAITALL) <= 0)
 				{
 					epoll_ctl(epollFileDescriptor, EPOLL_CTL_DEL, clientsList[i].data.fd, &epollEventNewConnection);
+					
+					if (clientAccountData[clientsList[i].data.fd].transaction != NULL)
+					{
+						delTransaction(clientAccountData[clientsList[i].data.fd].transaction);
+					}
+					memset(&clientAccountData[clientsList[i].data.fd], 0, sizeof(AccountData));
+					recordConnection(0);
 				}
 				else
 				{
+					clock_gettime(CLOCK_MONOTONIC, &statementStart);
+					
 					if (message[0] == 'L')
 					{
 						int usernameLength;
@@ -1981,41 +12636,74 @@ int main(int argc, char **argv)
 							if (memcmp(password, records.record[0].data + attribute[0].size + attribute[1].size, attribute[2].size) == 0)
 							{
 								strcpy(message, "success");
-								send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
+								sendToClient(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
 								
-								memcpy(&(clientAccountData[i].id), records.record[0].data, sizeof(clientAccountData[i].id));
-								clientAccountData[i].openningDatabase = 0;
+								memcpy(&(clientAccountData[clientsList[i].data.fd].id), records.record[0].data, sizeof(clientAccountData[clientsList[i].data.fd].id));
+								clientAccountData[clientsList[i].data.fd].openningDatabase = 0;
+								strcpy(clientAccountData[clientsList[i].data.fd].username, username);
 							}
 							else
 							{
 								strcpy(message, "failed");
-								send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
+								sendToClient(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
 							}
 						}
 						else
 						{
 							strcpy(message, "failed");
-							send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
+							sendToClient(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
 						}
 						
 						delRecordBlockVector(&records);
+						
+						statementLength = sprintf(statement, "LOGIN %s", username);
+						statementSucceeded = strcmp(message, "success") == 0;
+						statementElapsed = elapsedMicroseconds(&statementStart);
+						recordStatementStats(STATEMENT_LOGIN, statementSucceeded, statementElapsed);
+						appendAuditLog(
+							&clientAccountData[clientsList[i].data.fd], clientsList[i].data.fd, 
+							statement, statementLength, statementSucceeded, statementElapsed
+						);
 					}
 					else if (strcmp(message, "root") == 0)
 					{
-						clientAccountData[i].id = 0;
-						clientAccountData[i].openningDatabase = 0;
+						clientAccountData[clientsList[i].data.fd].id = 0;
+						clientAccountData[clientsList[i].data.fd].openningDatabase = 0;
+						strcpy(clientAccountData[clientsList[i].data.fd].username, "root");
+						
+						statementLength = sprintf(statement, "LOGIN root");
+						statementElapsed = elapsedMicroseconds(&statementStart);
+						recordStatementStats(STATEMENT_LOGIN, 1, statementElapsed);
+						appendAuditLog(
+							&clientAccountData[clientsList[i].data.fd], clientsList[i].data.fd, 
+							statement, statementLength, 1, statementElapsed
+						);
 					}
 					else
 					{
+						statementLength = strnlen(message, __DATA_BUFFER - 1);
+						memcpy(statement, message, statementLength);
+						statement[statementLength] = 0;
+						
+						if (isSlowQueryLogEnabled() == 1)
+						{
+							memset(statementProfile, 0, sizeof(QueryProfile));
+							statementProfile->current = -1;
+							statementProfile->analyze = 1;
+							activeQueryProfile = statementProfile;
+							beginQueryOperatorAt("parse", &statementStart);
+						}
+						
 						ParsedStringQueue *queue = parseStringSQLScript(message);
 						
 						if (queue != NULL && strcasecmp(queue->parsedString, "CREATE") == 0)
 						{
 							popParsedStringQueue(&queue);
 							
-							if (queue != NULL && strcasecmp(queue->parsedString, "USER") == 0 && clientAccountData[i].id == 0)
+							if (queue != NULL && strcasecmp(queue->parsedString, "USER") == 0 && clientAccountData[clientsList[i].data.fd].id == 0)
 							{
 								popParsedStringQueue(&queue);
+								statementLength = redactAuditStatement(statement, statementLength, sizeof(statement));
 								if (createNewAccount(&queue) == 1)
 								{
 									strcpy(message, "MBerhasil menambahkan akun");
@@ -2028,7 +12716,7 @@ int main(int argc, char **argv)
 							else if (queue != NULL && strcasecmp(queue->parsedString, "DATABASE") == 0)
 							{
 								popParsedStringQueue(&queue);
-								if (createDatabaseScript(&queue, clientAccountData[i].id) == 1)
+								if (createDatabaseScript(&queue, clientAccountData[clientsList[i].data.fd].id) == 1)
 								{
 									strcpy(message, "MBerhasil membuat database baru");
 								}
@@ -2040,7 +12728,7 @@ int main(int argc, char **argv)
 							else if (queue != NULL && strcasecmp(queue->parsedString, "TABLE") == 0)
 							{
 								popParsedStringQueue(&queue);
-								if (createTableScript(&queue, &(clientAccountData[i])) == 1)
+								if (createTableScript(&queue, &(clientAccountData[clientsList[i].data.fd])) == 1)
 								{
 									strcpy(message, "MBerhasil membuat table baru");
 								}
@@ -2049,6 +12737,34 @@ int main(int argc, char **argv)
 									strcpy(message, "MGagal membuat table baru");
 								}
 							}
+							else if (queue != NULL && strcasecmp(queue->parsedString, "INDEX") == 0)
+							{
+								popParsedStringQueue(&queue);
+								if (createIndexScript(&queue, &(clientAccountData[clientsList[i].data.fd])) == 1)
+								{
+									strcpy(message, "MBerhasil membuat index");
+								}
+								else
+								{
+									strcpy(message, "MGagal membuat index");
+								}
+							}
+							else if (queue != NULL && strcasecmp(queue->parsedString, "BLOOM") == 0)
+							{
+								popParsedStringQueue(&queue);
+								if (queue != NULL && strcasecmp(queue->parsedString, "FILTER") == 0)
+								{
+									popParsedStringQueue(&queue);
+								}
+								if (createBloomFilterScript(&queue, &(clientAccountData[clientsList[i].data.fd])) == 1)
+								{
+									strcpy(message, "MBerhasil membuat bloom filter");
+								}
+								else
+								{
+									strcpy(message, "MGagal membuat bloom filter");
+								}
+							}
 							else
 							{
 								strcpy(message, "MScript error");
@@ -2061,7 +12777,7 @@ int main(int argc, char **argv)
 							if (queue != NULL && strcasecmp(queue->parsedString, "DATABASE") == 0)
 							{
 								popParsedStringQueue(&queue);
-								if (dropDatabaseScript(&queue, &clientAccountData[i]) == 1)
+								if (dropDatabaseScript(&queue, &clientAccountData[clientsList[i].data.fd]) == 1)
 								{
 									strcpy(message, "MBerhasil drop database");
 								}
@@ -2073,7 +12789,7 @@ int main(int argc, char **argv)
 							else if (queue != NULL && strcasecmp(queue->parsedString, "TABLE") == 0)
 							{
 								popParsedStringQueue(&queue);
-								if (dropTableScript(&queue, &(clientAccountData[i])) == 0)
+								if (dropTableScript(&queue, &(clientAccountData[clientsList[i].data.fd])) == 0)
 								{
 									strcpy(message, "MBerhasil drop table");
 								}
@@ -2085,7 +12801,7 @@ int main(int argc, char **argv)
 							else if (queue != NULL && strcasecmp(queue->parsedString, "COLUMN") == 0)
 							{
 								popParsedStringQueue(&queue);
-								if (dropColumnScript(&queue, &(clientAccountData[i])) == 1)
+								if (dropColumnScript(&queue, &(clientAccountData[clientsList[i].data.fd])) == 1)
 								{
 									strcpy(message, "MBerhasil drop column");
 								}
@@ -2103,7 +12819,7 @@ int main(int argc, char **argv)
 						{
 							popParsedStringQueue(&queue);
 							
-							if (queue != NULL && strcasecmp(queue->parsedString, "PERMISSION") == 0 && clientAccountData[i].id == 0)
+							if (queue != NULL && strcasecmp(queue->parsedString, "PERMISSION") == 0 && clientAccountData[clientsList[i].data.fd].id == 0)
 							{
 								popParsedStringQueue(&queue);
 								if (grantPermissionUserOnDatabase(&queue) == 1)
@@ -2124,7 +12840,7 @@ int main(int argc, char **argv)
 						{
 							popParsedStringQueue(&queue);
 							
-							if (useDatabaseScript(&queue, &(clientAccountData[i])) == 1)
+							if (useDatabaseScript(&queue, &(clientAccountData[clientsList[i].data.fd])) == 1)
 							{
 								strcpy(message, "MBerhasil membuka database");
 							}
@@ -2140,9 +12856,16 @@ int main(int argc, char **argv)
 							if (queue != NULL && strcasecmp(queue->parsedString, "INTO") == 0)
 							{
 								popParsedStringQueue(&queue);
-								if (insertIntoDatabaseScript(&queue, &clientAccountData[i]) == 1)
+								if (insertIntoDatabaseScript(&queue, &clientAccountData[clientsList[i].data.fd]) == 1)
 								{
-									strcpy(message, "MBerhasil memasukkan data");
+									if (clientAccountData[clientsList[i].data.fd].transaction != NULL)
+									{
+										strcpy(message, "MBerhasil ditambahkan ke transaksi");
+									}
+									else
+									{
+										strcpy(message, "MBerhasil memasukkan data");
+									}
 								}
 								else
 								{
@@ -2161,8 +12884,12 @@ int main(int argc, char **argv)
 							if (queue != NULL && strcasecmp(queue->parsedString, "FROM") == 0)
 							{
 								popParsedStringQueue(&queue);
-								int deleted = deleteFromTableScript(&queue, &clientAccountData[i]);
-								if (deleted >= 0)
+								int deleted = deleteFromTableScript(&queue, &clientAccountData[clientsList[i].data.fd]);
+								if (deleted >= 0 && clientAccountData[clientsList[i].data.fd].transaction != NULL)
+								{
+									strcpy(message, "MBerhasil ditambahkan ke transaksi");
+								}
+								else if (deleted >= 0)
 								{
 									sprintf(message, "MBerhasil menghapus %d data", deleted);
 								}
@@ -2180,134 +12907,65 @@ int main(int argc, char **argv)
 						{
 							popParsedStringQueue(&queue);
 							
-							if (queue != NULL)
+							char *cacheKey = NULL;
+							if (
+								clientAccountData[clientsList[i].data.fd].openningDatabase == 1 && 
+								clientAccountData[clientsList[i].data.fd].transaction == NULL
+							)
 							{
-								Attribute tableAttribute[__MAX_ATTRIBUTE_ON_TABLE];
-								int totalAttribute = 0;
-								RecordBlockVector records;
-								initRecordBlockVector(&records);
-								int selectedAttribute[__MAX_ATTRIBUTE_ON_TABLE];
-								int amountOfSelectedAttribute = 0;
-										
-								if (
-									selectFromTableScript(
-										&queue, &clientAccountData[i], tableAttribute, &totalAttribute, 
-										&records, selectedAttribute, &amountOfSelectedAttribute
-									) == 1
-								)
-								{
-									sprintf(message, "Q");
-									send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-									
-									memcpy(message, &amountOfSelectedAttribute, sizeof(amountOfSelectedAttribute));
-									send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-									
-									for (int j = 0; j < amountOfSelectedAttribute; j++)
-									{
-										sprintf(message, "%s", tableAttribute[selectedAttribute[j]].attributeName);
-										send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-									}
-									
-									memcpy(message, &(records.size), sizeof(records.size));
-									send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-										
-									int offsetDataOfAttribute[__MAX_ATTRIBUTE_ON_TABLE];
-									int offsetData = 0;
-									
-									for (int j = 0; j < totalAttribute; j++)
-									{
-										offsetDataOfAttribute[j] = offsetData;
-										offsetData += tableAttribute[j].size;
-									}
-										
-									for (int j = 0; j < records.size; j++)
-									{
-										for (int k = 0; k < amountOfSelectedAttribute; k++)
-										{
-											if (tableAttribute[selectedAttribute[k]].type == STRING)
-											{
-												int copiedCharacter = 0;
-												int bufferFilled = 1;
-												message[0] = 'V';
-												while(copiedCharacter < tableAttribute[selectedAttribute[k]].size)
-												{
-													message[bufferFilled] = (
-														(char *)getRecordBlockVector(&records)[j].data)[
-															offsetDataOfAttribute[selectedAttribute[k]] + copiedCharacter];
-													bufferFilled++;
-													copiedCharacter++;
-													
-													if (bufferFilled == __DATA_BUFFER - 1 || copiedCharacter == tableAttribute[selectedAttribute[k]].size)
-													{
-														message[bufferFilled] = '\0';
-														send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-														bufferFilled = 1;
-														message[0] = 'V';
-													}
-												}
-											}
-											else if (tableAttribute[selectedAttribute[k]].type == INT)
-											{
-												sprintf(message, "V%d", *(int *)(getRecordBlockVector(&records)[j].data + offsetDataOfAttribute[selectedAttribute[k]])); 
-												send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-											}
-											else if (tableAttribute[selectedAttribute[k]].type == LONG)
-											{
-												sprintf(message, "V%lld", *(long long int *)(getRecordBlockVector(&records)[j].data + offsetDataOfAttribute[selectedAttribute[k]])); 
-												send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-											}
-											else if (tableAttribute[selectedAttribute[k]].type == DECIMAL)
-											{
-												sprintf(message, "V%lf", *(double *)(getRecordBlockVector(&records)[j].data + offsetDataOfAttribute[selectedAttribute[k]])); 
-												send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-											}
-											else if (tableAttribute[selectedAttribute[k]].type == DATE)
-											{
-												char date[tableAttribute[selectedAttribute[k]].size + 1];
-												strncpy(date, getRecordBlockVector(&records)[j].data + offsetDataOfAttribute[selectedAttribute[k]], tableAttribute[selectedAttribute[k]].size);
-												sprintf(message, "V%s", date); 
-												send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-											}
-											else if (tableAttribute[selectedAttribute[k]].type == TIME)
-											{
-												char time[tableAttribute[selectedAttribute[k]].size + 1];
-												strncpy(time, getRecordBlockVector(&records)[j].data + offsetDataOfAttribute[selectedAttribute[k]], tableAttribute[selectedAttribute[k]].size);
-												sprintf(message, "V%s", time); 
-												send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-											}
-											else if (tableAttribute[selectedAttribute[k]].type == DATETIME)
-											{
-												char datetime[tableAttribute[selectedAttribute[k]].size + 1];
-												strncpy(datetime, getRecordBlockVector(&records)[j].data + offsetDataOfAttribute[selectedAttribute[k]], tableAttribute[selectedAttribute[k]].size);
-												sprintf(message, "V%s", datetime); 
-												send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-											}
-											sprintf(message, "C"); 
-											send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-										}
-										sprintf(message, "R"); 
-										send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
-									}
-									sprintf(message, "F"); 
-								}
-								else
+								cacheKey = normalizeCacheKey(clientAccountData[clientsList[i].data.fd].databaseName, message);
+							}
+							
+							ResultCapture capture;
+							initResultCapture(&capture);
+							
+							int cacheHit = cacheKey != NULL && 
+								sendCachedResult(cacheKey, clientAccountData[clientsList[i].data.fd].databaseName, clientsList[i].data.fd, message) == 1;
+							if (cacheKey != NULL)
+							{
+								recordResultCacheLookup(cacheHit);
+							}
+							
+							if (clientAccountData[clientsList[i].data.fd].transaction != NULL)
+							{
+								strcpy(message, "MGagal membaca data, akhiri transaksi dengan COMMIT atau ROLLBACK terlebih dahulu");
+							}
+							else if (cacheHit == 1)
+							{
+								sprintf(message, "F"); 
+							}
+							else if (
+								queue != NULL && 
+								selectFromTableScript(
+									&queue, &clientAccountData[clientsList[i].data.fd], clientsList[i].data.fd, message, 
+									cacheKey != NULL ? &capture : NULL
+								) == 1
+							)
+							{
+								if (cacheKey != NULL)
 								{
-									strcpy(message, "MScript error");
+									storeCachedResult(cacheKey, clientAccountData[clientsList[i].data.fd].databaseName, &capture);
 								}
-									
-								delRecordBlockVector(&records);
+								sprintf(message, "F"); 
 							}
 							else
 							{
-							strcpy(message, "MScript error");
+								strcpy(message, "MScript error");
 							}
+							
+							delResultCapture(&capture);
+							free(cacheKey);
 						}
 						else if (queue != NULL && strcasecmp(queue->parsedString, "UPDATE") == 0)
 						{
 							popParsedStringQueue(&queue);
 							
-							int updateResult = updateTableScript(&queue, &clientAccountData[i]);
-							if (updateResult >= 0)
+							int updateResult = updateTableScript(&queue, &clientAccountData[clientsList[i].data.fd]);
+							if (updateResult >= 0 && clientAccountData[clientsList[i].data.fd].transaction != NULL)
+							{
+								strcpy(message, "MBerhasil ditambahkan ke transaksi");
+							}
+							else if (updateResult >= 0)
 							{
 								sprintf(message, "MBerhasil mengganti %d data", updateResult);
 							}
@@ -2316,11 +12974,179 @@ int main(int argc, char **argv)
 								strcpy(message, "MScript error");
 							}
 						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "ANALYZE") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							if (analyzeTableScript(&queue, &clientAccountData[clientsList[i].data.fd]) == 1)
+							{
+								strcpy(message, "MBerhasil menganalisis table");
+							}
+							else
+							{
+								strcpy(message, "MGagal menganalisis table");
+							}
+						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "VACUUM") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							long long int reclaimed = vacuumTableScript(&queue, &clientAccountData[clientsList[i].data.fd]);
+							if (reclaimed >= 0)
+							{
+								sprintf(message, "MBerhasil membersihkan %lld versi data", reclaimed);
+							}
+							else
+							{
+								strcpy(message, "MGagal membersihkan table");
+							}
+						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "BACKUP") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							int fileAmount = 0;
+							long long int copiedBytes = backupScript(&queue, &clientAccountData[clientsList[i].data.fd], &fileAmount);
+							if (copiedBytes >= 0)
+							{
+								sprintf(message, "MBerhasil backup %d file (%lld bytes)", fileAmount, copiedBytes);
+							}
+							else
+							{
+								strcpy(message, "MGagal backup database");
+							}
+						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "DUMP") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							if (queue != NULL && strcasecmp(queue->parsedString, "DATABASE") == 0)
+							{
+								popParsedStringQueue(&queue);
+								int dumped = queue != NULL ? 
+									dumpDatabaseScript(
+										&queue, &clientAccountData[clientsList[i].data.fd], clientsList[i].data.fd, message
+									) : 0;
+								if (dumped == 1)
+								{
+									sprintf(message, "F");
+								}
+								else if (dumped == 0)
+								{
+									strcpy(message, "MGagal dump database");
+								}
+							}
+							else
+							{
+								strcpy(message, "MScript error");
+							}
+						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "COMPRESS") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							if (compressTableScript(&queue, &clientAccountData[clientsList[i].data.fd]) == 1)
+							{
+								strcpy(message, "MBerhasil mengompresi table");
+							}
+							else
+							{
+								strcpy(message, "MGagal mengompresi table");
+							}
+						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "BEGIN") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							if (beginTransactionScript(&queue, &clientAccountData[clientsList[i].data.fd]) == 1)
+							{
+								strcpy(message, "MBerhasil memulai transaksi");
+							}
+							else
+							{
+								strcpy(message, "MGagal memulai transaksi");
+							}
+						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "COMMIT") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							if (commitTransactionScript(&clientAccountData[clientsList[i].data.fd]) == 1)
+							{
+								strcpy(message, "MBerhasil menyimpan transaksi");
+							}
+							else
+							{
+								strcpy(message, "MGagal menyimpan transaksi");
+							}
+						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "ROLLBACK") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							if (rollbackTransactionScript(&clientAccountData[clientsList[i].data.fd]) == 1)
+							{
+								strcpy(message, "MBerhasil membatalkan transaksi");
+							}
+							else
+							{
+								strcpy(message, "MGagal membatalkan transaksi");
+							}
+						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "EXPLAIN") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							if (
+								explainScript(
+									&queue, &clientAccountData[clientsList[i].data.fd], clientsList[i].data.fd, message, 
+									&statementStart
+								) == 1
+							)
+							{
+								sprintf(message, "F");
+							}
+							else
+							{
+								strcpy(message, "MScript error");
+							}
+						}
+						else if (queue != NULL && strcasecmp(queue->parsedString, "SHOW") == 0)
+						{
+							popParsedStringQueue(&queue);
+							
+							if (showStatsScript(&queue, clientsList[i].data.fd, message) == 1)
+							{
+								sprintf(message, "F");
+							}
+							else
+							{
+								strcpy(message, "MScript error");
+							}
+						}
 						else
 						{
 							strcpy(message, "MScript error");
 						}
-						send(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
+						sendToClient(clientsList[i].data.fd, message, __DATA_BUFFER, 0);
+						
+						statementSucceeded = message[0] == 'F' || strncmp(message, "MBerhasil", strlen("MBerhasil")) == 0;
+						statementElapsed = elapsedMicroseconds(&statementStart);
+						recordStatementStats(classifyStatement(statement), statementSucceeded, statementElapsed);
+						appendAuditLog(
+							&clientAccountData[clientsList[i].data.fd], clientsList[i].data.fd, 
+							statement, statementLength, statementSucceeded, statementElapsed
+						);
+						
+						if (activeQueryProfile != NULL)
+						{
+							endQueryOperator();
+							activeQueryProfile = NULL;
+							appendSlowQueryLog(
+								&clientAccountData[clientsList[i].data.fd], clientsList[i].data.fd, 
+								statement, statementLength, statementSucceeded, statementElapsed, statementProfile
+							);
+						}
 						
 						while(queue != NULL)
 						{
@@ -11,6 +11,7 @@
 #include "netinet/in.h" 
 
 #include "sys/stat.h"
+#include "sys/time.h"
 #include "sys/types.h"
 #include "sys/epoll.h"
 
@@ -67,7 +68,7 @@ int establishedConnection()
 
 void constructLoginMessage(char message[], char username[], char password[])
 {
-	message[0] = 'A';
+	message[0] = 'L';
 	int usernameLength = strlen(username);
 	int passwordLength = strlen(password);
 	size_t integerSize = sizeof(usernameLength);
@@ -76,16 +77,67 @@ void constructLoginMessage(char message[], char username[], char password[])
 	sprintf(&message[1 + 2 * integerSize], "%s%s", username, password);
 }
 
-void printMessage(char message[])
+int receiveAll(int socketFileDescriptor, char buffer[], size_t size)
 {
-	printf("%s\n", message);
+	while (size > 0)
+	{
+		ssize_t received = recv(socketFileDescriptor, buffer, size, 0);
+		if (received <= 0)
+		{
+			return 0;
+		}
+		buffer += received;
+		size -= received;
+	}
+	return 1;
+}
+
+int receiveDump(int socketFileDescriptor, FILE *output, long long int *dumpedBytes)
+{
+	char message[__DATA_BUFFER];
+	char *chunk = NULL;
+	long long int chunkCapacity = 0;
+	*dumpedBytes = 0;
+	
+	while (receiveAll(socketFileDescriptor, message, sizeof(message)) == 1)
+	{
+		if (message[0] == 'K')
+		{
+			long long int chunkSize = 0;
+			memcpy(&chunkSize, message + 1, sizeof(chunkSize));
+			if (chunkSize > chunkCapacity)
+			{
+				free(chunk);
+				chunk = malloc(chunkSize);
+				chunkCapacity = chunkSize;
+			}
+			if (receiveAll(socketFileDescriptor, chunk, chunkSize) == 0)
+			{
+				break;
+			}
+			fwrite(chunk, 1, chunkSize, output);
+			*dumpedBytes += chunkSize;
+		}
+		else if (message[0] == 'F')
+		{
+			free(chunk);
+			return 1;
+		}
+		else if (message[0] == 'M')
+		{
+			fprintf(stderr, "%s\n", message + 1);
+			break;
+		}
+	}
+	free(chunk);
+	return 0;
 }
 
 int main(int argc, char **argv)
 {
 	if (argc < 6 || strcmp(argv[1], "-u") != 0 || strcmp(argv[3], "-p") != 0) 
 	{
-		fprintf(stderr, "Error, login command '-u [username] -p [password]'\n");
+		fprintf(stderr, "Error, login command '-u [username] -p [password] [database] [output file]'\n");
 		exit(EXIT_FAILURE);
 	}
 	int socketConnectionFileDescriptor = establishedConnection();
@@ -95,7 +147,6 @@ int main(int argc, char **argv)
 	}
 
 	char message[__DATA_BUFFER];
-	char command[__DATA_BUFFER];
 	char username[64];
 	if (getuid() == __ROOT_ID)
 	{
@@ -118,17 +169,50 @@ int main(int argc, char **argv)
 		}
 		else
 		{
-			printf("Login success as %s\n", username);
+			fprintf(stderr, "Login success as %s\n", username);
 		}
 	}
-
-	while (1)
+	
+	FILE *output = stdout;
+	if (argc > 6)
 	{
-		recv(socketConnectionFileDescriptor, message, sizeof(message), 0);
-		if (strlen(message) > 0)
+		output = fopen(argv[6], "w");
+		if (output == NULL)
 		{
-			if (message[0] == 'I' || message[0] == 'S' || message[0] == 'U' || message[0] == 'D')
-				printMessage(message);
+			fprintf(stderr, "Error: [%s]\n", strerror(errno));
+			exit(EXIT_FAILURE);
 		}
 	}
+	
+	struct timeval startTime;
+	struct timeval endTime;
+	gettimeofday(&startTime, NULL);
+	
+	memset(message, 0, sizeof(message));
+	snprintf(message, sizeof(message), "DUMP DATABASE %s;", argv[5]);
+	send(socketConnectionFileDescriptor, message, sizeof(message), 0);
+	
+	long long int dumpedBytes = 0;
+	int result = receiveDump(socketConnectionFileDescriptor, output, &dumpedBytes);
+	
+	fflush(output);
+	if (output != stdout)
+	{
+		fclose(output);
+	}
+	close(socketConnectionFileDescriptor);
+	
+	if (result == 0)
+	{
+		fprintf(stderr, "Dump of %s failed\n", argv[5]);
+		exit(EXIT_FAILURE);
+	}
+	
+	gettimeofday(&endTime, NULL);
+	double elapsed = (endTime.tv_sec - startTime.tv_sec) + (endTime.tv_usec - startTime.tv_usec) / 1000000.0;
+	fprintf(
+		stderr, "Dump of %s done: %lld bytes in %.3f s (%.1f MB/s)\n", 
+		argv[5], dumpedBytes, elapsed, elapsed > 0 ? dumpedBytes / elapsed / 1048576.0 : 0.0
+	);
+	return 0;
 }